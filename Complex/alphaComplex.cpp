@@ -3,7 +3,10 @@
 #include <set>
 #include <math.h>
 #include <algorithm>
+#include <limits>
+#include <execution>
 #include "alphaComplex.hpp"
+#include "geometryKernels.hpp"
 #include "omp.h"
 
 template <typename nodeType>
@@ -38,7 +41,7 @@ alphaComplex<nodeType>::~alphaComplex()
 }
 
 template <typename nodeType>
-std::set<std::shared_ptr<nodeType>, cmpByWeight<std::shared_ptr<nodeType>>> alphaComplex<nodeType>::getDimEdges(int dim)
+const typename simplexBase<nodeType>::filtration &alphaComplex<nodeType>::getDimEdges(int dim)
 {
 	/**
 		getDimEdges(int dim)
@@ -55,44 +58,136 @@ std::set<std::shared_ptr<nodeType>, cmpByWeight<std::shared_ptr<nodeType>>> alph
 			this->simplexList.push_back({});
 	if (this->simplexList[dim].size() != 0)
 		return this->simplexList[dim];
-#pragma omp parallel for
-	for (int i = 0; i < this->dsimplexmesh.size(); ++i)
+
+	auto cellFaces = delaunayFaces(currentMesh(), dim + 1, dim + 1);
+	this->simplexList[dim].insert(cellFaces[0].begin(), cellFaces[0].end());
+	this->simplexList[dim].seal();
+	return this->simplexList[dim];
+}
+
+template <typename nodeType>
+typename alphaComplex<nodeType>::meshView alphaComplex<nodeType>::currentMesh() const
+{
+	/**
+		currentMesh()
+
+		@brief The Delaunay mesh of the complex; the flat cells of delaunayPipe when present, otherwise dsimplexmesh.
+		@tparam nodeType The data type of the simplex node.
+		@return View of the cells.
+	*/
+	if (!delaunayCells.empty())
+		return meshView{nullptr, delaunayCells.data(), delaunayCells.size() / delaunayCellSize, delaunayCellSize};
+	return meshView{&this->dsimplexmesh};
+}
+
+template <typename nodeType>
+std::vector<std::vector<std::shared_ptr<nodeType>>> alphaComplex<nodeType>::delaunayFaces(const meshView &mesh, unsigned minSize, unsigned maxSize)
+{
+	/**
+		delaunayFaces(const meshView &mesh, unsigned minSize, unsigned maxSize)
+
+		@brief Enumerate the faces of the Delaunay cells without locks. Each thread emits (hash, weight, cell, vertex mask)
+			records for its cells into its own buffers; the buffers of each face size are then concatenated, sorted by hash
+			and deduplicated keeping the minimum weight, and a node is built only for each unique face. Vertices are
+			hashed by their index, so the 0-simplices do not need the binomial table.
+		@tparam nodeType The data type of the simplex node.
+		@param mesh The Delaunay cells.
+		@param minSize Fewest vertices of a face to emit.
+		@param maxSize Most vertices of a face to emit.
+		@return The unique faces, one list per face size starting at minSize.
+	*/
+	struct cellFace
 	{
-		auto simplex = this->dsimplexmesh[i];
-		sort(simplex.begin(), simplex.end());
-		unsigned int pow_set_size = pow(2, simplex.size());
-		std::set<unsigned> gensimp;
-		for (int counter = 1; counter < pow_set_size; counter++)
+		simplexKey hash;
+		double weight;
+		size_t cell;
+		unsigned mask; // Vertices of the (sorted) cell in the face
+	};
+
+	const unsigned sizes = maxSize - minSize + 1;
+	std::vector<std::vector<std::vector<cellFace>>> emitted(omp_get_max_threads(), std::vector<std::vector<cellFace>>(sizes));
+
+#pragma omp parallel
+	{
+		auto &local = emitted[omp_get_thread_num()];
+		std::vector<unsigned> cell;
+
+#pragma omp for schedule(dynamic, 256)
+		for (size_t c = 0; c < mesh.size(); c++)
 		{
-			if (__builtin_popcount(counter) != dim + 1)
-				continue;
-			double weight = 0;
-			for (int j = 0; j < simplex.size(); j++)
-			{
-				if (counter & (1 << j))
-				{
-					unsigned indnew = simplex[j];
-					for (auto x : gensimp)
-					{
-						if (weight < (*(this->distMatrix))[x][indnew])
-							weight = (*(this->distMatrix))[x][indnew];
-					}
-					gensimp.insert(indnew);
-				}
-			}
-			std::shared_ptr<nodeType> tot = std::make_shared<nodeType>(nodeType(gensimp, weight));
-			if (this->simplexList[gensimp.size() - 1].find(tot) == this->simplexList[gensimp.size() - 1].end())
+			const auto source = mesh[c];
+			cell.assign(source.begin(), source.end());
+			std::sort(cell.begin(), cell.end());
+
+			const unsigned full = 1u << cell.size();
+			for (unsigned mask = 1; mask < full; mask++)
 			{
-				tot->hash = gensimp.size() > 1 ? this->simplexHash(gensimp) : *(gensimp.begin());
-#pragma omp critical
+				const unsigned size = __builtin_popcount(mask);
+				if (size < minSize || size > maxSize)
+					continue;
+
+				double weight = 0;
+				simplexKey hash = 0;
+				unsigned k = 0;
+				for (unsigned j = 0; j < cell.size(); j++)
 				{
-					this->simplexList[gensimp.size() - 1].insert(tot);
+					if (!(mask & (1u << j)))
+						continue;
+					for (unsigned i = 0; i < j; i++)
+						if (mask & (1u << i))
+							weight = std::max(weight, (*this->distMatrix)(cell[i], cell[j]));
+					hash += size > 1 ? this->bin.template binomial<simplexKey>(cell[j] - this->simplexOffset, ++k) : cell[j];
 				}
+				local[size - minSize].push_back({hash, weight, c, mask});
 			}
-			gensimp.clear();
 		}
 	}
-	return this->simplexList[dim];
+
+	std::vector<std::vector<std::shared_ptr<nodeType>>> ret(sizes);
+	for (unsigned s = 0; s < sizes; s++)
+	{
+		std::vector<cellFace> faces;
+		size_t total = 0;
+		for (auto &local : emitted)
+			total += local[s].size();
+		faces.reserve(total);
+		for (auto &local : emitted)
+		{
+			faces.insert(faces.end(), local[s].begin(), local[s].end());
+			std::vector<cellFace>().swap(local[s]);
+		}
+
+		// Faces shared by several cells were emitted once per cell -> keep the earliest of each hash
+		auto byHash = [](const cellFace &a, const cellFace &b)
+		{ return a.hash < b.hash || (a.hash == b.hash && a.weight < b.weight); };
+#ifndef NO_PARALLEL_ALGORITHMS
+		std::sort(std::execution::par, faces.begin(), faces.end(), byHash);
+#else
+		std::sort(faces.begin(), faces.end(), byHash);
+#endif
+		faces.erase(std::unique(faces.begin(), faces.end(), [](const cellFace &a, const cellFace &b)
+								{ return a.hash == b.hash; }),
+					faces.end());
+
+		ret[s].resize(faces.size());
+#pragma omp parallel for schedule(static)
+		for (size_t f = 0; f < faces.size(); f++)
+		{
+			const auto source = mesh[faces[f].cell];
+			std::vector<unsigned> cell(source.begin(), source.end());
+			std::sort(cell.begin(), cell.end());
+
+			std::set<unsigned> simplex;
+			for (unsigned j = 0; j < cell.size(); j++)
+				if (faces[f].mask & (1u << j))
+					simplex.insert(simplex.end(), cell[j]);
+
+			ret[s][f] = std::make_shared<nodeType>(nodeType(simplex, faces[f].weight));
+			ret[s][f]->hash = faces[f].hash;
+		}
+	}
+
+	return ret;
 }
 
 template <typename nodeType>
@@ -109,12 +204,101 @@ std::vector<std::shared_ptr<nodeType>> alphaComplex<nodeType>::expanddelaunayDim
 		@return tbd
 	*/
 	this->simplexList[dim - 1].clear();
-	std::set<std::shared_ptr<nodeType>, cmpByWeight<std::shared_ptr<nodeType>>> set_simplexes = getDimEdges(dim);
-	getDimEdges(dim + 1);
+	const auto &set_simplexes = getDimEdges(dim);
 	std::vector<std::shared_ptr<nodeType>> ret(set_simplexes.begin(), set_simplexes.end());
+	if (dim < this->maxDimension) // The cofacets are only needed below the top dimension
+		getDimEdges(dim + 1);
 	return ret;
 }
 
+template <typename nodeType>
+void alphaComplex<nodeType>::indexCofacets(unsigned dim)
+{
+	/**
+		indexCofacets(unsigned dim)
+
+		@brief Build the facet -> cofacets adjacency from simplexList[dim] to simplexList[dim + 1]. Every cofacet
+			names its dim + 2 facets by their combinatorial hash (dropping a vertex shifts the binomial of each later vertex
+			down by one), the facets are found through a flat hash index, and the pairs are counted into CSR rows in
+			cofacet order.
+		@tparam nodeType The data type of the simplex node.
+		@param dim Dimension of the facets.
+	*/
+	const auto &facets = this->simplexList[dim];
+	const auto &cofacets = this->simplexList[dim + 1];
+	facets.seal();
+	cofacets.seal();
+
+	cofacetIndex &index = cofacetAdjacency;
+	index.facets.build(facets.size(), [&](size_t i)
+					   { return facets[i]->hash >= 0 ? (simplexKey)facets[i]->hash : this->simplexHash(facets[i]->simplex); });
+
+	// Position of each facet of each cofacet in simplexList[dim], npos if the facet is not stored
+	const size_t k = dim + 2;
+	std::vector<size_t> facetOf(cofacets.size() * k);
+
+#pragma omp parallel for schedule(static)
+	for (size_t j = 0; j < cofacets.size(); j++)
+	{
+		std::vector<unsigned> vertices(cofacets[j]->simplex.begin(), cofacets[j]->simplex.end());
+		std::vector<simplexKey> prefix(k + 1, 0); // prefix[i] -> hash of the vertices before i
+		for (unsigned i = 0; i < k; i++)
+			prefix[i + 1] = prefix[i] + this->bin.template binomial<simplexKey>(vertices[i], i + 1);
+
+		simplexKey suffix = 0; // Hash of the vertices after i, each one position lower
+		for (unsigned i = k; i-- > 0;)
+		{
+			facetOf[j * k + i] = index.facets.find(prefix[i] + suffix);
+			suffix += this->bin.template binomial<simplexKey>(vertices[i], i);
+		}
+	}
+
+	index.offsets.assign(facets.size() + 1, 0);
+	for (size_t f : facetOf)
+		if (f != simplexIndex::npos)
+			index.offsets[f + 1]++;
+	for (size_t i = 0; i < facets.size(); i++)
+		index.offsets[i + 1] += index.offsets[i];
+
+	index.cofacets.resize(index.offsets[facets.size()]);
+	std::vector<size_t> pos(index.offsets.begin(), index.offsets.end() - 1);
+	for (size_t j = 0; j < cofacets.size(); j++)
+		for (size_t i = 0; i < k; i++)
+			if (facetOf[j * k + i] != simplexIndex::npos)
+				index.cofacets[pos[facetOf[j * k + i]]++] = j;
+
+	index.dim = dim;
+	index.facetVersion = facets.getVersion();
+	index.cofacetVersion = cofacets.getVersion();
+}
+
+template <typename nodeType>
+std::pair<const size_t *, const size_t *> alphaComplex<nodeType>::cofacetRange(const std::shared_ptr<nodeType> &simp)
+{
+	/**
+		cofacetRange(const std::shared_ptr<nodeType> &simp)
+
+		@brief Positions in simplexList[dim + 1] of the cofacets of a stored simplex, reindexing the dimension first if it changed.
+		@tparam nodeType The data type of the simplex node.
+		@param simp The simplex (facet).
+		@return Begin and end of the cofacet positions; both null if the simplex is not stored in the complex.
+	*/
+	const unsigned dim = simp->simplex.size() - 1;
+	const auto &facets = this->simplexList[dim];
+	const auto &cofacets = this->simplexList[dim + 1];
+	facets.seal();
+	cofacets.seal();
+
+	cofacetIndex &index = cofacetAdjacency;
+	if (index.dim != dim || index.facetVersion != facets.getVersion() || index.cofacetVersion != cofacets.getVersion())
+		indexCofacets(dim);
+
+	size_t f = index.facets.find(simp->hash >= 0 ? (simplexKey)simp->hash : this->simplexHash(simp->simplex));
+	if (f == simplexIndex::npos || facets[f]->simplex != simp->simplex)
+		return {nullptr, nullptr};
+	return {index.cofacets.data() + index.offsets[f], index.cofacets.data() + index.offsets[f + 1]};
+}
+
 template <typename nodeType>
 std::vector<std::shared_ptr<nodeType>> alphaComplex<nodeType>::getAllCofacets(std::shared_ptr<nodeType> simp)
 {
@@ -122,13 +306,26 @@ std::vector<std::shared_ptr<nodeType>> alphaComplex<nodeType>::getAllCofacets(st
 		getAllDelaunayCofacets(std::shared_ptr<nodeType> simp)
 
 
-		@brief Get Delaunay Cofacets
+		@brief Get Delaunay Cofacets from the facet -> cofacet index, in filtration order; a simplex that is not stored in the complex
+			falls back to scanning the next dimension.
 		@tparam nodeType The data type of the simplex node.
 		@param simp tbd
 		@return tbd
 	*/
 	std::vector<std::shared_ptr<nodeType>> ret;
 	unsigned dimension = simp->simplex.size();
+	if (dimension >= this->simplexList.size())
+		return ret;
+
+	auto [first, last] = cofacetRange(simp);
+	if (first != nullptr)
+	{
+		ret.reserve(last - first);
+		for (; first != last; ++first)
+			ret.push_back(this->simplexList[dimension][*first]);
+		return ret;
+	}
+
 	for (auto &iter : this->simplexList[dimension])
 	{
 		if (std::includes(iter->simplex.begin(), iter->simplex.end(), simp->simplex.begin(), simp->simplex.end()))
@@ -142,15 +339,11 @@ template <typename nodeType>
 std::vector<nodeType *> alphaComplex<nodeType>::getAllCofacets_basePointer(std::shared_ptr<nodeType> simp)
 {
 	std::vector<nodeType *> ret;
-	unsigned dimension = simp->simplex.size();
-	for (auto &iter : this->simplexList[dimension])
+	for (auto &iter : getAllCofacets(simp))
 	{
-		if (std::includes(iter->simplex.begin(), iter->simplex.end(), simp->simplex.begin(), simp->simplex.end()))
-		{
-			nodeType *x = new nodeType(iter->simplex, iter->weight);
-			x->hash = iter->hash;
-			ret.push_back(x);
-		}
+		nodeType *x = new nodeType(iter->simplex, iter->weight);
+		x->hash = iter->hash;
+		ret.push_back(x);
 	}
 	return ret;
 }
@@ -174,53 +367,16 @@ void alphaComplex<alphaNode>::buildWeightedAlphaComplex(std::vector<std::vector<
 	for (int i = 0; i <= this->maxDimension; i++)
 		this->simplexList.push_back({});
 
-#pragma omp parallel for
-	for (int i = 0; i < dsimplexmesh.size(); ++i)
-	{
-		auto simplex = dsimplexmesh[i];
-		sort(simplex.begin(), simplex.end());
-
-		unsigned int pow_set_size = pow(2, simplex.size());
-		std::set<unsigned> gensimp;
-
-		for (int counter = 1; counter < pow_set_size; counter++)
-		{
-			if (__builtin_popcount(counter) > this->maxDimension + 1)
-				continue;
-			double weight = 0;
-			for (int j = 0; j < simplex.size(); j++)
-			{
-				if (counter & (1 << j))
-				{
-					unsigned indnew = simplex[j];
-					for (auto x : gensimp)
-					{
-						if (weight < (*(this->distMatrix))[x][indnew])
-							weight = (*(this->distMatrix))[x][indnew];
-					}
-					gensimp.insert(indnew);
-				}
-			}
-			std::shared_ptr<alphaNode> tot = std::make_shared<alphaNode>(alphaNode(gensimp, weight));
-			if (this->simplexList[gensimp.size() - 1].find(tot) == this->simplexList[gensimp.size() - 1].end())
-			{
-				if (gensimp.size() == 1)
-					tot->hash = *(gensimp.begin());
-
-				else
-					tot->hash = this->simplexHash(gensimp);
-#pragma omp critical
-				{
-					this->simplexList[gensimp.size() - 1].insert(tot);
-				}
-			}
+	auto cellFaces = delaunayFaces(meshView{&dsimplexmesh}, 1, this->maxDimension + 1);
+	for (unsigned d = 0; d < cellFaces.size(); d++)
+		this->simplexList[d].insert(cellFaces[d].begin(), cellFaces[d].end());
 
-			gensimp.clear();
-		}
-	}
+	// Sort each dimension into filtration order
+	for (auto &x : this->simplexList)
+		x.seal();
 
 	int di = 0;
-	for (auto x : this->simplexList)
+	for (auto &x : this->simplexList)
 		std::cout << "Count of " << di++ << "-simplex ::" << x.size() << "\n";
 	return;
 }
@@ -243,113 +399,118 @@ void alphaComplex<nodeType>::buildWeightedAlphaComplex(std::vector<std::vector<u
 }
 
 template <>
-void alphaComplex<alphaNode>::buildAlphaComplex(std::vector<std::vector<unsigned>> dsimplexmesh, int npts, std::vector<std::vector<double>> inputData)
+void alphaComplex<alphaNode>::buildAlphaFaces(const meshView &mesh, int npts, const std::vector<std::vector<double>> &inputData)
 {
 	/**
-		(alphaNode) buildAlphaComplex(std::vector<std::vector<unsigned>> dsimplexmesh, int npts, std::vector<std::vector<double>> inputData)
+		(alphaNode) buildAlphaFaces(const meshView &mesh, int npts, const std::vector<std::vector<double>> &inputData)
 
 		Maintained by Anurag
 
 		@brief Build the alpha complex from delaunay triangulation
 		@tparam nodeType The data type of the simplex node.
-		@param dsimplexmesh the set of d-triangles for the simplex mesh
+		@param mesh the set of d-triangles for the simplex mesh
 		@param npts
 	*/
 
-	unsigned maxDimension = dsimplexmesh[0].size() - 1;
 	this->bin = binomialTable(npts, this->maxDimension + 1);
 
 	for (int i = 0; i <= this->maxDimension; i++)
 		this->simplexList.push_back({});
 
-#pragma omp parallel for
-	for (int i = 0; i < dsimplexmesh.size(); ++i)
-	{
-		auto simplex = dsimplexmesh[i];
-		sort(simplex.begin(), simplex.end());
+	auto cellFaces = delaunayFaces(mesh, 1, this->maxDimension + 1);
+	for (unsigned d = 0; d < cellFaces.size(); d++)
+		this->simplexList[d].insert(cellFaces[d].begin(), cellFaces[d].end());
 
-		unsigned int pow_set_size = pow(2, simplex.size());
-		std::set<unsigned> gensimp;
+	// Sort each dimension into filtration order, then compute the circumsphere of every unique face once;
+	// faces of a dimension share a vertex count, so each dimension is one batch of the geometry kernels
+	const size_t dim = inputData.empty() ? 0 : inputData[0].size();
+	std::vector<unsigned> vertices;
+	std::vector<double> centers, radii;
+	for (unsigned d = 0; d < this->simplexList.size(); d++)
+	{
+		auto &faces = this->simplexList[d];
+		faces.seal();
 
-		for (int counter = 1; counter < pow_set_size; counter++)
+		if (d == 0)
 		{
-			if (__builtin_popcount(counter) > this->maxDimension + 1)
-				continue;
-			double weight = 0;
-			for (int j = 0; j < simplex.size(); j++)
+#pragma omp parallel for
+			for (size_t i = 0; i < faces.size(); ++i)
 			{
-				if (counter & (1 << j))
-				{
-					unsigned indnew = simplex[j];
-					for (auto x : gensimp)
-					{
-						if (weight < (*(this->distMatrix))[x][indnew])
-							weight = (*(this->distMatrix))[x][indnew];
-					}
-					gensimp.insert(indnew);
-				}
+				faces[i]->circumRadius = faces[i]->weight / 2;
+				faces[i]->circumCenter = inputData[*(faces[i]->simplex.begin())];
 			}
-			std::shared_ptr<alphaNode> tot = std::make_shared<alphaNode>(alphaNode(gensimp, weight));
+			continue;
+		}
 
-			if (this->simplexList[gensimp.size() - 1].find(tot) == this->simplexList[gensimp.size() - 1].end())
-			{
-				if (gensimp.size() > 2)
-				{
-					tot->circumCenter = utils::circumCenter(gensimp, inputData);
-					tot->circumRadius = sqrt(utils::circumRadius(gensimp, this->distMatrix));
-					tot->hash = this->simplexHash(gensimp);
-				}
-				else if (gensimp.size() == 2)
-				{
-					auto first = gensimp.begin();
-					std::vector<double> R;
-					std::vector<double> A = inputData[*first];
-					std::advance(first, 1);
-					std::vector<double> B = inputData[*(++first)];
-					std::transform(A.begin(), A.end(), B.begin(), std::back_inserter(R), [](double e1, double e2)
-								   { return ((e1 + e2) / 2); });
-					tot->circumCenter = R;
-					tot->circumRadius = sqrt(utils::circumRadius(gensimp, this->distMatrix));
-					tot->hash = this->simplexHash(gensimp);
-				}
-				else
-				{
-					tot->circumRadius = weight / 2;
-					tot->circumCenter = inputData[*(gensimp.begin())];
-					tot->hash = *(gensimp.begin());
-				}
-#pragma omp critical
-				{
-					this->simplexList[gensimp.size() - 1].insert(tot);
-				}
-			}
-			gensimp.clear();
+		vertices.resize(faces.size() * (d + 1));
+#pragma omp parallel for
+		for (size_t i = 0; i < faces.size(); ++i)
+			std::copy(faces[i]->simplex.begin(), faces[i]->simplex.end(), vertices.begin() + i * (d + 1));
+
+		geometryKernels::circumCenters(vertices, d + 1, inputData, centers);
+		geometryKernels::circumRadii(vertices, d + 1, *this->distMatrix, radii);
+
+#pragma omp parallel for
+		for (size_t i = 0; i < faces.size(); ++i)
+		{
+			faces[i]->circumCenter.assign(centers.begin() + i * dim, centers.begin() + (i + 1) * dim);
+			faces[i]->circumRadius = sqrt(radii[i] < 0 ? std::numeric_limits<double>::max() : radii[i]);
 		}
 	}
 
 	int di = 0;
-	for (auto x : this->simplexList)
+	for (auto &x : this->simplexList)
 		std::cout << "Count of " << di++ << "-simplex ::" << x.size() << "\n";
 
 	return;
 }
 
 template <typename nodeType>
-void alphaComplex<nodeType>::buildAlphaComplex(std::vector<std::vector<unsigned>> dsimplexmesh, int npts, std::vector<std::vector<double>> inputData)
+void alphaComplex<nodeType>::buildAlphaFaces(const meshView &mesh, int npts, const std::vector<std::vector<double>> &inputData)
 {
 	/**
-		(witnessNode/simplexNode) buildAlphaComplex(std::vector<std::vector<unsigned>> dsimplexmesh, int npts, std::vector<std::vector<double>> inputData)
+		(witnessNode/simplexNode) buildAlphaFaces(const meshView &mesh, int npts, const std::vector<std::vector<double>> &inputData)
 
 		@brief Build the alpha complex; currently a stub for witnessNode/simplexNode
 		@tparam nodeType The data type of the simplex node.
-		@param dsimplexmesh the set of d-triangles for the simplex mesh
+		@param mesh the set of d-triangles for the simplex mesh
 		@param npts
 	*/
 	std::cout << "alphaComplex<witnessNode, simplexNode>::buildAlphaComplex() Not Implemented" << std::endl;
 	return;
 }
 
+template <typename nodeType>
+void alphaComplex<nodeType>::buildAlphaComplex(std::vector<std::vector<unsigned>> dsimplexmesh, int npts, std::vector<std::vector<double>> inputData)
+{
+	/**
+		buildAlphaComplex(std::vector<std::vector<unsigned>> dsimplexmesh, int npts, std::vector<std::vector<double>> inputData)
+
+		@brief Build the alpha complex from a delaunay triangulation given as one vector per cell
+		@tparam nodeType The data type of the simplex node.
+		@param dsimplexmesh the set of d-triangles for the simplex mesh
+		@param npts
+	*/
+	buildAlphaFaces(meshView{&dsimplexmesh}, npts, inputData);
+}
+
+template <typename nodeType>
+void alphaComplex<nodeType>::buildAlphaComplex(const std::vector<unsigned> &cells, unsigned cellSize, int npts, const std::vector<std::vector<double>> &inputData)
+{
+	/**
+		buildAlphaComplex(const std::vector<unsigned> &cells, unsigned cellSize, int npts, const std::vector<std::vector<double>> &inputData)
+
+		@brief Build the alpha complex from a delaunay triangulation with its cells stored back to back
+		@tparam nodeType The data type of the simplex node.
+		@param cells Vertex indices, cellSize per cell
+		@param cellSize Vertices of each cell
+		@param npts
+	*/
+	buildAlphaFaces(meshView{nullptr, cells.data(), cellSize ? cells.size() / cellSize : 0, cellSize}, npts, inputData);
+}
+
 // Explicit Template Class Instantiation
 template class alphaComplex<simplexNode>;
+template class alphaComplex<wideSimplexNode>;
 template class alphaComplex<alphaNode>;
 template class alphaComplex<witnessNode>;
@@ -1,6 +1,7 @@
 
 #pragma once
 #include <set>
+#include <span>
 #include <unordered_map>
 #include "simplexArrayList.hpp"
 #include "utils.hpp"
@@ -12,7 +13,46 @@ class alphaComplex : public simplexArrayList<nodeType>
 	typedef std::shared_ptr<nodeType> templateNode_P;
 	std::vector<std::vector<int>> neighbourhood;
 
+	// Facet -> cofacets adjacency between simplexList[dim] and simplexList[dim + 1] in CSR form
+	//		Rebuilt on the first cofacet query after either dimension changed (see simplexFiltration versions)
+	struct cofacetIndex
+	{
+		unsigned dim = 0;
+		size_t facetVersion = SIZE_MAX;
+		size_t cofacetVersion = SIZE_MAX;
+		simplexIndex facets;		  // Facet hash -> position in simplexList[dim]
+		std::vector<size_t> offsets;  // Cofacets of facet i are cofacets[offsets[i]] ... cofacets[offsets[i + 1] - 1]
+		std::vector<size_t> cofacets; // Positions in simplexList[dim + 1], ascending (filtration order)
+	};
+	cofacetIndex cofacetAdjacency;
+
+	void indexCofacets(unsigned);
+	std::pair<const size_t *, const size_t *> cofacetRange(const templateNode_P &);
+
+	// Read-only view of a Delaunay mesh, either nested cells (qhullPipe) or cells stored back to back (delaunayPipe)
+	struct meshView
+	{
+		const std::vector<std::vector<unsigned>> *nested = nullptr;
+		const unsigned *flat = nullptr;
+		size_t count = 0;
+		unsigned cellSize = 0;
+
+		size_t size() const { return nested != nullptr ? nested->size() : count; }
+		std::span<const unsigned> operator[](size_t c) const
+		{
+			return nested != nullptr ? std::span<const unsigned>((*nested)[c]) : std::span<const unsigned>(flat + c * cellSize, cellSize);
+		}
+	};
+	meshView currentMesh() const;
+
+	// Unique faces of the Delaunay cells with minSize ... maxSize vertices, one list per face size
+	std::vector<std::vector<templateNode_P>> delaunayFaces(const meshView &, unsigned, unsigned);
+	void buildAlphaFaces(const meshView &, int, const std::vector<std::vector<double>> &);
+
 public:
+	std::vector<unsigned> delaunayCells; // Delaunay cells stored back to back, delaunayCellSize vertices each (see delaunayPipe)
+	unsigned delaunayCellSize = 0;
+
 	alphaComplex(double, double);
 
 	// virtual interface functions
@@ -31,10 +71,11 @@ public:
 	std::vector<templateNode_P> getAllCofacets(templateNode_P);
 	std::vector<nodeType *> getAllCofacets_basePointer(templateNode_P);
 	void buildAlphaComplex(std::vector<std::vector<unsigned>> dsimplexmesh, int pts, std::vector<std::vector<double>> inputData);
+	void buildAlphaComplex(const std::vector<unsigned> &cells, unsigned cellSize, int pts, const std::vector<std::vector<double>> &inputData);
 	void buildFilteration(std::vector<std::vector<unsigned>> dsimplexmesh, int npts, std::vector<std::vector<double>> inputData, double beta, kdTree tree);
 	bool checkGabriel(std::vector<double>, std::vector<unsigned>, std::vector<std::vector<double>> &, double);
 	std::vector<templateNode_P> expanddelaunayDimension(int);
-	std::set<templateNode_P, cmpByWeight<templateNode_P>> getDimEdges(int);
+	const typename simplexBase<nodeType>::filtration &getDimEdges(int);
 
 	// Nick
 
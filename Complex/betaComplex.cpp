@@ -4,6 +4,7 @@
 #include <math.h>
 #include <algorithm>
 #include "betaComplex.hpp"
+#include "geometryKernels.hpp"
 #include <fstream>
 
 template <typename nodeType>
@@ -52,11 +53,11 @@ void betaComplex<nodeType>::buildBetaComplex(std::vector<std::vector<unsigned>>
 					{
 						if (x < indnew)
 						{
-							if (weight < (*(this->distMatrix))[x][indnew])
-								weight = (*(this->distMatrix))[x][indnew];
+							if (weight < (*(this->distMatrix))(x, indnew))
+								weight = (*(this->distMatrix))(x, indnew);
 						}
-						else if (weight < (*(this->distMatrix))[indnew][x])
-							weight = (*(this->distMatrix))[indnew][x];
+						else if (weight < (*(this->distMatrix))(indnew, x))
+							weight = (*(this->distMatrix))(indnew, x);
 					}
 					gensimp.insert(indnew);
 				}
@@ -64,7 +65,7 @@ void betaComplex<nodeType>::buildBetaComplex(std::vector<std::vector<unsigned>>
 
 			double weight1 = weight;
 			if (gensimp.size() > 1)
-				weight = utils::circumRadius(gensimp, this->distMatrix);
+				weight = geometryKernels::circumRadius(gensimp, *this->distMatrix);
 			else
 				weight = weight / 2;
 			std::shared_ptr<nodeType> tot = std::make_shared<nodeType>(nodeType(gensimp, weight1));
@@ -80,8 +81,12 @@ void betaComplex<nodeType>::buildBetaComplex(std::vector<std::vector<unsigned>>
 	}
 	out.close();
 
+	// Faces shared by several cells were emitted once per cell; sealing keeps one of each
+	for (auto &x : this->simplexList)
+		x.seal();
+
 	int di = 0;
-	for (auto x : this->simplexList)
+	for (auto &x : this->simplexList)
 		std::cout << "Count of " << di++ << "-simplex ::" << x.size() << "\n";
 	return;
 }
@@ -125,5 +130,6 @@ void buildFilteration(std::vector<std::vector<unsigned>> dsimplexmesh, int npts,
 
 // Explicit Template Class Instantiation
 template class betaComplex<simplexNode>;
+template class betaComplex<wideSimplexNode>;
 template class betaComplex<alphaNode>;
 template class betaComplex<witnessNode>;
@@ -5,6 +5,8 @@
 #include <algorithm>
 #include "simplexArrayList.hpp"
 #include <fstream>
+#include <limits>
+#include "omp.h"
 
 // simplexArrayList constructor, currently no needed information for the class constructor
 template <typename nodeType>
@@ -19,14 +21,27 @@ binomialTable::binomialTable(unsigned n, unsigned k) : v(n + 1, std::vector<long
 { // Fast computation of binomials with precomputed table
 	v[0][0] = 1;
 
-	for (int i = 1; i <= n; i++)
+	for (unsigned i = 1; i <= n; i++)
 	{
 		v[i][0] = 1;
-		for (int j = 1; j <= k; j++)
+		for (unsigned j = 1; j <= k; j++)
 		{
-			v[i][j] = v[i - 1][j - 1] + v[i - 1][j]; // Pascal's Rule
-			if (v[i][j] < 0)
-				throw std::overflow_error("Binomial overflow");
+			if (__builtin_add_overflow(v[i - 1][j - 1], v[i - 1][j], &v[i][j])) // Pascal's Rule
+			{ // Coefficients outgrow long long -> rebuild the table in __int128
+				v.clear();
+				wide.assign(n + 1, std::vector<__int128>(k + 1, 0));
+				wide[0][0] = 1;
+				for (unsigned a = 1; a <= n; a++)
+				{
+					wide[a][0] = 1;
+					for (unsigned b = 1; b <= k; b++)
+					{
+						if (__builtin_add_overflow(wide[a - 1][b - 1], wide[a - 1][b], &wide[a][b]))
+							throw std::overflow_error("Binomial overflow");
+					}
+				}
+				return;
+			}
 		}
 	}
 }
@@ -35,20 +50,23 @@ long long binomialTable::binom(unsigned n, unsigned k)
 { // Return binomial coefficient
 	if (k > n)
 		return 0;
-	return v[n][k];
+	if (!isWide())
+		return v[n][k];
+	if (wide[n][k] > std::numeric_limits<long long>::max())
+		throw std::overflow_error("Binomial overflow");
+	return (long long)wide[n][k];
 }
 
 // Hash the set by converting to a remapped index
 template <typename nodeType>
-long long simplexArrayList<nodeType>::simplexHash(const std::set<unsigned> &simplex)
+simplexKey simplexArrayList<nodeType>::simplexHash(const std::set<unsigned> &simplex)
 {
-	long long simplexIndex = 0;
+	simplexKey simplexIndex = 0;
 	unsigned i = 0;
 	auto it = simplex.begin();
 	while (it != simplex.end())
 	{
-		simplexIndex += bin.binom(*it - this->simplexOffset, ++i); /// TODO - FIX OFFSET
-		if (simplexIndex < 0)
+		if (__builtin_add_overflow(simplexIndex, bin.binomial<simplexKey>(*it - this->simplexOffset, ++i), &simplexIndex)) /// TODO - FIX OFFSET
 			throw std::overflow_error("Binomial overflow");
 		++it;
 	}
@@ -56,12 +74,13 @@ long long simplexArrayList<nodeType>::simplexHash(const std::set<unsigned> &simp
 }
 
 template <typename nodeType>
-unsigned simplexArrayList<nodeType>::maxVertex(long long simplexHash, unsigned high, unsigned low, unsigned k)
+template <typename index>
+unsigned simplexArrayList<nodeType>::maxVertex(index simplexHash, unsigned high, unsigned low, unsigned k)
 {
 	while (high > low)
 	{ // Binary search for the max vertex for this simplex
 		unsigned mid = (high + low) / 2;
-		if (bin.binom(mid, k) <= simplexHash)
+		if (bin.binomial<index>(mid, k) <= simplexHash)
 			low = mid + 1;
 		else
 			high = mid;
@@ -70,36 +89,96 @@ unsigned simplexArrayList<nodeType>::maxVertex(long long simplexHash, unsigned h
 }
 
 template <typename nodeType>
-std::set<unsigned> simplexArrayList<nodeType>::getVertices(long long simplexHash, int dim, unsigned n)
+template <typename index>
+std::set<unsigned> simplexArrayList<nodeType>::getVertices(index simplexHash, int dim, unsigned n)
 {
 	std::set<unsigned> v;
 	for (unsigned k = dim + 1; k > 0; k--)
 	{ // Get all vertices by repeated binary search for max vertex
 		n = maxVertex(simplexHash, n, k - 1, k);
 		v.insert(n);
-		simplexHash -= bin.binom(n, k);
+		simplexHash -= bin.binomial<index>(n, k);
 	}
 	return v;
 }
 
+// Expand nParents simplices across OpenMP threads
+//		collect(j, found) appends the expansions of parent j to a thread-local buffer; once every buffer is filled,
+//		reserve(total) sizes the output and emit(i, e) writes the expansions of each thread to positions i laid out back to back
 template <typename nodeType>
-void simplexArrayList<nodeType>::prepareCofacets(int dim)
+template <typename Collect, typename Reserve, typename Emit>
+void simplexArrayList<nodeType>::parallelExpand(size_t nParents, Collect &&collect, Reserve &&reserve, Emit &&emit)
 {
-	indexConverter.clear();
-	for (auto simplex : this->simplexList[dim + 1])
+	std::vector<std::vector<expansion>> found(omp_get_max_threads());
+	std::vector<size_t> offsets(found.size() + 1, 0);
+
+#pragma omp parallel
 	{
-		indexConverter.insert(std::make_pair(simplex->hash, simplex));
+		std::vector<expansion> &local = found[omp_get_thread_num()];
+
+#pragma omp for schedule(dynamic, 64)
+		for (size_t j = 0; j < nParents; j++)
+			collect(j, local);
+
+#pragma omp single
+		{
+			for (size_t t = 0; t < found.size(); t++)
+				offsets[t + 1] = offsets[t] + found[t].size();
+			reserve(offsets.back());
+		}
+
+		size_t i = offsets[omp_get_thread_num()];
+		for (auto &e : local)
+			emit(i++, e);
 	}
 }
 
+// Expand nParents simplices into new nodes; build(e, node) fills the node of each expansion
+template <typename nodeType>
+template <typename Collect, typename Build>
+std::vector<std::shared_ptr<nodeType>> simplexArrayList<nodeType>::parallelExpand(size_t nParents, Collect &&collect, Build &&build)
+{
+	std::vector<std::shared_ptr<nodeType>> ret;
+	parallelExpand(
+		nParents, collect, [&](size_t total)
+		{ ret.resize(total); },
+		[&](size_t i, const expansion &e)
+		{
+			ret[i] = std::make_shared<nodeType>();
+			build(e, *ret[i]);
+		});
+
+	return ret;
+}
+
+// Index the simplices of one dimension by hash for findIndexed
+template <typename nodeType>
+void simplexArrayList<nodeType>::indexDimension(unsigned dim)
+{
+	indexedSimplices = &this->simplexList[dim];
+	indexedSimplices->seal();
+	indexConverter.build(indexedSimplices->size(), [&](size_t i)
+						 { return (*indexedSimplices)[i]->hash; });
+}
+
+// Simplex of the indexed dimension with the given hash, or nullptr
+template <typename nodeType>
+const std::shared_ptr<nodeType> *simplexArrayList<nodeType>::findIndexed(simplexKey hash) const
+{
+	size_t pos = indexConverter.find(hash);
+	return (pos == simplexIndex::npos) ? nullptr : &(*indexedSimplices)[pos];
+}
+
+template <typename nodeType>
+void simplexArrayList<nodeType>::prepareCofacets(int dim)
+{
+	indexDimension(dim + 1);
+}
+
 template <typename nodeType>
 void simplexArrayList<nodeType>::prepareFacets(int dim)
 {
-	indexConverter.clear();
-	for (auto simplex : this->simplexList[dim - 1])
-	{
-		indexConverter.insert(std::make_pair(simplex->hash, simplex));
-	}
+	indexDimension(dim - 1);
 }
 
 template <typename nodeType>
@@ -109,7 +188,35 @@ std::vector<std::shared_ptr<nodeType>> simplexArrayList<nodeType>::getAllCofacet
 	int nPts = this->simplexList[0].size();
 	unsigned k = simplex.size() + 1;
 	std::set<unsigned>::reverse_iterator it = simplex.rbegin();
-	long long index = simplexHash(simplex);
+	simplexKey index = simplexHash(simplex);
+
+	if (this->neighGraph != nullptr)
+	{ // Sparse graph -> only common neighbors of every vertex can form a cofacet; visit them in the same (descending) order
+		auto candidates = this->neighGraph->commonNeighbors(simplex);
+		for (auto cand = candidates.rbegin(); cand != candidates.rend(); ++cand)
+		{
+			unsigned i = cand->first;
+			for (; it != simplex.rend() && *it > i; ++it, --k)
+			{ // Passed vertex *it of the simplex -> it is now the kth largest vertex instead of the (k-1)th
+				index -= bin.binomial<simplexKey>(*it, k - 1);
+				index += bin.binomial<simplexKey>(*it, k);
+			}
+
+			const std::shared_ptr<nodeType> *tempNode = findIndexed(index + bin.binomial<simplexKey>(i, k));
+			if (tempNode != nullptr)
+			{
+				ret.push_back(*tempNode);
+
+				if (checkEmergent && (*tempNode)->weight == simplexWeight)
+				{
+					if (pivotPairs.find(*tempNode) == pivotPairs.end())
+						return ret;
+					checkEmergent = false;
+				}
+			}
+		}
+		return ret;
+	}
 
 	// Try inserting other vertices into the simplex
 	for (unsigned i = nPts; i-- != 0;)
@@ -117,26 +224,26 @@ std::vector<std::shared_ptr<nodeType>> simplexArrayList<nodeType>::getAllCofacet
 		if (it != simplex.rend() && i == *it - this->simplexOffset)
 		{ // Vertex i is already in the simplex
 			// Now adding vertices less than i -> i is now the kth largest vertex in the simplex instead of the (k-1)th
-			index -= bin.binom(i, k - 1);
-			index += bin.binom(i, k); // Recompute the index accordingly
+			index -= bin.binomial<simplexKey>(i, k - 1);
+			index += bin.binomial<simplexKey>(i, k); // Recompute the index accordingly
 
 			--k;  // Now need to check for the (k-1)th vertex in the simplex
 			++it; // Check for the previous vertex in the simplex (it is a reverse iterator)
 		}
 		else
 		{
-			auto tempNode = indexConverter.find(index + bin.binom(i, k));
-			if (tempNode != indexConverter.end())
+			const std::shared_ptr<nodeType> *tempNode = findIndexed(index + bin.binomial<simplexKey>(i, k));
+			if (tempNode != nullptr)
 			{ // If this is a valid simplex, add it to the heap
-				ret.push_back(tempNode->second);
+				ret.push_back(*tempNode);
 
 				// If we haven't found an emergent candidate and the weight of the maximal cofacet is equal to the simplex's weight
 				//		we have identified an emergent pair; at this point we can break because the interval is born and dies at the
 				//		same epsilon
-				if (checkEmergent && tempNode->second->weight == simplexWeight)
+				if (checkEmergent && (*tempNode)->weight == simplexWeight)
 				{
 					// Check to make sure the identified cofacet isn't a pivot
-					if (pivotPairs.find(tempNode->second) == pivotPairs.end())
+					if (pivotPairs.find(*tempNode) == pivotPairs.end())
 						return ret;
 					checkEmergent = false;
 				}
@@ -148,7 +255,7 @@ std::vector<std::shared_ptr<nodeType>> simplexArrayList<nodeType>::getAllCofacet
 }
 
 template <typename nodeType>
-std::vector<nodeType *> simplexArrayList<nodeType>::getAllCofacets(std::shared_ptr<nodeType> simp, const std::unordered_map<long long, std::shared_ptr<nodeType>> &pivotPairs, bool checkEmergent, bool recordVertices, unsigned dim)
+std::vector<nodeType *> simplexArrayList<nodeType>::getAllCofacets(std::shared_ptr<nodeType> simp, const std::unordered_map<simplexKey, std::shared_ptr<nodeType>, indexHash> &pivotPairs, bool checkEmergent, bool recordVertices, unsigned dim)
 {
 	// Method builds out cofacets for incrementalPersistence
 
@@ -158,11 +265,48 @@ std::vector<nodeType *> simplexArrayList<nodeType>::getAllCofacets(std::shared_p
 	if (recordVertices)
 		vertices = simp->simplex;
 	else
-		vertices = getVertices(simp->hash, dim, this->simplexList[0].size());
+		vertices = getVertices((simplexKey)simp->hash, dim, this->simplexList[0].size());
 
 	unsigned k = vertices.size() + 1;
-	std::set<unsigned>::reverse_iterator it = vertices.rbegin();
-	long long index = simp->hash;
+	auto it = vertices.rbegin();
+	simplexKey index = simp->hash;
+
+	if (this->neighGraph != nullptr)
+	{ // Sparse graph -> only common neighbors of every vertex can form a cofacet; visit them in the same (descending) order
+		auto candidates = this->neighGraph->commonNeighbors(vertices);
+		const double death = this->neighGraph->death(vertices);
+		for (auto cand = candidates.rbegin(); cand != candidates.rend(); ++cand)
+		{
+			unsigned i = cand->first;
+			for (; it != vertices.rend() && *it > i; ++it, --k)
+			{ // Passed vertex *it of the simplex -> it is now the kth largest vertex instead of the (k-1)th
+				index -= bin.binomial<simplexKey>(*it, k - 1);
+				index += bin.binomial<simplexKey>(*it, k);
+			}
+
+			double maxWeight = std::max(simp->weight, cand->second);
+			if (maxWeight <= this->maxEpsilon && maxWeight <= std::min(death, this->neighGraph->death(i)))
+			{ // Valid simplex, and none of its vertices has left the (sparse) filtration
+				nodeType *x = new nodeType();
+				if (recordVertices)
+				{
+					x->simplex = vertices;
+					x->simplex.insert(i);
+				}
+				x->weight = maxWeight;
+				x->hash = index + bin.binomial<simplexKey>(i, k);
+				ret.push_back(x);
+
+				if (checkEmergent && maxWeight == simp->weight)
+				{
+					if (pivotPairs.find(x->hash) == pivotPairs.end())
+						return ret;
+					checkEmergent = false;
+				}
+			}
+		}
+		return ret;
+	}
 
 	// Try inserting other vertices into the simplex
 	for (unsigned i = this->simplexList[0].size(); i-- != 0;)
@@ -170,8 +314,8 @@ std::vector<nodeType *> simplexArrayList<nodeType>::getAllCofacets(std::shared_p
 		if (it != vertices.rend() && i == *it - this->simplexOffset)
 		{ // Vertex i is already in the simplex
 			// Now adding vertices less than i -> i is now the kth largest vertex in the simplex instead of the (k-1)th
-			index -= bin.binom(i, k - 1);
-			index += bin.binom(i, k); // Recompute the index accordingly
+			index -= bin.binomial<simplexKey>(i, k - 1);
+			index += bin.binomial<simplexKey>(i, k); // Recompute the index accordingly
 			--k;					  // Now need to check for the (k-1)th vertex in the simplex
 			++it;					  // Check for the previous vertex in the simplex (it is a reverse iterator)
 		}
@@ -180,7 +324,7 @@ std::vector<nodeType *> simplexArrayList<nodeType>::getAllCofacets(std::shared_p
 			double maxWeight = simp->weight;
 			for (auto pt : vertices)
 			{
-				maxWeight = std::max(maxWeight, (*this->distMatrix)[std::min(i, pt)][std::max(i, pt)]);
+				maxWeight = std::max(maxWeight, (*this->distMatrix)(i, pt));
 			}
 
 			if (maxWeight <= this->maxEpsilon)
@@ -192,12 +336,12 @@ std::vector<nodeType *> simplexArrayList<nodeType>::getAllCofacets(std::shared_p
 					x->simplex.insert(i);
 				}
 				x->weight = maxWeight;
-				x->hash = index + bin.binom(i, k);
+				x->hash = index + bin.binomial<simplexKey>(i, k);
 				ret.push_back(x);
 
 				if (checkEmergent && maxWeight == simp->weight)
 				{
-					if (pivotPairs.find(index + bin.binom(i, k)) == pivotPairs.end())
+					if (pivotPairs.find(index + bin.binomial<simplexKey>(i, k)) == pivotPairs.end())
 						return ret;
 					checkEmergent = false;
 				}
@@ -217,9 +361,9 @@ std::vector<nodeType *> simplexArrayList<nodeType>::getAllFacets(nodeType *simp,
 	if (recordVertices)
 		vertices = simp->simplex;
 	else
-		vertices = getVertices(simp->hash, dim + 1, this->simplexList[0].size());
+		vertices = getVertices((simplexKey)simp->hash, dim + 1, this->simplexList[0].size());
 
-	long long index = simp->hash;
+	simplexKey index = simp->hash;
 	unsigned k = vertices.size();
 
 	for (auto it = vertices.rbegin(); it != vertices.rend(); ++it)
@@ -235,7 +379,7 @@ std::vector<nodeType *> simplexArrayList<nodeType>::getAllFacets(nodeType *simp,
 			{
 				if (*it2 == pt)
 					continue;
-				maxWeight = std::max(maxWeight, (*this->distMatrix)[*it][*it2]);
+				maxWeight = std::max(maxWeight, this->getDistance(*it, *it2));
 			}
 		}
 
@@ -248,9 +392,9 @@ std::vector<nodeType *> simplexArrayList<nodeType>::getAllFacets(nodeType *simp,
 			x->simplex.erase(x->simplex.find(pt));
 		}
 
-		index -= bin.binom(pt, k);
+		index -= bin.binomial<simplexKey>(pt, k);
 		x->hash = index;
-		index += bin.binom(pt, --k);
+		index += bin.binomial<simplexKey>(pt, --k);
 
 		ret.push_back(x);
 	}
@@ -269,22 +413,22 @@ std::vector<std::shared_ptr<nodeType>> simplexArrayList<nodeType>::getAllFacets(
 {
 	std::vector<std::shared_ptr<nodeType>> ret;
 
-	long long index = simp->hash;
+	simplexKey index = simp->hash;
 	unsigned k = simp->simplex.size();
 
 	for (auto it = simp->simplex.rbegin(); it != simp->simplex.rend(); ++it)
 	{
 		unsigned pt = *it;
 
-		index -= bin.binom(pt, k);
+		index -= bin.binomial<simplexKey>(pt, k);
 
-		auto tempNode = indexConverter.find(index);
-		if (tempNode != indexConverter.end())
+		const std::shared_ptr<nodeType> *tempNode = findIndexed(index);
+		if (tempNode != nullptr)
 		{ // If this is a valid simplex, add it to the heap
-			ret.push_back(tempNode->second);
+			ret.push_back(*tempNode);
 		}
 
-		index += bin.binom(pt, --k);
+		index += bin.binomial<simplexKey>(pt, --k);
 	}
 
 	return ret;
@@ -297,13 +441,15 @@ double simplexArrayList<nodeType>::getSize()
 	size_t size = 0;
 
 	// Calculate size of edges
-	for (int i = 0; i < this->simplexList.size(); i++)
+	for (size_t i = 0; i < this->simplexList.size(); i++)
 	{
 
 		// Size is the ([# weighted graph entries] x [std::pair size]) + ([dimension of graph] * [vector entry size])
 		size += (this->simplexList[i].size() * sizeof((*this->simplexList[i].begin())));
 	}
 
+	size += adjacency.getSize();
+
 	return size;
 }
 
@@ -321,41 +467,77 @@ void simplexArrayList<nodeType>::insert()
 
 	std::shared_ptr<nodeType> insNode = std::make_shared<nodeType>(nodeType({i}, 0.0));
 	insNode->hash = i;
+
+	// Keep the vertex lookup current instead of rebuilding it after every insertion
+	bool tracked = !lookup.empty() && lookup[0].version == this->simplexList[0].getVersion();
 	this->simplexList[0].insert(insNode);
+	if (tracked)
+	{
+		lookup[0].simplices.emplace(i, insNode);
+		lookup[0].version = this->simplexList[0].getVersion();
+	}
 }
 
-// Search function to find a specific vector in the simplexArrayList
-// weightedGraph[d][v][p] dimension d stores vectors v of point elements p of simplexes formed
+// Bring the hash lookup of a dimension up to date with simplexList
 template <typename nodeType>
-bool simplexArrayList<nodeType>::find(std::set<unsigned> vector)
+void simplexArrayList<nodeType>::syncLookup(unsigned dim)
 {
-	if (this->simplexList.size() == 0)
-		return false;
-
-	for (auto simplexSetIter = this->simplexList[vector.size() - 1].begin(); simplexSetIter != this->simplexList[vector.size() - 1].end(); simplexSetIter++)
+	if (lookup.size() <= dim)
+		lookup.resize(dim + 1);
+
+	auto &dimList = this->simplexList[dim];
+	dimList.seal();
+	if (lookup[dim].version == dimList.getVersion())
+		return;
+
+	auto &simplices = lookup[dim].simplices;
+	simplices.clear();
+	simplices.reserve(dimList.size());
+	for (auto &simplex : dimList)
 	{
-		if ((*simplexSetIter)->simplex == vector)
-		{
-			return true;
-		}
+		if (simplex->hash >= 0)
+			simplices.emplace(simplex->hash, simplex);
+		else if (bin.covers(*simplex->simplex.rbegin(), simplex->simplex.size()))
+			simplices.emplace(simplexHash(simplex->simplex), simplex);
 	}
-	return false;
+	lookup[dim].version = dimList.getVersion();
+}
+
+// Stored node of a simplex, or nullptr; O(1) through the combinatorial hash of the simplex
+template <typename nodeType>
+const typename simplexArrayList<nodeType>::templateNode_P *simplexArrayList<nodeType>::lookupSimplex(const std::set<unsigned> &simplex)
+{
+	if (simplex.empty() || simplex.size() > this->simplexList.size())
+		return nullptr;
+
+	// A vertex is its own hash; larger simplices need the binomial table to reach their vertices
+	simplexKey key;
+	if (simplex.size() == 1)
+		key = *simplex.begin();
+	else if (bin.covers(*simplex.rbegin(), simplex.size()))
+		key = simplexHash(simplex);
+	else
+		return nullptr;
+
+	syncLookup(simplex.size() - 1);
+	auto &simplices = lookup[simplex.size() - 1].simplices;
+	auto it = simplices.find(key);
+	return (it != simplices.end() && it->second->simplex == simplex) ? &it->second : nullptr;
 }
 
 // Search function to find a specific vector in the simplexArrayList
-// weightedGraph[d][v][p] dimension d stores vectors v of point elements p of simplexes formed
+template <typename nodeType>
+bool simplexArrayList<nodeType>::find(std::set<unsigned> vector)
+{
+	return lookupSimplex(vector) != nullptr;
+}
+
+// Weight of a simplex in the simplexArrayList, or -1 if it is not stored
 template <typename nodeType>
 double simplexArrayList<nodeType>::findWeight(std::set<unsigned> vector)
 {
-	// Search the weighted graph from the size of the vector
-	for (auto simplexSetIter = this->simplexList[vector.size() - 1].begin(); simplexSetIter != this->simplexList[vector.size() - 1].end(); simplexSetIter++)
-	{
-		if ((*simplexSetIter)->simplex == vector)
-		{
-			return (*simplexSetIter)->weight;
-		}
-	}
-	return -1;
+	const templateNode_P *simplex = lookupSimplex(vector);
+	return simplex != nullptr ? (*simplex)->weight : -1;
 }
 
 // Output the total simplices stored in the simplical complex
@@ -364,7 +546,7 @@ int simplexArrayList<nodeType>::simplexCount()
 {
 	int simplexRet = 0;
 
-	for (auto a : this->simplexList)
+	for (auto &a : this->simplexList)
 	{
 		simplexRet += a.size();
 	}
@@ -385,20 +567,47 @@ template <typename nodeType>
 void simplexArrayList<nodeType>::initBinom()
 {
 	bin = binomialTable(this->simplexList[0].size(), this->maxDimension + 1);
+	if (bin.isWide() && std::is_same_v<nodeHash, long long>) // Hashes would be truncated -> use wideSimplexNode (see wideKeys)
+		throw std::overflow_error("Simplex hashes exceed 64 bits; run with wide node keys");
+}
+
+// Mark the vertex pairs within maxEpsilon in the adjacency rows for the dense expansion
+//		Rebuilt only when the distance matrix was set again or maxEpsilon or the vertex count changed since the last expansion
+template <typename nodeType>
+void simplexArrayList<nodeType>::buildAdjacency()
+{
+	const size_t n = this->simplexList.empty() ? 0 : this->simplexList[0].size();
+	if (adjacencyVersion == this->distMatrixVersion && adjacencyEpsilon == this->maxEpsilon && adjacency.size() == n)
+		return;
+
+	adjacency.resize(n);
+#pragma omp parallel for schedule(dynamic, 64)
+	for (size_t i = 0; i < n; i++)
+		for (size_t j = i + 1; j < n; j++)
+			if ((*this->distMatrix)(i, j) <= this->maxEpsilon)
+				adjacency.set(i, j);
+
+	adjacencyVersion = this->distMatrixVersion;
+	adjacencyEpsilon = this->maxEpsilon;
 }
 
 // Expand the simplexArrayList to incorporate higher-level simplices
 //	-> O(dnk) -> where n is the number of points, d is the dimension, and k is the number of d-1 simplices
 //
 //	Do this by comparing each simplex with points to insert
+//		Dimensions that are already built (e.g. edges kept by reduceComplex) are left as they are
 //
 template <typename nodeType>
 void simplexArrayList<nodeType>::expandDimensions(int dim)
 {
 	initBinom();
 
+	const bool incidence = this->complexType == "alphaComplex";
+	if (this->neighGraph == nullptr)
+		buildAdjacency();
+
 	// Iterate up to max dimension of simplex, starting at dim 2 (edges)
-	for (unsigned d = 1; d <= dim; d++)
+	for (unsigned d = std::max<size_t>(this->simplexList.size(), 1); d <= static_cast<unsigned>(dim); d++)
 	{
 
 		// Check if we need to break from expanding dimensions (no more edges)
@@ -407,153 +616,584 @@ void simplexArrayList<nodeType>::expandDimensions(int dim)
 		if (this->simplexList.size() == d)
 			this->simplexList.push_back({});
 
-		// Iterate through each element in the current dimension's edges
-		for (auto it = this->simplexList[d - 1].begin(); it != this->simplexList[d - 1].end(); it++)
-		{
-			// Iterate over points to possibly add to the simplex
-			// Use points larger than the maximal vertex in the simplex to prevent double counting
-			unsigned minPt = *(*it)->simplex.rbegin() + 1;
+		// Expand each (d-1)-simplex independently across threads
+		const auto &prev = this->simplexList[d - 1];
+		prev.seal();
 
-			for (unsigned pt = minPt; pt < this->simplexList[0].size(); pt++)
+		auto next = parallelExpand(
+			prev.size(), [&](size_t j, std::vector<expansion> &found)
 			{
-				// Compute the weight using all edges
-				double maxWeight = (*it)->weight;
-				for (auto i : (*it)->simplex)
-					maxWeight = std::max(maxWeight, (*this->distMatrix)[i][pt]);
+				const std::shared_ptr<nodeType> &simp = prev[j];
 
-				//***************************For beta complex valid simplex Condition ****************************
-				bool valid = true;
-				if (this->complexType == "alphaComplex")
-				{
-					for (auto i : (*it)->simplex)
-						if (!(*this->incidenceMatrix)[i][pt])
-						{
-							valid = false;
-							break;
-						}
-					if (valid && maxWeight <= this->maxEpsilon)
+				// Iterate over points to possibly add to the simplex
+				// Use points larger than the maximal vertex in the simplex to prevent double counting
+				unsigned minPt = *simp->simplex.rbegin() + 1;
+
+				if (this->neighGraph != nullptr)
+				{ // Sparse graph -> only common neighbors of every vertex can extend the simplex, before any vertex leaves the filtration
+					const double death = this->neighGraph->death(simp->simplex);
+					for (auto [pt, edgeWeight] : this->neighGraph->commonNeighbors(simp->simplex, minPt))
 					{
-						std::shared_ptr<nodeType> tot = std::make_shared<nodeType>(nodeType((*it)->simplex, maxWeight));
-						tot->simplex.insert(pt);
-						tot->hash = (*it)->hash + bin.binom(pt, tot->simplex.size());
-						this->simplexList[d].insert(tot);
+						//***************************For beta complex valid simplex Condition ****************************
+						if (incidence && std::any_of(simp->simplex.begin(), simp->simplex.end(), [&](unsigned i)
+													 { return !this->incidenceMatrix->test(i, pt); }))
+							continue;
+						//************************************************************************************************
+						double maxWeight = std::max(simp->weight, edgeWeight);
+						if (maxWeight <= this->maxEpsilon && maxWeight <= std::min(death, this->neighGraph->death(pt))) // Valid simplex
+							found.push_back({j, pt, maxWeight});
 					}
-					//************************************************************************************************
-				}
-				else if (maxWeight <= this->maxEpsilon)
-				{ // Valid simplex
-					std::shared_ptr<nodeType> tot = std::make_shared<nodeType>(nodeType((*it)->simplex, maxWeight));
-					tot->simplex.insert(pt);
-					tot->hash = (*it)->hash + bin.binom(pt, tot->simplex.size());
-					this->simplexList[d].insert(tot);
+					return;
 				}
-			}
-		}
+
+				// Dense -> the candidates are the points within maxEpsilon of every vertex (and incident to each for the beta complex)
+				adjacency.forEachCommon(simp->simplex, minPt, [&](size_t pt)
+				{
+					// Compute the weight using all edges
+					double maxWeight = simp->weight;
+					for (auto i : simp->simplex)
+						maxWeight = std::max(maxWeight, (*this->distMatrix)(i, pt));
+
+					if (maxWeight <= this->maxEpsilon) // Valid simplex
+						found.push_back({j, (unsigned)pt, maxWeight});
+				}, incidence ? this->incidenceMatrix : nullptr);
+			},
+			[&](const expansion &e, nodeType &node)
+			{
+				node = nodeType(prev[e.parent]->simplex, e.weight);
+				node.simplex.insert(e.pt);
+				node.hash = prev[e.parent]->hash + bin.binomial<simplexKey>(e.pt, node.simplex.size());
+			});
+
+		this->simplexList[d].insert(next.begin(), next.end());
+
+		// Sort the new dimension once now that all of its simplices are in
+		this->simplexList[d].seal();
 	}
-	std::ofstream out("incedenceMatrix2DBeta0.9.csv");
 	int di = 0;
-	for (auto x : this->simplexList)
+	for (auto &x : this->simplexList)
 		std::cout << "Count of " << di++ << "-simplex ::" << x.size() << "\n";
+}
 
-	std::vector<std::vector<unsigned>> edges(this->simplexList[0].size(), std::vector<unsigned>(this->simplexList[0].size(), 0));
-	for (auto x : this->simplexList[1])
+// Collapse the dominated edges of the Rips 1-skeleton (see edgeCollapser)
+//		The remaining edges, some delayed to a later weight, become the neighborhood graph the higher dimensions are expanded from
+template <typename nodeType>
+void simplexArrayList<nodeType>::reduceComplex()
+{
+	if (this->simplexList.size() < 2)
 	{
-		std::vector<unsigned> edge;
-		for (auto y : x->simplex)
-			edge.push_back(y);
-		edges[edge[0]][edge[1]] = 1;
+		this->ut.writeLog(this->simplexType, "Edges have not been built, skipping reduction");
+		return;
 	}
 
-	for (auto row : edges)
+	std::vector<neighborGraph::edge> edges;
+	edges.reserve(this->simplexList[1].size());
+	for (auto &simp : this->simplexList[1])
+		edges.push_back({*simp->simplex.begin(), *simp->simplex.rbegin(), simp->weight});
+
+	edges = edgeCollapser::collapse(this->simplexList[0].size(), edges);
+	collapsedGraph.build(this->simplexList[0].size(), edges);
+	this->neighGraph = &collapsedGraph;
+
+	// Replace the edges (and anything built above them) with the collapsed 1-skeleton
+	this->simplexList.resize(2);
+	this->simplexList[1].clear();
+	for (auto &e : edges)
 	{
-		for (auto col : row)
-			out << col << ' ';
-		out << '\n';
+		std::shared_ptr<nodeType> tot = std::make_shared<nodeType>(nodeType({e.u, e.v}, e.weight));
+		tot->hash = bin.binomial<simplexKey>(e.u, 1) + bin.binomial<simplexKey>(e.v, 2);
+		this->simplexList[1].insert(tot);
 	}
+	this->simplexList[1].seal();
 }
 
 template <typename nodeType>
 std::vector<std::shared_ptr<nodeType>> simplexArrayList<nodeType>::expandDimension(std::vector<std::shared_ptr<nodeType>> edges, bool recordVertices, unsigned dim)
 {
-	std::vector<std::shared_ptr<nodeType>> nextEdges;
-	// Iterate through each element in the current dimension's edges
-	for (auto it = edges.begin(); it != edges.end(); it++)
-	{
-		std::set<unsigned> vertices;
+	if (edges.empty())
+		return {};
 
-		if (recordVertices)
-			vertices = (*it)->simplex;
-		else
-			vertices = getVertices((*it)->hash, dim - 1, this->simplexList[0].size());
+	// Vertices in each edge
+	unsigned k = recordVertices ? edges[0]->simplex.size() : dim;
 
-		// Iterate over points to possibly add to the simplex
-		// Use points larger than the maximal vertex in the simplex to prevent double counting
-		unsigned minPt = *vertices.rbegin() + 1;
+	const bool incidence = this->complexType == "alphaComplex";
+	if (this->neighGraph == nullptr && !incidence)
+		buildAdjacency();
 
-		for (unsigned pt = minPt; pt < this->simplexList[0].size(); pt++)
+	std::vector<std::shared_ptr<nodeType>> nextEdges = parallelExpand(
+		edges.size(), [&](size_t j, std::vector<expansion> &found)
 		{
-			// Compute the weight using all edges
-			double maxWeight = (*it)->weight;
-			for (auto i : vertices)
-				maxWeight = std::max(maxWeight, (*this->distMatrix)[i][pt]);
-
-			//***************************For beta complex valid simplex Condition ****************************
-			bool valid = true;
-			if (this->complexType == "alphaComplex")
+			const std::shared_ptr<nodeType> &simp = edges[j];
+			std::set<unsigned> vertices;
+
+			if (recordVertices)
+				vertices = simp->simplex;
+			else
+				vertices = getVertices((simplexKey)simp->hash, dim - 1, this->simplexList[0].size());
+
+			auto tryInsert = [&](unsigned pt, double maxWeight)
 			{
-				for (auto i : vertices)
-					if (!(*this->incidenceMatrix)[i][pt])
-					{
-						valid = false;
-						break;
-					}
-				if (valid)
+				//***************************For beta complex valid simplex Condition ****************************
+				if (incidence)
 				{
-					std::shared_ptr<nodeType> tot = std::make_shared<nodeType>(nodeType());
-					if (recordVertices)
-					{
-						tot->simplex = vertices;
-						tot->simplex.insert(pt);
-					}
-					tot->weight = maxWeight;
-					tot->hash = (*it)->hash + bin.binom(pt, (recordVertices ? tot->simplex.size() : dim + 1));
-					nextEdges.push_back(tot);
+					for (auto i : vertices)
+						if (!this->incidenceMatrix->test(i, pt))
+							return;
 				}
 				//************************************************************************************************
+				else if (maxWeight > this->maxEpsilon)
+					return;
+
+				// Valid simplex
+				found.push_back({j, pt, maxWeight});
+			};
+
+			// Iterate over points to possibly add to the simplex
+			// Use points larger than the maximal vertex in the simplex to prevent double counting
+			unsigned minPt = *vertices.rbegin() + 1;
+
+			if (this->neighGraph != nullptr)
+			{ // Sparse graph -> only common neighbors of every vertex can extend the simplex, before any vertex leaves the filtration
+				const double death = this->neighGraph->death(vertices);
+				for (auto [pt, edgeWeight] : this->neighGraph->commonNeighbors(vertices, minPt))
+					if (std::max(simp->weight, edgeWeight) <= std::min(death, this->neighGraph->death(pt)))
+						tryInsert(pt, std::max(simp->weight, edgeWeight));
+				return;
 			}
-			else if (maxWeight <= this->maxEpsilon)
-			{ // Valid simplex
-				std::shared_ptr<nodeType> tot = std::make_shared<nodeType>(nodeType());
-				if (recordVertices)
+
+			// Dense -> the candidates are the points incident to every vertex for the beta complex, within maxEpsilon of every vertex otherwise
+			(incidence ? *this->incidenceMatrix : adjacency).forEachCommon(vertices, minPt, [&](size_t pt)
+			{
+				// Compute the weight using all edges
+				double maxWeight = simp->weight;
+				for (auto i : vertices)
+					maxWeight = std::max(maxWeight, (*this->distMatrix)(i, pt));
+
+				if (incidence || maxWeight <= this->maxEpsilon) // Valid simplex
+					found.push_back({j, (unsigned)pt, maxWeight});
+			});
+		},
+		[&](const expansion &e, nodeType &node)
+		{
+			if (recordVertices)
+			{
+				node.simplex = edges[e.parent]->simplex;
+				node.simplex.insert(e.pt);
+			}
+			node.weight = e.weight;
+			node.hash = edges[e.parent]->hash + bin.binomial<simplexKey>(e.pt, k + 1);
+		});
+
+	if (recordVertices)
+		std::sort(nextEdges.begin(), nextEdges.end(), cmpByWeight<std::shared_ptr<nodeType>>());
+	return nextEdges;
+}
+
+template <typename nodeType>
+template <typename index>
+std::vector<typename simplexArrayList<nodeType>::template implicitNode<index>> simplexArrayList<nodeType>::getAllCofacets(const implicitNode<index> &simp, unsigned dim, const std::unordered_map<index, index, indexHash> &pivotPairs, bool checkEmergent)
+{
+	// Method builds out cofacets of an implicit simplex for fastPersistence; diameters are read from the distances on demand
+	std::vector<implicitNode<index>> ret;
+	std::set<unsigned> vertices = getVertices(simp.second, dim, this->simplexList[0].size());
+
+	unsigned k = vertices.size() + 1;
+	auto it = vertices.rbegin();
+	index simplexIndex = simp.second;
+
+	// Record the cofacet formed by inserting vertex i; returns true when an emergent pair ends the enumeration
+	auto addCofacet = [&](unsigned i, double maxWeight)
+	{
+		if (maxWeight > this->maxEpsilon)
+			return false;
+
+		ret.push_back({maxWeight, simplexIndex + bin.binomial<index>(i, k)});
+
+		if (checkEmergent && maxWeight == simp.first)
+		{
+			if (pivotPairs.find(ret.back().second) == pivotPairs.end())
+				return true;
+			checkEmergent = false;
+		}
+		return false;
+	};
+
+	if (this->neighGraph != nullptr)
+	{ // Sparse graph -> only common neighbors of every vertex can form a cofacet; visit them in the same (descending) order
+		auto candidates = this->neighGraph->commonNeighbors(vertices);
+		const double death = this->neighGraph->death(vertices);
+		for (auto cand = candidates.rbegin(); cand != candidates.rend(); ++cand)
+		{
+			unsigned i = cand->first;
+			for (; it != vertices.rend() && *it > i; ++it, --k)
+			{ // Passed vertex *it of the simplex -> it is now the kth largest vertex instead of the (k-1)th
+				simplexIndex -= bin.binomial<index>(*it, k - 1);
+				simplexIndex += bin.binomial<index>(*it, k);
+			}
+
+			double maxWeight = std::max(simp.first, cand->second);
+			if (maxWeight > std::min(death, this->neighGraph->death(i))) // A vertex has left the (sparse) filtration
+				continue;
+			if (addCofacet(i, maxWeight))
+				break;
+		}
+		return ret;
+	}
+
+	// Try inserting other vertices into the simplex
+	for (unsigned i = this->simplexList[0].size(); i-- != 0;)
+	{
+		if (it != vertices.rend() && i == *it)
+		{ // Vertex i is already in the simplex -> i is now the kth largest vertex in the simplex instead of the (k-1)th
+			simplexIndex -= bin.binomial<index>(i, k - 1);
+			simplexIndex += bin.binomial<index>(i, k);
+			--k;
+			++it;
+		}
+		else
+		{
+			double maxWeight = simp.first;
+			for (auto pt : vertices)
+				maxWeight = std::max(maxWeight, (*this->distMatrix)(i, pt));
+
+			if (addCofacet(i, maxWeight))
+				break;
+		}
+	}
+
+	return ret;
+}
+
+template <typename nodeType>
+template <typename index>
+std::vector<typename simplexArrayList<nodeType>::template implicitNode<index>> simplexArrayList<nodeType>::expandDimension(const std::vector<implicitNode<index>> &simplices, unsigned dim)
+{
+	// Build the implicit dim-simplices from the implicit (dim-1)-simplices; only (diameter, index) pairs are stored
+	//		Each thread expands its share of the simplices into its own buffer; the buffers are joined at the end
+	std::vector<std::vector<implicitNode<index>>> found(omp_get_max_threads());
+	if (this->neighGraph == nullptr)
+		buildAdjacency();
+
+#pragma omp parallel
+	{
+		std::vector<implicitNode<index>> &local = found[omp_get_thread_num()];
+
+#pragma omp for schedule(dynamic, 64)
+		for (size_t j = 0; j < simplices.size(); j++)
+		{
+			const implicitNode<index> &simp = simplices[j];
+			std::set<unsigned> vertices = getVertices(simp.second, dim - 1, this->simplexList[0].size());
+
+			// Use points larger than the maximal vertex in the simplex to prevent double counting
+			unsigned minPt = *vertices.rbegin() + 1;
+
+			if (this->neighGraph != nullptr)
+			{ // Sparse graph -> only common neighbors of every vertex can extend the simplex, before any vertex leaves the filtration
+				const double death = this->neighGraph->death(vertices);
+				for (auto [pt, edgeWeight] : this->neighGraph->commonNeighbors(vertices, minPt))
 				{
-					tot->simplex = vertices;
-					tot->simplex.insert(pt);
+					double maxWeight = std::max(simp.first, edgeWeight);
+					if (maxWeight <= this->maxEpsilon && maxWeight <= std::min(death, this->neighGraph->death(pt)))
+						local.push_back({maxWeight, simp.second + bin.binomial<index>(pt, dim + 1)});
 				}
-				tot->weight = maxWeight;
-				tot->hash = (*it)->hash + bin.binom(pt, (recordVertices ? tot->simplex.size() : dim + 1));
-				nextEdges.push_back(tot);
+				continue;
 			}
+
+			// Dense -> the candidates are the points within maxEpsilon of every vertex
+			adjacency.forEachCommon(vertices, minPt, [&](size_t pt)
+			{
+				double maxWeight = simp.first;
+				for (auto i : vertices)
+					maxWeight = std::max(maxWeight, (*this->distMatrix)(i, pt));
+
+				if (maxWeight <= this->maxEpsilon)
+					local.push_back({maxWeight, simp.second + bin.binomial<index>((unsigned)pt, dim + 1)});
+			});
 		}
 	}
 
-	if (recordVertices)
-		std::sort(nextEdges.begin(), nextEdges.end(), cmpByWeight<std::shared_ptr<nodeType>>());
-	return nextEdges;
+	std::vector<implicitNode<index>> nextSimplices;
+	size_t total = 0;
+	for (auto &local : found)
+		total += local.size();
+	nextSimplices.reserve(total);
+	for (auto &local : found)
+		nextSimplices.insert(nextSimplices.end(), local.begin(), local.end());
+
+	return nextSimplices;
 }
 
+// Copy the nodes of one dimension into a flat array in the arena
 template <typename nodeType>
-bool simplexArrayList<nodeType>::deletion(std::set<unsigned> vector)
+template <unsigned maxVertices>
+typename simplexArrayList<nodeType>::template flatDimension<maxVertices> simplexArrayList<nodeType>::flatten(const std::vector<std::shared_ptr<nodeType>> &simplices)
+{
+	flatDimension<maxVertices> flat = this->template arenaArray<flatRecord<maxVertices>>(simplices.size());
+	for (size_t i = 0; i < simplices.size(); i++)
+	{
+		std::array<unsigned, maxVertices> vertices{};
+		std::copy(simplices[i]->simplex.begin(), simplices[i]->simplex.end(), vertices.begin());
+		std::construct_at(&flat[i], flatRecord<maxVertices>{simplices[i]->weight, simplices[i]->hash, vertices});
+	}
+	return flat;
+}
+
+// Build the flat dim-simplices from the flat (dim-1)-simplices as one array in the arena
+//		The expansions of every thread are counted before the array is carved, so each dimension is a single allocation
+template <typename nodeType>
+template <unsigned maxVertices>
+typename simplexArrayList<nodeType>::template flatDimension<maxVertices> simplexArrayList<nodeType>::expandFlat(flatDimension<maxVertices> simplices, unsigned dim)
+{
+	flatDimension<maxVertices> next;
+	std::vector<std::vector<std::pair<unsigned, double>>> candidates(omp_get_max_threads());
+	if (this->neighGraph == nullptr)
+		buildAdjacency();
+
+	parallelExpand(
+		simplices.size(), [&](size_t j, std::vector<expansion> &found)
+		{
+			const flatRecord<maxVertices> &simp = simplices[j];
+			std::span<const unsigned> vertices(simp.vertices.data(), dim);
+
+			// Use points larger than the maximal vertex in the simplex to prevent double counting
+			unsigned minPt = vertices.back() + 1;
+
+			if (this->neighGraph != nullptr)
+			{ // Sparse graph -> only common neighbors of every vertex can extend the simplex, before any vertex leaves the filtration
+				auto &local = candidates[omp_get_thread_num()];
+				this->neighGraph->commonNeighbors(vertices, minPt, local);
+				const double death = this->neighGraph->death(vertices);
+				for (auto [pt, edgeWeight] : local)
+				{
+					double maxWeight = std::max(simp.weight, edgeWeight);
+					if (maxWeight <= this->maxEpsilon && maxWeight <= std::min(death, this->neighGraph->death(pt)))
+						found.push_back({j, pt, maxWeight});
+				}
+				return;
+			}
+
+			// Dense -> the candidates are the points within maxEpsilon of every vertex
+			adjacency.forEachCommon(vertices, minPt, [&](size_t pt)
+			{
+				double maxWeight = simp.weight;
+				for (auto i : vertices)
+					maxWeight = std::max(maxWeight, (*this->distMatrix)(i, pt));
+
+				if (maxWeight <= this->maxEpsilon)
+					found.push_back({j, (unsigned)pt, maxWeight});
+			});
+		},
+		[&](size_t total)
+		{ next = this->template arenaArray<flatRecord<maxVertices>>(total); },
+		[&](size_t i, const expansion &e)
+		{
+			const flatRecord<maxVertices> &parent = simplices[e.parent];
+			std::construct_at(&next[i], flatRecord<maxVertices>{e.weight, (nodeHash)((simplexKey)parent.hash + bin.binomial<simplexKey>(e.pt, dim + 1)), parent.vertices});
+			next[i].vertices[dim] = e.pt;
+		});
+
+	return next;
+}
+
+// Index a flat dimension by hash for findFlat and the flat cofacet lookup
+template <typename nodeType>
+template <unsigned maxVertices>
+void simplexArrayList<nodeType>::prepareFlat(flatDimension<maxVertices> simplices)
+{
+	flatIndexed = simplices.data();
+	indexConverter.build(simplices.size(), [&](size_t i)
+						 { return (simplexKey)simplices[i].hash; });
+}
+
+// Record of the flat dimension indexed by prepareFlat with the given hash, or nullptr
+template <typename nodeType>
+template <unsigned maxVertices>
+typename simplexArrayList<nodeType>::template flatRecord<maxVertices> *simplexArrayList<nodeType>::findFlat(simplexKey hash) const
+{
+	size_t pos = indexConverter.find(hash);
+	return (pos == simplexIndex::npos) ? nullptr : static_cast<flatRecord<maxVertices> *>(flatIndexed) + pos;
+}
+
+// Visit the cofacets of a flat dim-simplex as f(i, hash, weight), in descending order of the inserted vertex i; f returns true to stop
+//		weight is the longest edge of the cofacet when weighted is set (read from the sparse graph or the distances), the simplex weight
+//		otherwise for the dense lookups that take the weight from the stored cofacet
+template <typename nodeType>
+template <unsigned maxVertices, bool weighted, typename F>
+void simplexArrayList<nodeType>::forEachCofacet(const flatRecord<maxVertices> &simp, unsigned dim, F &&f)
 {
-	// Search the weighted graph from the size of the vector
-	for (auto simplexSetIter = this->simplexList[vector.size() - 1].begin(); simplexSetIter != this->simplexList[vector.size() - 1].end(); simplexSetIter++)
+	std::span<const unsigned> vertices(simp.vertices.data(), dim + 1);
+	unsigned k = dim + 2;
+	int next = dim; // Largest vertex of the simplex above the inserted vertices so far
+	simplexKey index = simp.hash;
+
+	// Vertices of the simplex above i -> each is now the kth largest vertex of the cofacet instead of the (k-1)th
+	auto pass = [&](unsigned i)
 	{
-		if ((*simplexSetIter)->simplex == vector)
+		for (; next >= 0 && vertices[next] > i; --next, --k)
 		{
-			this->simplexList[vector.size() - 1].erase(simplexSetIter);
-			return true;
+			index -= bin.binomial<simplexKey>(vertices[next], k - 1);
+			index += bin.binomial<simplexKey>(vertices[next], k);
 		}
+	};
+
+	if (this->neighGraph != nullptr)
+	{ // Sparse graph -> only common neighbors of every vertex can form a cofacet; visit them in the same (descending) order
+		//	Cofacets heavier than the death of one of their vertices are not in the (sparse) filtration and are skipped
+		this->neighGraph->commonNeighbors(vertices, 0, flatCandidates);
+		const double death = this->neighGraph->death(vertices);
+		for (auto cand = flatCandidates.rbegin(); cand != flatCandidates.rend(); ++cand)
+		{
+			pass(cand->first);
+			double maxWeight = std::max(simp.weight, cand->second);
+			if (maxWeight > std::min(death, this->neighGraph->death(cand->first)))
+				continue;
+			if (f(cand->first, index + bin.binomial<simplexKey>(cand->first, k), maxWeight))
+				return;
+		}
+		return;
 	}
-	return false;
+
+	// Try inserting other vertices into the simplex
+	for (unsigned i = this->simplexList[0].size(); i-- != 0;)
+	{
+		pass(i);
+		if (next >= 0 && vertices[next] == i) // Vertex i is already in the simplex
+			continue;
+
+		double maxWeight = simp.weight;
+		if constexpr (weighted)
+			for (auto pt : vertices)
+				maxWeight = std::max(maxWeight, (*this->distMatrix)(i, pt));
+
+		if (f(i, index + bin.binomial<simplexKey>(i, k), maxWeight))
+			return;
+	}
+}
+
+// Visit the facets of a flat dim-simplex as f(pos, hash), removing the vertex at pos from the largest down
+template <typename nodeType>
+template <unsigned maxVertices, typename F>
+void simplexArrayList<nodeType>::forEachFacet(const flatRecord<maxVertices> &simp, unsigned dim, F &&f)
+{
+	simplexKey index = simp.hash;
+
+	for (unsigned k = dim + 1; k-- != 0;)
+	{
+		unsigned pt = simp.vertices[k];
+
+		index -= bin.binomial<simplexKey>(pt, k + 1);
+		f(k, index);
+		index += bin.binomial<simplexKey>(pt, k);
+	}
+}
+
+// Cofacets of a flat simplex for fastPersistence, looked up in the dimension indexed by prepareFlat and appended to ret
+template <typename nodeType>
+template <unsigned maxVertices>
+void simplexArrayList<nodeType>::getAllCofacets(const flatRecord<maxVertices> &simp, unsigned dim, const std::unordered_map<flatRecord<maxVertices> *, flatRecord<maxVertices> *> &pivotPairs, bool checkEmergent, std::vector<flatRecord<maxVertices> *> &ret)
+{
+	forEachCofacet<maxVertices, false>(simp, dim, [&](unsigned, simplexKey hash, double)
+	{
+		flatRecord<maxVertices> *cofacet = findFlat<maxVertices>(hash);
+		if (cofacet == nullptr)
+			return false;
+		ret.push_back(cofacet);
+
+		// An emergent pair (the cofacet has the weight of the simplex and isn't a pivot) ends the enumeration
+		if (checkEmergent && cofacet->weight == simp.weight)
+		{
+			if (pivotPairs.find(cofacet) == pivotPairs.end())
+				return true;
+			checkEmergent = false;
+		}
+		return false;
+	});
+}
+
+// Cofacets of a flat simplex for incrementalPersistence, built as records in the scratch resource and appended to ret
+template <typename nodeType>
+template <unsigned maxVertices>
+void simplexArrayList<nodeType>::getAllCofacets(const flatRecord<maxVertices> &simp, unsigned dim, const std::unordered_map<simplexKey, flatRecord<maxVertices> *, indexHash> &pivotPairs, bool checkEmergent, std::pmr::memory_resource &scratch, std::vector<flatRecord<maxVertices> *> &ret)
+{
+	forEachCofacet<maxVertices, true>(simp, dim, [&](unsigned i, simplexKey hash, double maxWeight)
+	{
+		if (maxWeight > this->maxEpsilon)
+			return false;
+
+		// Insert vertex i into the sorted vertices of the simplex
+		std::array<unsigned, maxVertices> vertices = simp.vertices;
+		unsigned pos = std::upper_bound(vertices.begin(), vertices.begin() + dim + 1, i) - vertices.begin();
+		std::copy_backward(vertices.begin() + pos, vertices.begin() + dim + 1, vertices.begin() + dim + 2);
+		vertices[pos] = i;
+
+		auto *cofacet = static_cast<flatRecord<maxVertices> *>(scratch.allocate(sizeof(flatRecord<maxVertices>), alignof(flatRecord<maxVertices>)));
+		ret.push_back(std::construct_at(cofacet, flatRecord<maxVertices>{maxWeight, (nodeHash)hash, vertices}));
+
+		if (checkEmergent && maxWeight == simp.weight)
+		{
+			if (pivotPairs.find(hash) == pivotPairs.end())
+				return true;
+			checkEmergent = false;
+		}
+		return false;
+	});
+}
+
+// Facets of a flat simplex, looked up in the dimension indexed by prepareFlat and appended to ret
+template <typename nodeType>
+template <unsigned maxVertices>
+void simplexArrayList<nodeType>::getAllFacets(const flatRecord<maxVertices> &simp, unsigned dim, std::vector<flatRecord<maxVertices> *> &ret)
+{
+	forEachFacet(simp, dim, [&](unsigned, simplexKey hash)
+	{
+		flatRecord<maxVertices> *facet = findFlat<maxVertices>(hash);
+		if (facet != nullptr)
+			ret.push_back(facet);
+	});
+}
+
+// Facets of a flat simplex, built as records in the scratch resource and appended to ret
+template <typename nodeType>
+template <unsigned maxVertices>
+void simplexArrayList<nodeType>::getAllFacets(const flatRecord<maxVertices> &simp, unsigned dim, std::pmr::memory_resource &scratch, std::vector<flatRecord<maxVertices> *> &ret)
+{
+	forEachFacet(simp, dim, [&](unsigned pos, simplexKey hash)
+	{
+		// Remove the vertex at pos; the weight is the longest edge among the remaining vertices
+		std::array<unsigned, maxVertices> vertices{};
+		std::copy(simp.vertices.begin(), simp.vertices.begin() + pos, vertices.begin());
+		std::copy(simp.vertices.begin() + pos + 1, simp.vertices.begin() + dim + 1, vertices.begin() + pos);
+
+		double maxWeight = 0;
+		for (unsigned i = 0; i < dim; i++)
+			for (unsigned j = i + 1; j < dim; j++)
+				maxWeight = std::max(maxWeight, this->getDistance(vertices[i], vertices[j]));
+
+		auto *facet = static_cast<flatRecord<maxVertices> *>(scratch.allocate(sizeof(flatRecord<maxVertices>), alignof(flatRecord<maxVertices>)));
+		ret.push_back(std::construct_at(facet, flatRecord<maxVertices>{maxWeight, (nodeHash)hash, vertices}));
+	});
+}
+
+template <typename nodeType>
+bool simplexArrayList<nodeType>::deletion(std::set<unsigned> vector)
+{
+	const templateNode_P *simplex = lookupSimplex(vector);
+	if (simplex == nullptr)
+		return false;
+
+	// The filtration is sorted by (weight, hash), so a binary search lands on the simplex
+	unsigned dim = vector.size() - 1;
+	auto &dimList = this->simplexList[dim];
+	auto &simplices = lookup[dim].simplices;
+	auto it = dimList.find(*simplex);
+	if (it == dimList.end())
+		return false;
+
+	dimList.erase(it);
+	simplices.erase((*simplex)->hash >= 0 ? (simplexKey)(*simplex)->hash : simplexHash(vector));
+	lookup[dim].version = dimList.getVersion();
+
+	return true;
 }
 
 template <typename nodeType>
@@ -564,5 +1204,51 @@ simplexArrayList<nodeType>::~simplexArrayList()
 
 // Explicit Template Class Instantiation
 template class simplexArrayList<simplexNode>;
+template class simplexArrayList<wideSimplexNode>;
 template class simplexArrayList<alphaNode>;
 template class simplexArrayList<witnessNode>;
+
+// Implicit complexes are indexed with long long, or __int128 when the binomial table is wide
+#define INSTANTIATE_IMPLICIT(nodeType, index)                                                                                                                                                   \
+	template std::set<unsigned> simplexArrayList<nodeType>::getVertices<index>(index, int, unsigned);                                                                                             \
+	template std::vector<simplexArrayList<nodeType>::implicitNode<index>> simplexArrayList<nodeType>::getAllCofacets<index>(const implicitNode<index> &, unsigned, const std::unordered_map<index, index, indexHash> &, bool); \
+	template std::vector<simplexArrayList<nodeType>::implicitNode<index>> simplexArrayList<nodeType>::expandDimension<index>(const std::vector<implicitNode<index>> &, unsigned);
+
+INSTANTIATE_IMPLICIT(simplexNode, long long)
+INSTANTIATE_IMPLICIT(simplexNode, __int128)
+INSTANTIATE_IMPLICIT(wideSimplexNode, long long)
+INSTANTIATE_IMPLICIT(wideSimplexNode, __int128)
+INSTANTIATE_IMPLICIT(alphaNode, long long)
+INSTANTIATE_IMPLICIT(alphaNode, __int128)
+INSTANTIATE_IMPLICIT(witnessNode, long long)
+INSTANTIATE_IMPLICIT(witnessNode, __int128)
+#undef INSTANTIATE_IMPLICIT
+
+// Flat storage records hold dimensions + 1 vertices for --dimensions 1 ... flatMaxDimensions (see flatDispatch)
+#define INSTANTIATE_FLAT(nodeType, maxVertices)                                                                                                                                                                                                             \
+	template simplexArrayList<nodeType>::flatDimension<maxVertices> simplexArrayList<nodeType>::flatten<maxVertices>(const std::vector<std::shared_ptr<nodeType>> &);                                                                                   \
+	template simplexArrayList<nodeType>::flatDimension<maxVertices> simplexArrayList<nodeType>::expandFlat<maxVertices>(flatDimension<maxVertices>, unsigned);                                                                                       \
+	template void simplexArrayList<nodeType>::prepareFlat<maxVertices>(flatDimension<maxVertices>);                                                                                                                                                   \
+	template simplexArrayList<nodeType>::flatRecord<maxVertices> *simplexArrayList<nodeType>::findFlat<maxVertices>(simplexKey) const;                                                                                                             \
+	template void simplexArrayList<nodeType>::getAllCofacets<maxVertices>(const flatRecord<maxVertices> &, unsigned, const std::unordered_map<flatRecord<maxVertices> *, flatRecord<maxVertices> *> &, bool, std::vector<flatRecord<maxVertices> *> &); \
+	template void simplexArrayList<nodeType>::getAllCofacets<maxVertices>(const flatRecord<maxVertices> &, unsigned, const std::unordered_map<simplexKey, flatRecord<maxVertices> *, indexHash> &, bool, std::pmr::memory_resource &, std::vector<flatRecord<maxVertices> *> &); \
+	template void simplexArrayList<nodeType>::getAllFacets<maxVertices>(const flatRecord<maxVertices> &, unsigned, std::vector<flatRecord<maxVertices> *> &);                                                                                       \
+	template void simplexArrayList<nodeType>::getAllFacets<maxVertices>(const flatRecord<maxVertices> &, unsigned, std::pmr::memory_resource &, std::vector<flatRecord<maxVertices> *> &);
+
+INSTANTIATE_FLAT(simplexNode, 2)
+INSTANTIATE_FLAT(simplexNode, 3)
+INSTANTIATE_FLAT(simplexNode, 4)
+INSTANTIATE_FLAT(simplexNode, 5)
+INSTANTIATE_FLAT(wideSimplexNode, 2)
+INSTANTIATE_FLAT(wideSimplexNode, 3)
+INSTANTIATE_FLAT(wideSimplexNode, 4)
+INSTANTIATE_FLAT(wideSimplexNode, 5)
+INSTANTIATE_FLAT(alphaNode, 2)
+INSTANTIATE_FLAT(alphaNode, 3)
+INSTANTIATE_FLAT(alphaNode, 4)
+INSTANTIATE_FLAT(alphaNode, 5)
+INSTANTIATE_FLAT(witnessNode, 2)
+INSTANTIATE_FLAT(witnessNode, 3)
+INSTANTIATE_FLAT(witnessNode, 4)
+INSTANTIATE_FLAT(witnessNode, 5)
+#undef INSTANTIATE_FLAT
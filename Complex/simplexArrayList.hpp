@@ -1,18 +1,41 @@
 #pragma once
 #include "simplexBase.hpp"
+#include "simplexIndex.hpp"
+#include "edgeCollapser.hpp"
 #include <set>
 #include <unordered_map>
+#include <cstdint>
+#include <type_traits>
+#include <span>
+#include <memory_resource>
 
 // Header file for simplexTree class - see simplexTree.cpp for descriptions
 
+// Binomial coefficients C(n, k) for the combinatorial index of simplices
+//	The table is kept in long long, or in __int128 when C(n, k) outgrows 63 bits (large n and maxDimension)
 class binomialTable
 {
 private:
 	std::vector<std::vector<long long>> v;
+	std::vector<std::vector<__int128>> wide; // Built instead of v when the coefficients overflow long long
 
 public:
 	binomialTable(unsigned n, unsigned k);
 	long long binom(unsigned n, unsigned k);
+	bool isWide() const { return !wide.empty(); }
+	bool covers(unsigned n, unsigned k) const { return isWide() ? (n < wide.size() && k < wide[n].size()) : (n < v.size() && k < v[n].size()); }
+
+	// C(n, k) in the index type of a complex (long long or __int128; explicit complexes use simplexKey)
+	template <typename index>
+	index binomial(unsigned n, unsigned k)
+	{
+		if constexpr (std::is_same_v<index, long long>)
+			return binom(n, k);
+		else if (k > n)
+			return 0;
+		else
+			return isWide() ? wide[n][k] : v[n][k];
+	}
 };
 
 template <typename nodeType>
@@ -21,26 +44,110 @@ class simplexArrayList : public simplexBase<nodeType>
 
 	typedef std::shared_ptr<nodeType> templateNode_P;
 
+public:
+	// Implicit Vietoris-Rips simplex -> (diameter, combinatorial index); vertices are recovered from the index on demand
+	//		The index is a long long, or an __int128 once the binomial table is wide (see binomialTable)
+	template <typename index>
+	using implicitNode = std::pair<double, index>;
+
+	// Flat storage -> one dimension of the complex as an array of flatSimplex records in the arena (simplexBase::arena),
+	//		hashed with the key type of the nodes (binomialTable is only wide for wide keys, see initBinom)
+	typedef decltype(nodeType::hash) nodeHash;
+	template <unsigned maxVertices>
+	using flatRecord = flatSimplex<maxVertices, nodeHash>;
+	template <unsigned maxVertices>
+	using flatDimension = std::span<flatRecord<maxVertices>>;
+
 private:
-	std::unordered_map<long long, templateNode_P> indexConverter;
+	// Hash -> position in indexedSimplices, the dimension last indexed by prepareCofacets/prepareFacets
+	simplexIndex indexConverter;
+	const typename simplexBase<nodeType>::filtration *indexedSimplices = nullptr;
+
+	// Hash -> simplex of each dimension for find/findWeight/deletion; rebuilt when simplexList[d] changed behind it
+	struct simplexLookup
+	{
+		std::unordered_map<simplexKey, templateNode_P, indexHash> simplices;
+		size_t version = SIZE_MAX; // simplexFiltration version the lookup matches
+	};
+	std::vector<simplexLookup> lookup;
+
+	void syncLookup(unsigned);
+	const templateNode_P *lookupSimplex(const std::set<unsigned> &);
+
+	neighborGraph collapsedGraph; // Edges kept by reduceComplex
+
+	// Vertex pairs within maxEpsilon as bit rows; the dense expansion ANDs the rows of a simplex for its candidates
+	bitMatrix adjacency;
+	size_t adjacencyVersion = SIZE_MAX;
+	double adjacencyEpsilon = -1;
+	void buildAdjacency();
+
+	void indexDimension(unsigned);
+	const templateNode_P *findIndexed(simplexKey) const;
+
+	// Records of the flat dimension last indexed by prepareFlat (flatRecord<maxVertices>[]), and the common neighbors
+	//		buffer of the flat cofacet enumeration
+	void *flatIndexed = nullptr;
+	std::vector<std::pair<unsigned, double>> flatCandidates;
+
+	template <unsigned maxVertices, bool weighted, typename F>
+	void forEachCofacet(const flatRecord<maxVertices> &, unsigned, F &&);
+	template <unsigned maxVertices, typename F>
+	void forEachFacet(const flatRecord<maxVertices> &, unsigned, F &&);
+
+	// Simplex found while expanding: index of the simplex it extends, the inserted vertex and the weight
+	struct expansion
+	{
+		size_t parent;
+		unsigned pt;
+		double weight;
+	};
+	template <typename Collect, typename Reserve, typename Emit>
+	void parallelExpand(size_t, Collect &&, Reserve &&, Emit &&);
+	template <typename Collect, typename Build>
+	std::vector<templateNode_P> parallelExpand(size_t, Collect &&, Build &&);
 
 public:
 	binomialTable bin;
 	simplexArrayList(double, double);
 	double findWeight(std::set<unsigned>);
 
-	long long simplexHash(const std::set<unsigned> &);
-	unsigned maxVertex(long long, unsigned, unsigned, unsigned);
-	std::set<unsigned> getVertices(long long, int, unsigned);
+	simplexKey simplexHash(const std::set<unsigned> &);
+	template <typename index>
+	unsigned maxVertex(index, unsigned, unsigned, unsigned);
+	template <typename index>
+	std::set<unsigned> getVertices(index, int, unsigned);
 
 	void initBinom();
-	std::vector<nodeType *> getAllCofacets(templateNode_P, const std::unordered_map<long long, templateNode_P> &, bool = true, bool = true, unsigned = 0);
+	std::vector<nodeType *> getAllCofacets(templateNode_P, const std::unordered_map<simplexKey, templateNode_P, indexHash> &, bool = true, bool = true, unsigned = 0);
 	std::vector<templateNode_P> getAllCofacets(const std::set<unsigned> &, double, const std::unordered_map<templateNode_P, templateNode_P> &, bool = true);
 	std::vector<nodeType *> getAllFacets(nodeType *, bool = true, unsigned = 0);
 	std::vector<nodeType *> getAllFacets(templateNode_P, bool = true, unsigned = 0);
 	std::vector<templateNode_P> getAllFacets(templateNode_P);
 	std::vector<templateNode_P> expandDimension(std::vector<templateNode_P>, bool = true, unsigned = 0);
 
+	template <typename index>
+	std::vector<implicitNode<index>> getAllCofacets(const implicitNode<index> &, unsigned, const std::unordered_map<index, index, indexHash> &, bool = true);
+	template <typename index>
+	std::vector<implicitNode<index>> expandDimension(const std::vector<implicitNode<index>> &, unsigned);
+
+	template <unsigned maxVertices>
+	flatDimension<maxVertices> flatten(const std::vector<templateNode_P> &);
+	template <unsigned maxVertices>
+	flatDimension<maxVertices> expandFlat(flatDimension<maxVertices>, unsigned);
+	template <unsigned maxVertices>
+	void prepareFlat(flatDimension<maxVertices>);
+	template <unsigned maxVertices>
+	flatRecord<maxVertices> *findFlat(simplexKey) const;
+	template <unsigned maxVertices>
+	void getAllCofacets(const flatRecord<maxVertices> &, unsigned, const std::unordered_map<flatRecord<maxVertices> *, flatRecord<maxVertices> *> &, bool, std::vector<flatRecord<maxVertices> *> &);
+	template <unsigned maxVertices>
+	void getAllCofacets(const flatRecord<maxVertices> &, unsigned, const std::unordered_map<simplexKey, flatRecord<maxVertices> *, indexHash> &, bool, std::pmr::memory_resource &, std::vector<flatRecord<maxVertices> *> &);
+	template <unsigned maxVertices>
+	void getAllFacets(const flatRecord<maxVertices> &, unsigned, std::vector<flatRecord<maxVertices> *> &);
+	template <unsigned maxVertices>
+	void getAllFacets(const flatRecord<maxVertices> &, unsigned, std::pmr::memory_resource &, std::vector<flatRecord<maxVertices> *> &);
+
 	// virtual interface functions
 	double getSize();
 	void insert();
@@ -51,6 +158,7 @@ public:
 	void prepareFacets(int);
 	bool deletion(std::set<unsigned>);
 	void expandDimensions(int);
+	void reduceComplex();
 
 	~simplexArrayList();
 };
@@ -10,6 +10,7 @@
 #include "alphaComplex.hpp"
 #include "witnessComplex.hpp"
 #include "betaComplex.hpp"
+#include "sparseRipsComplex.hpp"
 
 template <typename nodeType>
 simplexBase<nodeType>::simplexBase() { return; }
@@ -70,14 +71,29 @@ void simplexBase<nodeType>::setConfig(std::map<std::string, std::string> &config
 }
 
 template <typename nodeType>
-void simplexBase<nodeType>::setDistanceMatrix(std::vector<std::vector<double>> *_distMatrix)
+void simplexBase<nodeType>::setDistanceMatrix(distanceMatrix *_distMatrix)
 {
 	distMatrix = _distMatrix;
+	distMatrixVersion++;
 	return;
 }
 
 template <typename nodeType>
-void simplexBase<nodeType>::setIncidenceMatrix(std::vector<std::vector<bool>> *_incidenceMatrix)
+void simplexBase<nodeType>::setWindowDistanceMatrix(std::vector<std::vector<double>> *_windowDistMatrix)
+{
+	windowDistMatrix = _windowDistMatrix;
+	return;
+}
+
+template <typename nodeType>
+void simplexBase<nodeType>::setNeighborGraph(neighborGraph *_neighGraph)
+{
+	neighGraph = _neighGraph;
+	return;
+}
+
+template <typename nodeType>
+void simplexBase<nodeType>::setIncidenceMatrix(bitMatrix *_incidenceMatrix)
 {
 	incidenceMatrix = _incidenceMatrix;
 	return;
@@ -118,6 +134,12 @@ simplexBase<nodeType> *simplexBase<nodeType>::newSimplex(const std::string &simp
 		t->setConfig(configMap);
 		return t;
 	}
+	else if (simplexT == "sparseRips" || simplexT == "sparseRipsComplex")
+	{
+		auto t = new sparseRipsComplex<nodeType>(0, 0);
+		t->setConfig(configMap);
+		return t;
+	}
 	return 0;
 }
 
@@ -128,20 +150,22 @@ void simplexBase<nodeType>::setEnclosingRadius(double r)
 }
 
 template <typename nodeType>
-std::set<std::shared_ptr<nodeType>, cmpByWeight<std::shared_ptr<nodeType>>> simplexBase<nodeType>::getDimEdges(int dim)
+const typename simplexBase<nodeType>::filtration &simplexBase<nodeType>::getDimEdges(int dim)
 {
 	if (dim >= simplexList.size())
 	{
 		ut.writeLog(simplexType, "Error: requested dimension beyond complex");
-		std::set<std::shared_ptr<nodeType>, cmpByWeight<std::shared_ptr<nodeType>>> a;
-		return a;
+		static const filtration empty;
+		return empty;
 	}
 	return simplexList[dim];
 }
 
 template <typename nodeType>
-std::vector<std::set<std::shared_ptr<nodeType>, cmpByWeight<std::shared_ptr<nodeType>>>> simplexBase<nodeType>::getAllEdges()
+const std::vector<typename simplexBase<nodeType>::filtration> &simplexBase<nodeType>::getAllEdges()
 {
+	for (auto &dimList : simplexList)
+		dimList.seal();
 	return simplexList;
 }
 
@@ -159,7 +183,7 @@ std::vector<std::shared_ptr<nodeType>> simplexBase<nodeType>::getAllCofacets(con
 }
 
 template <typename nodeType>
-std::vector<nodeType *> simplexBase<nodeType>::getAllCofacets(std::shared_ptr<nodeType>, const std::unordered_map<long long, std::shared_ptr<nodeType>> &, bool)
+std::vector<nodeType *> simplexBase<nodeType>::getAllCofacets(std::shared_ptr<nodeType>, const std::unordered_map<simplexKey, std::shared_ptr<nodeType>, indexHash> &, bool)
 {
 	ut.writeLog(simplexType, "No get cofacets function defined");
 	return std::vector<nodeType *>();
@@ -250,6 +274,20 @@ bool simplexBase<nodeType>::find(std::set<unsigned>)
 	return false;
 }
 
+template <typename nodeType>
+double simplexBase<nodeType>::findWeight(std::set<unsigned>)
+{
+	ut.writeLog(simplexType, "No findWeight function defined");
+	return -1;
+}
+
+template <typename nodeType>
+bool simplexBase<nodeType>::deletion(std::set<unsigned>)
+{
+	ut.writeLog(simplexType, "No deletion function defined");
+	return false;
+}
+
 template <typename nodeType>
 int simplexBase<nodeType>::vertexCount()
 {
@@ -292,11 +330,12 @@ void simplexBase<nodeType>::expandDimensions(int dim)
 	return;
 }
 
-/*template<typename nodeType>
-void simplexBase<nodeType>::reduceComplex(){
-	ut.writeLog(simplexType,"No reduceComplex function defined");
+template <typename nodeType>
+void simplexBase<nodeType>::reduceComplex()
+{
+	ut.writeLog(simplexType, "No reduceComplex function defined");
 	return;
-}*/
+}
 
 template <typename nodeType>
 void simplexBase<nodeType>::setStreamEvaluator(bool (*f)(std::vector<double> &, std::vector<std::vector<double>> &))
@@ -378,5 +417,6 @@ std::vector<std::shared_ptr<nodeType>> simplexBase<nodeType>::expanddelaunayDime
 }
 
 template class simplexBase<simplexNode>;
+template class simplexBase<wideSimplexNode>;
 template class simplexBase<alphaNode>;
 template class simplexBase<witnessNode>;
@@ -3,16 +3,20 @@
 #include <algorithm>
 #include <set>
 #include <memory>
+#include <memory_resource>
+#include <span>
 #include <iostream>
 #include <unordered_map>
 #include "utils.hpp"
+#include "neighborGraph.hpp"
+#include "simplexFiltration.hpp"
 
 // Header file for simplexBase class - see simplexTree.cpp for descriptions
 
 template <typename nodeType>
 struct cmpByWeight
 {
-	bool operator()(nodeType a, nodeType b) const
+	bool operator()(const nodeType &a, const nodeType &b) const
 	{
 		if (a->weight == b->weight)
 		{ // If the simplices have the same weight, sort by reverse lexicographic order for fastPersistence
@@ -39,7 +43,8 @@ class simplexBase
 private:
 public:
 	typedef std::shared_ptr<nodeType> templateNode_P;
-	std::vector<std::set<templateNode_P, cmpByWeight<templateNode_P>>> simplexList; // Holds ordered list of simplices in each dimension
+	typedef simplexFiltration<templateNode_P, cmpByWeight<templateNode_P>> filtration;
+	std::vector<filtration> simplexList; // Holds ordered list of simplices in each dimension (sorted once per build, see simplexFiltration)
 	std::vector<std::vector<unsigned>> dsimplexmesh;
 	unsigned simplexOffset = 0;
 
@@ -56,8 +61,11 @@ public:
 	double maxEpsilon;							  // Maximum epsilon, loaded from configuration
 	int maxDimension;							  // Maximum dimension, loaded from configuration
 	double alphaFilterationValue;				  // alpha FilterationValue for alpha Complex
-	std::vector<std::vector<double>> *distMatrix; // Pointer to distance matrix for current complex
-	std::vector<std::vector<bool>> *incidenceMatrix;
+	distanceMatrix *distMatrix = nullptr;						// Pointer to (condensed) distance matrix for current complex
+	size_t distMatrixVersion = 0;								// Bumped by setDistanceMatrix so views built from the distances are refreshed
+	std::vector<std::vector<double>> *windowDistMatrix = nullptr; // Pointer to the growing distance matrix of a streaming (sliding window) complex
+	neighborGraph *neighGraph = nullptr;								// Pointer to sparse epsilon-neighborhood graph (replaces distMatrix when set)
+	bitMatrix *incidenceMatrix = nullptr;						// Pointer to beta-skeleton incidence of the vertex pairs (alpha/beta complexes)
 
 	// For sliding window implementation, tracks the current vectors inserted into the window
 	//		Note - these point to the d0 simplexNodes; index, weight, etc. can be obtained
@@ -65,6 +73,15 @@ public:
 	int runningVectorCount = 0;			   // How many total points have been inserted into complex?
 								//		Is this different than indexCounter?
 
+	// Monotonic arena of the flat storage (see simplexArrayList::flatten); each dimension is one array carved from it,
+	//	and the arrays are only freed together by releaseArena or with the complex
+	std::pmr::monotonic_buffer_resource arena;
+
+	// Uninitialized array of n T in the arena
+	template <typename T>
+	std::span<T> arenaArray(size_t n) { return {static_cast<T *>(arena.allocate(n * sizeof(T), alignof(T))), n}; }
+	void releaseArena() { arena.release(); }
+
 	int removedSimplices = 0;
 	std::string stats = "RVIndex,Mean,Stdev,k,kNN_Mean,kNN_Stdev,Result\n";
 
@@ -75,8 +92,13 @@ public:
 
 	// Configurations of the complex
 	void setConfig(std::map<std::string, std::string> &);
-	void setDistanceMatrix(std::vector<std::vector<double>> *_distMatrix);
-	void setIncidenceMatrix(std::vector<std::vector<bool>> *_incidenceMatrix);
+	void setDistanceMatrix(distanceMatrix *_distMatrix);
+	void setWindowDistanceMatrix(std::vector<std::vector<double>> *_windowDistMatrix);
+	void setNeighborGraph(neighborGraph *_neighGraph);
+	void setIncidenceMatrix(bitMatrix *_incidenceMatrix);
+
+	// Edge length between two vertices, read from the sparse neighborhood graph when set (it may hold collapsed edges) or the dense matrix
+	double getDistance(unsigned i, unsigned j) const { return (neighGraph != nullptr) ? neighGraph->weight(i, j) : (*distMatrix)(i, j); }
 
 	void setEnclosingRadius(double);
 	static simplexBase *newSimplex(const std::string &, std::map<std::string, std::string> &);
@@ -99,6 +121,8 @@ public:
 
 	virtual bool find(std::vector<unsigned>);
 	virtual bool find(std::set<unsigned>);
+	virtual double findWeight(std::set<unsigned>);
+	virtual bool deletion(std::set<unsigned>);
 
 	virtual void deleteIterative(int);
 	virtual void deleteIndexRecurse(int); // A wrapper for the actual deleteIndexRecurse method.
@@ -109,10 +133,10 @@ public:
 	virtual void expandDimensions(int);
 	virtual std::vector<templateNode_P> expandDimension(std::vector<templateNode_P> edges);
 
-	// virtual void reduceComplex();
+	virtual void reduceComplex();
 
 	virtual std::vector<templateNode_P> getAllCofacets(const std::set<unsigned> &, double, const std::unordered_map<templateNode_P, templateNode_P> &, bool);
-	virtual std::vector<nodeType *> getAllCofacets(templateNode_P, const std::unordered_map<long long, templateNode_P> &, bool);
+	virtual std::vector<nodeType *> getAllCofacets(templateNode_P, const std::unordered_map<simplexKey, templateNode_P, indexHash> &, bool);
 
 	virtual std::vector<templateNode_P> getAllCofacets(const std::set<unsigned> &);
 	virtual std::vector<templateNode_P> getAllCofacets(templateNode_P);
@@ -121,7 +145,7 @@ public:
 	virtual std::vector<nodeType *> getAllFacets(nodeType *);
 	virtual std::vector<templateNode_P> getAllFacets(templateNode_P);
 
-	virtual std::set<templateNode_P, cmpByWeight<templateNode_P>> getDimEdges(int);
-	virtual std::vector<std::set<templateNode_P, cmpByWeight<templateNode_P>>> getAllEdges();
+	virtual const filtration &getDimEdges(int);
+	virtual const std::vector<filtration> &getAllEdges();
 	virtual std::vector<templateNode_P> expanddelaunayDimension(int);
 };
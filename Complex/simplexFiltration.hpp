@@ -0,0 +1,135 @@
+#pragma once
+
+// Header file for simplexFiltration class
+#include <vector>
+#include <algorithm>
+#include <execution>
+#include <atomic>
+
+/**
+ * @brief Build-then-seal list of the simplices of one dimension
+ *
+ * Simplices are appended unordered while a complex is built. The first read after a batch of inserts
+ * seals the list: one parallel sort by Compare, then duplicates (equivalent under Compare) are dropped.
+ * Reads therefore see the ascending, duplicate-free order of an ordered std::set without paying for
+ * a rebalance on every insert.
+ *
+ * Iteration, indexing and find seal lazily; size() counts pending duplicates until the list is sealed,
+ * so builders call seal() once they finish (and before sharing a list across threads).
+ *
+ * Every change to the contents takes a new, process-wide unique version, so an index built over a
+ * list (simplexArrayList's hash lookup) can tell whether the list changed behind it.
+ */
+template <typename T, typename Compare>
+class simplexFiltration
+{
+private:
+	mutable std::vector<T> v;
+	mutable bool sealed = true;
+	mutable size_t version = 0; // 0 until the list is first modified (an empty list)
+
+	static size_t nextVersion()
+	{
+		static std::atomic<size_t> versions{0};
+		return ++versions;
+	}
+
+public:
+	typedef typename std::vector<T>::const_iterator iterator;
+	typedef typename std::vector<T>::const_iterator const_iterator;
+	typedef typename std::vector<T>::const_reverse_iterator const_reverse_iterator;
+
+	// Append a simplex; the list stays sealed while simplices arrive in strictly ascending order
+	void insert(const T &x)
+	{
+		if (sealed && !v.empty() && !Compare()(v.back(), x))
+			sealed = false;
+		v.push_back(x);
+		version = nextVersion();
+	}
+
+	template <typename InputIt>
+	void insert(InputIt first, InputIt last)
+	{
+		for (; first != last; ++first)
+		{
+			if (sealed && !v.empty() && !Compare()(v.back(), *first))
+				sealed = false;
+			v.push_back(*first);
+		}
+		version = nextVersion();
+	}
+
+	void reserve(size_t n) { v.reserve(n); }
+
+	// Sort the pending inserts once and drop duplicate simplices
+	void seal() const
+	{
+		if (sealed)
+			return;
+#ifndef NO_PARALLEL_ALGORITHMS
+		std::sort(std::execution::par, v.begin(), v.end(), Compare());
+#else
+		std::sort(v.begin(), v.end(), Compare());
+#endif
+		auto last = std::unique(v.begin(), v.end(), [](const T &a, const T &b)
+								{ return !Compare()(a, b); });
+		if (last != v.end())
+		{
+			v.erase(last, v.end());
+			version = nextVersion();
+		}
+		sealed = true;
+	}
+
+	bool isSealed() const { return sealed; }
+	size_t getVersion() const { return version; }
+	bool empty() const { return v.empty(); }
+	size_t size() const { return v.size(); }
+
+	const_iterator begin() const
+	{
+		seal();
+		return v.cbegin();
+	}
+	const_iterator end() const
+	{
+		seal();
+		return v.cend();
+	}
+	const_reverse_iterator rbegin() const
+	{
+		seal();
+		return v.crbegin();
+	}
+	const_reverse_iterator rend() const
+	{
+		seal();
+		return v.crend();
+	}
+	const T &operator[](size_t i) const
+	{
+		seal();
+		return v[i];
+	}
+
+	// Binary search of the sealed list for a simplex equivalent to x
+	const_iterator find(const T &x) const
+	{
+		seal();
+		auto it = std::lower_bound(v.cbegin(), v.cend(), x, Compare());
+		return (it != v.cend() && !Compare()(x, *it)) ? it : v.cend();
+	}
+
+	const_iterator erase(const_iterator it)
+	{
+		version = nextVersion();
+		return v.erase(it);
+	}
+	void clear()
+	{
+		v.clear();
+		sealed = true;
+		version = 0;
+	}
+};
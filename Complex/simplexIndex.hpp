@@ -0,0 +1,102 @@
+#pragma once
+
+// Header file for simplexIndex class
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+#include "utils.hpp"
+
+/**
+ * @brief Flat open-addressing hash index from a simplex hash (combinatorial index) to a position
+ *
+ * Keys and positions live in two contiguous arrays with linear probing at a load factor of at most 1/2,
+ * so a lookup touches one or two cache lines instead of chasing the nodes of an std::unordered_map.
+ * The index is built in parallel from a sealed list of simplices. Keys are 128-bit (simplexKey), so slots
+ * are claimed with a compare-and-swap on the position, and the key of a claimed slot is read through it.
+ */
+class simplexIndex
+{
+private:
+    static constexpr simplexKey emptyKey = -1; // Simplex hashes are non-negative; -1 is also the hash of a node never hashed
+
+    std::vector<simplexKey> keys;
+    std::vector<size_t> positions;
+    size_t mask = 0;
+
+public:
+    static constexpr size_t npos = SIZE_MAX;
+
+    /**
+     * @brief Index positions 0 ... n-1 under the keys keyOf(0) ... keyOf(n-1).
+     *
+     * @param n Number of positions to index.
+     * @param keyOf Hash of the simplex at a position; called concurrently.
+     * @throws std::invalid_argument if a key is emptyKey (an unhashed node), which would otherwise mark its slot empty.
+     */
+    template <typename KeyOf>
+    void build(size_t n, KeyOf &&keyOf)
+    {
+        size_t capacity = 16;
+        while (capacity < 2 * n)
+            capacity <<= 1;
+        mask = capacity - 1;
+
+        std::vector<simplexKey> keyAt(n);
+        bool unhashed = false;
+#pragma omp parallel for schedule(static) reduction(|| : unhashed)
+        for (size_t i = 0; i < n; i++)
+        {
+            keyAt[i] = keyOf(i);
+            unhashed = unhashed || keyAt[i] == emptyKey;
+        }
+
+        if (unhashed)
+        {
+            clear();
+            throw std::invalid_argument("simplexIndex: cannot index a simplex without a hash");
+        }
+
+        positions.assign(capacity, npos);
+#pragma omp parallel for schedule(static)
+        for (size_t i = 0; i < n; i++)
+        {
+            for (size_t slot = indexHash()(keyAt[i]) & mask;; slot = (slot + 1) & mask)
+            {
+                size_t expected = npos;
+                std::atomic_ref<size_t> p(positions[slot]);
+                if (p.compare_exchange_strong(expected, i) || keyAt[expected] == keyAt[i])
+                    break;
+            }
+        }
+
+        keys.resize(capacity);
+#pragma omp parallel for schedule(static)
+        for (size_t slot = 0; slot < capacity; slot++)
+            keys[slot] = positions[slot] == npos ? emptyKey : keyAt[positions[slot]];
+    }
+
+    // Position stored under key, or npos
+    size_t find(simplexKey key) const
+    {
+        if (keys.empty() || key == emptyKey)
+            return npos;
+        for (size_t slot = indexHash()(key) & mask;; slot = (slot + 1) & mask)
+        {
+            if (keys[slot] == key)
+                return positions[slot];
+            if (keys[slot] == emptyKey)
+                return npos;
+        }
+    }
+
+    void clear()
+    {
+        keys.clear();
+        positions.clear();
+        mask = 0;
+    }
+
+    size_t getSize() const { return keys.size() * (sizeof(simplexKey) + sizeof(size_t)); }
+};
@@ -1,6 +1,8 @@
 #include <string>
 #include <algorithm>
 #include <vector>
+#include <bit>
+#include <limits>
 #include <unistd.h>
 #include <iostream>
 // #include <typeinfo>
@@ -18,216 +20,321 @@ simplexTree<nodeType>::simplexTree(double _maxEpsilon, int _maxDim)
 	return;
 }
 
+
 template <typename nodeType>
 void simplexTree<nodeType>::outputComplex()
 {
-	return printTree(root);
+	return printTree(0);
 }
 
+// Position of the first child of slot whose vertex is not less than vertex
 template <typename nodeType>
-void simplexTree<nodeType>::recurseInsertDsimplex(simplexTreeNode_P node, std::vector<int> simp, std::vector<std::vector<double>> inputData)
+unsigned simplexTree<nodeType>::childPosition(unsigned slot, unsigned vertex) const
 {
+	auto first = childPool.begin() + nodes[slot].childOffset;
+	auto last = first + nodes[slot].childCount;
+	return std::partition_point(first, last, [&](unsigned c)
+								{ return nodes[c].vertex < vertex; }) -
+		   first;
+}
 
-	// This algorithm insert a simplex and all its subfaces in the simplex tree. Let σ be a simplex we want to insert with all its subfaces.
-	//  Let [l0, · · · , lj ] be its word representation. For i from 0 to j we insert, if not already present, a node Nli , storing label li, as a child of the root.
-	//  We recursively call the algorithm on the subtree rooted at Nli for the insertion of the suffix [li+1,··· ,lj].
-	//  Since the number of subfaces ofr
-	//   a simplex of dimension j is 􏰆 􏰁j+1􏰂 = 2j+1, this algorithm takes time O(2jDm).
-	sort(simp.begin(), simp.end());
-	int firstind = 0;
-	int lastind = simp.size();
-	for (auto x : simp)
+// Slot of the child of slot labelled vertex, or none
+template <typename nodeType>
+unsigned simplexTree<nodeType>::findChild(unsigned slot, unsigned vertex) const
+{
+	unsigned pos = childPosition(slot, vertex);
+	if (pos < nodes[slot].childCount && nodes[child(slot, pos)].vertex == vertex)
+		return child(slot, pos);
+	return none;
+}
+
+// Take a child block of the given (power of two) capacity from the free lists, or grow the pool
+template <typename nodeType>
+unsigned simplexTree<nodeType>::allocateBlock(unsigned capacity)
+{
+	unsigned sizeClass = std::countr_zero(capacity);
+	if (sizeClass < freeBlocks.size() && !freeBlocks[sizeClass].empty())
 	{
-		firstind++;
-		std::vector<int>::const_iterator first = simp.begin() + firstind;
-		std::vector<int>::const_iterator last = simp.begin() + lastind;
-		std::vector<int> subsimplex(first, last);
-		std::set<unsigned> simplex;
-		if (node == nullptr)
-			simplex = {};
-		else
-			simplex = node->simpNode->simplex;
-		simplex.insert(x);
-		double weight = 0;
-		double circumRadius;
-		double volume;
-		std::vector<double> circumCenter;
-		if (simplex.size() > 2)
-		{
-			circumRadius = utils::circumRadius(simplex, this->distMatrix);
-			volume = utils::simplexVolume(simplex, this->distMatrix, inputData[0].size());
-		}
-		else
-		{
-			circumRadius = weight / 2;
-			volume = weight;
-		}
-		std::cout << simplex.size() << std::endl;
-		if (simplex.size() > 2)
-			circumCenter = utils::circumCenter(simplex, inputData);
+		unsigned offset = freeBlocks[sizeClass].back();
+		freeBlocks[sizeClass].pop_back();
+		return offset;
+	}
 
-		else if (simplex.size() == 2)
-		{
-			auto first = simplex.begin();
-			std::vector<double> R;
-			std::vector<double> A = inputData[*first];
-			std::advance(first, 1);
-			std::vector<double> B = inputData[*first];
-			std::transform(A.begin(), A.end(), B.begin(), std::back_inserter(R), [](double e1, double e2)
-						   { return ((e1 + e2) / 2); });
-			circumCenter = R;
-		}
-		else
-			circumCenter = inputData[*(simplex.begin())];
-		simplexTreeNode_P insNode = std::make_shared<simplexTreeNode<nodeType>>(simplex, circumRadius);
-		// TODO: dependent on alpha node
-		// insNode->simpNode->circumCenter = circumCenter;
-		// insNode->simpNode->circumRadius = circumRadius;
-		insNode->simpNode->index = x;
-		insNode->simpNode->hash = this->nodeCount;
-		this->nodeCount++;
-		if (root == nullptr)
-		{
-			root = std::make_shared<simplexTreeNode<nodeType>>();
-			insNode->parent = root.get();
-			root->child = insNode;
-			if (subsimplex.size() > 0)
-				recurseInsertDsimplex(root->child, subsimplex, inputData);
-		}
-		else
-		{
-			bool found = false;
-			if (node == nullptr)
-			{
-				node = root;
-				insNode->parent = node.get();
-				insNode->sibling = node->child;
-				node->child = insNode;
-				if (subsimplex.size() > 0)
-					recurseInsertDsimplex(node->child, subsimplex, inputData);
-			}
-			else
-			{
-				for (auto it = node->child; it != nullptr; it = it->sibling)
-				{
-					if (it->simpNode->simplex == simplex)
-					{
-						found = true;
-						if (subsimplex.size() > 0)
-							recurseInsertDsimplex(it, subsimplex, inputData);
-						break;
-					}
-				}
-				if (!found)
-				{
-					if (node->child == nullptr)
-					{
-						node->child = insNode;
-						insNode->parent = node.get();
-					}
-					else
-					{
-						insNode->parent = node.get();
-						insNode->sibling = node->child;
-						node->child = insNode;
-					}
-					if (subsimplex.size() > 0)
-						recurseInsertDsimplex(node->child, subsimplex, inputData);
-				}
-			}
-		}
+	unsigned offset = childPool.size();
+	childPool.resize(childPool.size() + capacity);
+	return offset;
+}
+
+template <typename nodeType>
+void simplexTree<nodeType>::releaseBlock(unsigned offset, unsigned capacity)
+{
+	if (capacity == 0)
+		return;
+
+	unsigned sizeClass = std::countr_zero(capacity);
+	if (freeBlocks.size() <= sizeClass)
+		freeBlocks.resize(sizeClass + 1);
+	freeBlocks[sizeClass].push_back(offset);
+}
+
+// Add a child labelled vertex to slot, keeping the sibling array sorted; returns the new slot
+//	Vertices arrive in increasing order while streaming, so this is an append in the common case
+template <typename nodeType>
+unsigned simplexTree<nodeType>::addChild(unsigned slot, unsigned vertex, double weight)
+{
+	unsigned ins;
+	if (!freeNodes.empty())
+	{
+		ins = freeNodes.back();
+		freeNodes.pop_back();
 	}
-	return;
+	else
+	{
+		ins = nodes.size();
+		nodes.emplace_back();
+	}
+
+	treeNode &insNode = nodes[ins];
+	insNode = treeNode();
+	insNode.vertex = vertex;
+	insNode.parent = slot;
+	insNode.size = nodes[slot].size + 1;
+	insNode.weight = weight;
+
+	treeNode &node = nodes[slot];
+	if (node.childCount == node.childCapacity)
+	{
+		// Move the sibling array to a block twice the size
+		unsigned capacity = node.childCapacity == 0 ? 2 : 2 * node.childCapacity;
+		unsigned offset = allocateBlock(capacity);
+		std::copy_n(childPool.begin() + node.childOffset, node.childCount, childPool.begin() + offset);
+		releaseBlock(node.childOffset, node.childCapacity);
+		node.childOffset = offset;
+		node.childCapacity = capacity;
+	}
+
+	unsigned pos = childPosition(slot, vertex);
+	auto first = childPool.begin() + node.childOffset;
+	std::copy_backward(first + pos, first + node.childCount, first + node.childCount + 1);
+	first[pos] = ins;
+	node.childCount++;
+
+	if (slotIndex.size() < insNode.size)
+		slotIndex.resize(insNode.size);
+	simplexKey key = slotHash(ins);
+	if (key >= 0)
+		slotIndex[insNode.size - 1][key] = ins;
+
+	this->nodeCount++;
+	return ins;
 }
 
+// Remove the child at position from the sibling array of slot, freeing its subtree
 template <typename nodeType>
-void simplexTree<nodeType>::recurseInsert(simplexTreeNode<nodeType> *node, unsigned curIndex, int depth, double maxE, std::set<unsigned> simp)
+void simplexTree<nodeType>::removeChild(unsigned slot, unsigned position)
 {
-	// Incremental insertion
-	// Recurse to each child (which we'll use the parent pointer for...)
-	simplexTreeNode<nodeType> *temp;
-	double curE = 0;
+	unsigned rem = child(slot, position);
 
-	if (this->runningVectorIndices.size() < this->runningVectorCount)
+	treeNode &node = nodes[slot];
+	auto first = childPool.begin() + node.childOffset;
+	std::copy(first + position + 1, first + node.childCount, first + position);
+	if (--node.childCount == 0)
 	{
+		releaseBlock(node.childOffset, node.childCapacity);
+		node.childCapacity = 0;
+	}
 
-		// Get the positions of the vector in the runningVectorIndices array
-		auto nodeIndex = std::find(this->runningVectorIndices.begin(), this->runningVectorIndices.end(), node->simpNode->index);
+	freeSubtree(rem);
+}
 
-		if ((std::distance(this->runningVectorIndices.begin(), nodeIndex)) > this->distMatrix->size() || (this->indexCounter - (this->runningVectorCount - 1)) > (*this->distMatrix)[std::distance(this->runningVectorIndices.begin(), nodeIndex)].size())
-		{
-			std::cout << "DistMatrix access error:" << std::endl;
-			std::cout << "\tAttempting to access distMatrix indexes: " << node->simpNode->index << " x " << this->indexCounter << std::endl;
-			std::cout << "\tDistMatrix size: " << (*this->distMatrix).size() << std::endl;
-			std::cout << "\trviCount: " << this->runningVectorCount << "\t rviSize: " << this->runningVectorIndices.size() << "\tOffset: " << this->simplexOffset << "\tIC: " << this->indexCounter << std::endl;
-			std::cout << "\tOffset Indices: " << node->simpNode->index - (this->runningVectorCount - 1) << " x " << this->indexCounter - (this->runningVectorCount - 1) << std::endl;
-			std::cout << "\tBackwards size: " << this->distMatrix[this->indexCounter - (this->runningVectorCount - 1)].size() << std::endl;
-			std::cout << "\tRow Size: " << this->distMatrix[this->indexCounter - (this->runningVectorCount - 1)].size() << "\tCurIndex: " << curIndex << std::endl;
-			std::cout << "\tNode Index: " << std::distance(this->runningVectorIndices.begin(), nodeIndex) << std::endl;
-		}
-		else
+// Return slot and its subtree to the pools
+template <typename nodeType>
+void simplexTree<nodeType>::freeSubtree(unsigned slot)
+{
+	for (unsigned i = 0; i < nodes[slot].childCount; i++)
+		freeSubtree(child(slot, i));
+
+	// The parent chain is still intact here, so the hash of the slot can be recomputed
+	simplexKey key = slotHash(slot);
+	if (key >= 0)
+		slotIndex[nodes[slot].size - 1].erase(key);
+
+	releaseBlock(nodes[slot].childOffset, nodes[slot].childCapacity);
+	nodes[slot] = treeNode();
+	if (slot < simplices.size())
+		simplices[slot] = nullptr;
+	freeNodes.push_back(slot);
+	this->nodeCount--;
+}
+
+// Distance from vertex to the point being inserted (indexCounter)
+template <typename nodeType>
+double simplexTree<nodeType>::insertDistance(unsigned vertex)
+{
+	if (this->runningVectorIndices.size() < (size_t)this->runningVectorCount)
+	{
+		// Points have left the window; the rows of windowDistMatrix follow runningVectorIndices (ascending)
+		//	and end with the distance to the newest point
+		size_t pos = std::lower_bound(this->runningVectorIndices.begin(), this->runningVectorIndices.end(), (int)vertex) - this->runningVectorIndices.begin();
+		if (pos >= this->windowDistMatrix->size() || (*this->windowDistMatrix)[pos].empty())
 		{
-			curE = *((*this->distMatrix)[std::distance(this->runningVectorIndices.begin(), nodeIndex)].rbegin());
+			this->ut.writeDebug("simplexTree", "DistMatrix access error: vertex " + std::to_string(vertex) + " x " + std::to_string(this->indexCounter) + ", distMatrix size " + std::to_string(this->windowDistMatrix->size()));
+			return std::numeric_limits<double>::infinity();
 		}
+		return (*this->windowDistMatrix)[pos].back();
 	}
-	else
+
+	return (this->windowDistMatrix != nullptr) ? (*this->windowDistMatrix)[vertex][this->indexCounter] : (*this->distMatrix)(vertex, this->indexCounter);
+}
+
+// Vertices on the path from the root to slot
+template <typename nodeType>
+std::set<unsigned> simplexTree<nodeType>::simplexOf(unsigned slot) const
+{
+	std::set<unsigned> simplex;
+	for (; slot != 0; slot = nodes[slot].parent)
+		simplex.insert(simplex.begin(), nodes[slot].vertex);
+	return simplex;
+}
+
+// nodeType of a slot for the simplexBase interface; built on first use and kept until the simplex is removed
+template <typename nodeType>
+typename simplexTree<nodeType>::templateNode_P simplexTree<nodeType>::nodeAt(unsigned slot)
+{
+	if (simplices.size() <= slot)
+		simplices.resize(nodes.size());
+
+	if (simplices[slot] == nullptr)
 	{
-		curE = (*this->distMatrix)[node->simpNode->index][this->indexCounter];
+		simplices[slot] = std::make_shared<nodeType>(simplexOf(slot), nodes[slot].weight);
+		simplices[slot]->index = nodes[slot].vertex;
+		simplices[slot]->hash = slot;
 	}
+	return simplices[slot];
+}
 
-	curE = curE > maxE ? curE : maxE;
+// Follow the vertices [begin, end) down the tree from slot; returns the slot reached, or none
+template <typename nodeType>
+unsigned simplexTree<nodeType>::findSlot(std::set<unsigned>::const_iterator begin, std::set<unsigned>::const_iterator end, unsigned slot) const
+{
+	if (nodes.empty())
+		return none;
 
-	// Check if the node needs inserted at this level
-	if (curE <= this->maxEpsilon)
+	for (auto it = begin; it != end && slot != none; ++it)
+		slot = findChild(slot, *it);
+	return slot;
+}
+
+// C(n, k) in 128 bits, or -1 once it overflows (streamed vertex labels are unbounded, so there is no fixed table)
+template <typename nodeType>
+simplexKey simplexTree<nodeType>::binomial(unsigned n, unsigned k)
+{
+	if (k > n)
+		return 0;
+
+	simplexKey coefficient = 1;
+	for (unsigned j = 1; j <= k; j++)
+	{
+		if (__builtin_mul_overflow(coefficient, (simplexKey)(n - j + 1), &coefficient))
+			return -1;
+		coefficient /= j; // C(n, j)
+	}
+	return coefficient;
+}
+
+// Combinatorial hash of the simplex at slot, the sum of C(v_i, i + 1) over its sorted vertices; -1 if it overflows
+template <typename nodeType>
+simplexKey simplexTree<nodeType>::slotHash(unsigned slot) const
+{
+	simplexKey key = 0;
+	for (; slot != 0; slot = nodes[slot].parent)
 	{
-		simp.insert(node->simpNode->index);
-		// Get the largest weight of this simplex
-		maxE = curE > node->simpNode->weight ? curE : node->simpNode->weight;
-		simplexTreeNode_P insNode = std::make_shared<simplexTreeNode<nodeType>>(simp, maxE);
-		insNode->simpNode->index = curIndex;
-		insNode->simpNode->hash = this->nodeCount;
-		this->nodeCount++;
-
-		// if depth (i.e. 1 for first iteration) is LT weightGraphSize (starts at 1)
-		// if(simplexList.size() < simp.size())
-		//	simplexList.push_back({});
-		// simplexList[simp.size() - 1].insert(insNode->simp);
-
-		// Check if the node has children already...
-		if (node->child == nullptr)
+		simplexKey term = binomial(nodes[slot].vertex, nodes[slot].size);
+		if (term < 0 || __builtin_add_overflow(key, term, &key))
+			return -1;
+	}
+	return key;
+}
+
+// Slot of a simplex, or none; through slotIndex, falling back to the tree walk for hashes past 128 bits
+template <typename nodeType>
+unsigned simplexTree<nodeType>::lookupSlot(const std::set<unsigned> &simplex) const
+{
+	if (simplex.empty() || simplex.size() > slotIndex.size())
+		return none;
+
+	simplexKey key = 0;
+	unsigned i = 1;
+	for (unsigned vertex : simplex)
+	{
+		simplexKey term = binomial(vertex, i++);
+		if (term < 0 || __builtin_add_overflow(key, term, &key))
+			return findSlot(simplex.begin(), simplex.end());
+	}
+
+	auto &index = slotIndex[simplex.size() - 1];
+	auto it = index.find(key);
+	return it != index.end() ? it->second : none;
+}
+
+template <typename nodeType>
+void simplexTree<nodeType>::recurseInsertDsimplex(unsigned slot, std::vector<int> simp, std::vector<std::vector<double>> inputData)
+{
+
+	// This algorithm insert a simplex and all its subfaces in the simplex tree. Let σ be a simplex we want to insert with all its subfaces.
+	//  Let [l0, · · · , lj ] be its word representation. For i from 0 to j we insert, if not already present, a node Nli , storing label li, as a child of the root.
+	//  We recursively call the algorithm on the subtree rooted at Nli for the insertion of the suffix [li+1,··· ,lj].
+	//  Since the number of subfaces ofr
+	//   a simplex of dimension j is 􏰆 􏰁j+1􏰂 = 2j+1, this algorithm takes time O(2jDm).
+	if (nodes.empty())
+		nodes.emplace_back();
+
+	sort(simp.begin(), simp.end());
+	for (unsigned i = 0; i < simp.size(); i++)
+	{
+		unsigned next = findChild(slot, simp[i]);
+		if (next == none)
 		{
-			node->child = insNode;
-			insNode->parent = node;
-			// node->children.insert(insNode);
+			std::set<unsigned> simplex = simplexOf(slot);
+			simplex.insert(simp[i]);
 
-			// Node has children, add to the beginning of children
+			// TODO: circumCenter / circumRadius dependent on alpha node
+			double circumRadius = simplex.size() > 2 ? utils::circumRadius(simplex, this->distMatrix) : 0;
+			next = addChild(slot, simp[i], circumRadius);
 		}
-		else
-		{
-			// Add new node as the first child. Shift existing children to left.
-			insNode->parent = node;
-			insNode->sibling = node->child;
-			node->child = insNode;
-			// node->children.insert(insNode);
 
-			temp = insNode->sibling.get();
+		if (i + 1 < simp.size())
+			recurseInsertDsimplex(next, std::vector<int>(simp.begin() + i + 1, simp.end()), inputData);
+	}
+	return;
+}
 
-			// Have to check the children now...
-			if (simp.size() <= this->maxDimension)
-			{
-				do
-				{
-					recurseInsert(temp, curIndex, depth + 1, maxE, simp);
-				} while ((temp = temp->sibling.get()) != nullptr);
-			}
-		}
+template <typename nodeType>
+void simplexTree<nodeType>::recurseInsert(unsigned slot, double maxE)
+{
+	// Incremental insertion of the point indexCounter below slot
+	double curE = std::max(insertDistance(nodes[slot].vertex), maxE);
+
+	// Check if the node needs inserted at this level
+	if (curE > this->maxEpsilon)
+		return;
+
+	// Get the largest weight of this simplex
+	maxE = std::max(curE, nodes[slot].weight);
+
+	// Have to check the existing children (cofaces of this simplex) first...
+	if ((int)nodes[slot].size + 1 <= this->maxDimension)
+	{
+		for (unsigned i = 0, n = nodes[slot].childCount; i < n; i++)
+			recurseInsert(child(slot, i), maxE);
 	}
 
+	addChild(slot, this->indexCounter, maxE);
 	return;
 }
 
 template <typename nodeType>
-void simplexTree<nodeType>::printTree1(simplexTreeNode_P headPointer)
+void simplexTree<nodeType>::printTree1([[maybe_unused]] unsigned slot)
 {
 
 	// Needs to be updated to only alpha nodes, probably specialize printTree()
@@ -248,7 +355,7 @@ void simplexTree<nodeType>::printTree1(simplexTreeNode_P headPointer)
 }
 
 template <typename nodeType>
-void simplexTree<nodeType>::validateNodes(simplexTreeNode_P headPointer)
+void simplexTree<nodeType>::validateNodes([[maybe_unused]] unsigned slot)
 {
 	// Commenting out temporarily - alphaFilterationValue not part of arguments?
 
@@ -271,48 +378,30 @@ void simplexTree<nodeType>::validateNodes(simplexTreeNode_P headPointer)
 	return;
 }
 
+
 template <typename nodeType>
-void simplexTree<nodeType>::printTree(simplexTreeNode_P headPointer)
+void simplexTree<nodeType>::printTree(unsigned slot)
 {
 	std::cout << "_____________________________________" << std::endl;
-	if (root->child == nullptr)
+	if (nodes.empty() || nodes[0].childCount == 0)
 	{
 		std::cout << "Empty tree... " << std::endl;
 		return;
 	}
-	auto temp = headPointer.get();
-
-	std::cout << "ROOT: " << headPointer->simpNode->index << "\t" << headPointer << "\t" << headPointer->child << "\t" << headPointer->sibling << std::endl;
 
-	std::cout << "[index , address, sibling, child, parent]" << std::endl
+	std::cout << "[vertex , slot, parent, children, weight]" << std::endl
 			  << std::endl;
 
-	for (auto simplexIter = headPointer; simplexIter != nullptr; simplexIter = simplexIter->sibling)
+	for (unsigned i = 0; i < nodes[slot].childCount; i++)
 	{
-		std::cout << simplexIter->simpNode->index << "\t";
-		std::cout << simplexIter << "\t";
-		std::cout << simplexIter->sibling << "\t";
-		std::cout << simplexIter->child << "\t";
-		std::cout << simplexIter->parent << "\t";
-		this->ut.print1DVector(simplexIter->simpNode->simplex);
-
-		// temp = simplexIter;
+		unsigned c = child(slot, i);
+		std::cout << nodes[c].vertex << "\t" << c << "\t" << nodes[c].parent << "\t" << nodes[c].childCount << "\t" << nodes[c].weight << "\t";
+		this->ut.print1DVector(simplexOf(c));
 	}
 
-	std::cout << "_____________________________________" << std::endl;
-
-	std::cout << "Children of root->child (" << temp->sibling->sibling->sibling->sibling->child << ")" << std::endl
-			  << std::endl;
-
-	for (auto simplexIter = temp->sibling->sibling->sibling->sibling->child; simplexIter != nullptr; simplexIter = simplexIter->sibling)
-	{
-		std::cout << simplexIter->simpNode->index << "\t";
-		std::cout << simplexIter << "\t";
-		std::cout << simplexIter->sibling << "\t";
-		std::cout << simplexIter->child << "\t";
-		std::cout << simplexIter->parent << "\t";
-		this->ut.print1DVector(simplexIter->simpNode->simplex);
-	}
+	for (unsigned i = 0; i < nodes[slot].childCount; i++)
+		if (nodes[child(slot, i)].childCount > 0)
+			printTree(child(slot, i));
 
 	return;
 }
@@ -340,15 +429,15 @@ bool simplexTree<nodeType>::insertIterative(std::vector<double> &currentVector,
 		distsCurrVec.erase(distsCurrVec.begin());
 
 		// Insert the new point into the distance matrix and complex
-		for (int i = 0; i < (*this->distMatrix).size(); i++)
+		for (size_t i = 0; i < (*this->windowDistMatrix).size(); i++)
 		{
-			(*this->distMatrix)[i].push_back(distsCurrVec[i]);
+			(*this->windowDistMatrix)[i].push_back(distsCurrVec[i]);
 		}
 
 		distsCurrVec.push_back(0);
 		//
 		//		std::vector<double> distMatLastRow( window.size() );
-		this->distMatrix->push_back(distsCurrVec);
+		this->windowDistMatrix->push_back(distsCurrVec);
 
 		//        distMatrix->push_back(distMatrixRow);
 
@@ -377,7 +466,6 @@ bool simplexTree<nodeType>::insertIterative(std::vector<double> &currentVector,
 		//	     std::cout << "========================== Simplex tree after insertion ==========================" << '\n';
 		//		 printTree(root);
 
-		std::cout << "indexToBeDeleted = " << indexToBeDeleted << '\n';
 		deleteIndexRecurse(keyToBeDeleted);
 		this->runningVectorIndices.erase(this->runningVectorIndices.begin() + indexToBeDeleted);
 
@@ -406,23 +494,20 @@ void simplexTree<nodeType>::deleteIterative(int simplexIndex)
 
 		// Index holds the index in the runningVectorIndices array of the simplexNode pointer
 		int index = std::distance(this->runningVectorIndices.begin(), it);
-		std::cout << "index = " << index << '\n';
 
 		// Delete the row and column from the distance matrix based on vector index
 		//	This corresponds to the index into the runnningVectorIndices array
 
 		// Delete Row[index]
-		this->distMatrix->erase(this->distMatrix->begin() + index);
+		this->windowDistMatrix->erase(this->windowDistMatrix->begin() + index);
 
 		// Delete column[index] (row[][index])
-		for (int i = 0; i < (*this->distMatrix).size(); i++)
+		for (size_t i = 0; i < (*this->windowDistMatrix).size(); i++)
 		{
-			if ((*this->distMatrix)[i].size() >= index)
-				(*this->distMatrix)[i].erase((*this->distMatrix)[i].begin() + index);
+			if ((*this->windowDistMatrix)[i].size() >= (size_t)index)
+				(*this->windowDistMatrix)[i].erase((*this->windowDistMatrix)[i].begin() + index);
 		}
 
-		auto curNodeCount = this->nodeCount;
-
 		// Delete all entries in the simplex tree
 		// printTree(root);
 		//  std::cout << "simplex->index " << simplex->index << '\n';
@@ -437,93 +522,33 @@ void simplexTree<nodeType>::deleteIterative(int simplexIndex)
 	return;
 }
 
+
 template <typename nodeType>
 void simplexTree<nodeType>::deleteIndexRecurse(int vectorIndex)
 {
-	std::cout << "deleteIndexRecurse vectorIndex = " << vectorIndex << '\n';
-
-	// Since child index is always higher than parent index, no "top node" between root->child and vectorIndex
-	// can contain a subtree that has a node->index =  vectorIndex. Therefore, skip to the top node whose sibling
-	// has vectorIndex.
-	simplexTreeNode<nodeType> *curNode = root->child.get();
-
-	if (curNode->sibling != nullptr)
+	if (nodes.empty())
 	{
-		while (curNode->sibling->simpNode->index > vectorIndex)
-		{
-			curNode = curNode->sibling.get();
-		}
+		std::cout << "Empty tree" << std::endl;
+		return;
 	}
 
-	deleteIndexRecurse(vectorIndex, curNode);
+	deleteIndexRecurse(vectorIndex, 0);
 	return;
 }
 
 template <typename nodeType>
-void simplexTree<nodeType>::deleteIndexRecurse(int vectorIndex, simplexTreeNode<nodeType> *curNode)
+void simplexTree<nodeType>::deleteIndexRecurse(int vectorIndex, unsigned slot)
 {
-	if (curNode == nullptr)
-	{
-		std::cout << "Empty tree" << std::endl;
-		return;
-	}
-
-	// Handle siblings - either they need to be removed (and 'hopped') or recursed
-	//	Only need to recurse if the vector could be a member of tree (i.e. < vectorIndex)
-	if (curNode->sibling != nullptr && curNode->sibling->simpNode->index == vectorIndex)
-	{ // Current node's sibling is to be deleted
-
-		// Map the current node's sibling to the node following the node for deletion
-		simplexTreeNode<nodeType> *tempNode = curNode->sibling.get();
-		curNode->sibling = curNode->sibling->sibling;
-
-		// Delete the orphaned node now that sibling remapping is handled
-		//	The sibling still points to the following node, so this is valid
-		deleteIndexRecurse(vectorIndex, tempNode);
-	}
-	else if (curNode->sibling != nullptr)
-	{
-		// Recurse to the next sibling and check for deletion
-		deleteIndexRecurse(vectorIndex, curNode->sibling.get());
-	}
-
-	// Handle self; if this is the vector index delete branches/nodes
-	//	Assume all children / sibling pointers have been alleviated in calling function
-	if (curNode->simpNode->index == vectorIndex)
-	{
-		// Ensure we aren't the first node of the tree
-		if (curNode == root->child.get())
-		{
-			root->child = curNode->sibling;
-		}
+	// Children are sorted by vertex and a child's vertex is always higher than its parent's, so only the
+	//	subtrees of the children before vectorIndex can contain it
+	unsigned pos = childPosition(slot, vectorIndex);
 
-		// Remove our index from the parent
-		// curNode->parent->children.erase(curNode);
+	// Delete the child for vectorIndex and its branch
+	if (pos < nodes[slot].childCount && nodes[child(slot, pos)].vertex == (unsigned)vectorIndex)
+		removeChild(slot, pos);
 
-		// Delete this node and sub-nodes in the tree
-		deletion(curNode);
-
-		// If this isn't the vectorIndex, need to look at children and remove or recurse
-		//	Only need to recurse if the vector could be a member of tree (i.e. < vectorIndex)
-	}
-	else if (curNode->child != nullptr && curNode->child->simpNode->index == vectorIndex)
-	{
-		simplexTreeNode<nodeType> *tempNode = curNode->child.get();
-		curNode->child = curNode->child->sibling;
-
-		//		for(auto d : simplexList){
-		//			if((*d.begin()) == tempNode) {
-		//                d.insert(d.begin(), tempNode->sibling);
-		//			}
-		//		}
-
-		deleteIndexRecurse(vectorIndex, tempNode);
-	}
-	else if (curNode->child != nullptr && curNode->child->simpNode->index > vectorIndex)
-	{
-		// If curNode->child->index < vectorIndex, the subtree rooted at curNode->child cannot contain vectorIndex.
-		deleteIndexRecurse(vectorIndex, curNode->child.get());
-	}
+	for (unsigned i = 0; i < pos; i++)
+		deleteIndexRecurse(vectorIndex, child(slot, i));
 
 	return;
 }
@@ -532,39 +557,21 @@ void simplexTree<nodeType>::deleteIndexRecurse(int vectorIndex, simplexTreeNode<
 template <typename nodeType>
 void simplexTree<nodeType>::insert()
 {
-	if (this->distMatrix->size() == 0)
+	if ((this->windowDistMatrix == nullptr || this->windowDistMatrix->size() == 0) && (this->distMatrix == nullptr || this->distMatrix->size() == 0))
 	{
 		this->ut.writeDebug("simplexTree", "Distance matrix is empty, skipping insertion");
 		return;
 	}
-	std::cout << "insert" << std::endl;
 
-	// Create our new node to insert (Ref Count = 1)
-	std::set<unsigned> simp({(unsigned)this->indexCounter});
-	;
-	simplexTreeNode_P insNode = std::make_shared<simplexTreeNode<nodeType>>(simp, 0);
-	insNode->simpNode->index = this->indexCounter;
+	// Check if this is the first node; if so, initialize the root (empty simplex)
+	if (nodes.empty())
+		nodes.emplace_back();
 
 	// Track this index in our current window (for sliding window)
-	this->runningVectorIndices.push_back(insNode->simpNode->index);
-
-	// Check if this is the first node (i.e. head)
-	//	If so, initialize the head node
-	if (root == nullptr)
-	{
-		root = std::make_shared<simplexTreeNode<nodeType>>();
-		insNode->parent = root.get();
-		root->child = insNode;
-		this->indexCounter++;
-		this->runningVectorCount++;
-		this->nodeCount++;
-
-		return;
-	}
+	this->runningVectorIndices.push_back(this->indexCounter);
+	this->runningVectorCount++;
 
-	// This needs to be a recursive span -> (or not!)
-	//		if the node has a child, recurse
-	//		if the node has a sibling, recurse
+	// Each simplex of the tree within maxEpsilon of the new point gains a child (coface) for it
 	//
 	// root            ({!})
 	//			       /
@@ -577,21 +584,11 @@ void simplexTree<nodeType>::insert()
 	//	        /           \
 	//d2 --> | 2 | 3 |     | 4 | 5 |
 	//
+	for (unsigned i = 0, n = nodes[0].childCount; i < n; i++)
+		recurseInsert(child(0, i), 0);
 
-	this->runningVectorCount++;
-	for (auto it = root->child.get(); it != nullptr; it = it->sibling.get())
-	{
-		recurseInsert(it, this->indexCounter, 0, 0, {(unsigned)this->indexCounter});
-	}
-
-	// Insert into the right of the tree
-	//  Child points to last child, and sibling points backwards
-	insNode->parent = root.get();
-	insNode->sibling = root->child;
-	root->child = insNode;
-
-	insNode->simpNode->hash = this->nodeCount;
-	this->nodeCount++;
+	// Insert the vertex itself at the right of the root's children
+	addChild(0, this->indexCounter, 0);
 	this->indexCounter++;
 }
 
@@ -628,138 +625,65 @@ int simplexTree<nodeType>::simplexCount()
 	return this->nodeCount;
 }
 
+
 template <typename nodeType>
 double simplexTree<nodeType>::getSize()
 {
-	// Size of node: [int + byte (*) + byte (*)] = 18 Bytes
-	return this->nodeCount * sizeof(nodeType);
-}
-
-// Search for a simplex from a node in the tree
-//   Commenting out for now, template is funked
+	// Size of the node and child pools and their free lists
+	double size = nodes.capacity() * sizeof(treeNode) + childPool.capacity() * sizeof(unsigned) + freeNodes.capacity() * sizeof(unsigned);
+	for (auto &sizeClass : freeBlocks)
+		size += sizeClass.capacity() * sizeof(unsigned);
 
-template <typename nodeType>
-simplexTree<nodeType>::simplexTreeNode<nodeType> *simplexTree<nodeType>::find(std::set<unsigned>::iterator begin, std::set<unsigned>::iterator end, std::shared_ptr<simplexTreeNode<nodeType>> curNode)
-{
-	auto a = curNode.get();
-	return find(begin, end, a);
+	// Plus any nodeTypes handed out, with their vertex sets
+	size += simplices.capacity() * sizeof(templateNode_P);
+	for (auto &simplex : simplices)
+		if (simplex != nullptr)
+			size += sizeof(nodeType) + simplex->simplex.size() * sizeof(unsigned);
+	return size;
 }
 
+// Flatten the tree into simplexList (one filtration per dimension) and return it
 template <typename nodeType>
-simplexTree<nodeType>::simplexTreeNode<nodeType> *simplexTree<nodeType>::find(std::set<unsigned>::iterator begin, std::set<unsigned>::iterator end, simplexTreeNode<nodeType> *curNode)
+const std::vector<typename simplexBase<nodeType>::filtration> &simplexTree<nodeType>::getAllEdges()
 {
-	auto it = begin;
-	simplexTreeNode<nodeType> *ret;
-
-	while (it != end)
-	{
-		simplexTreeNode<nodeType> *ptr;
-		for (ptr = curNode->child.get(); ptr != nullptr; ptr = ptr->sibling.get())
-		{
-			if (ptr->simpNode->index == (*it))
-			{
-				++it;
-				ret = ptr;
-				break;
-			}
-		}
-		if (ptr == nullptr)
-			return nullptr;
-	}
-
-	return ret;
-}
-
-template <typename nodeType>
-std::vector<std::set<std::shared_ptr<nodeType>, cmpByWeight<std::shared_ptr<nodeType>>>> simplexTree<nodeType>::getAllEdges()
-{
-	std::vector<std::set<std::shared_ptr<nodeType>, cmpByWeight<std::shared_ptr<nodeType>>>> ret(this->maxDimension + 1, std::set<std::shared_ptr<nodeType>, cmpByWeight<std::shared_ptr<nodeType>>>());
-	if (root != nullptr)
-		recurseGetEdges(ret, root, 0, this->maxDimension);
-	return ret;
+	this->simplexList.assign(this->maxDimension + 1, typename simplexBase<nodeType>::filtration());
+	if (!nodes.empty())
+		recurseGetEdges(this->simplexList, 0, this->maxDimension);
+	for (auto &dimList : this->simplexList)
+		dimList.seal();
+	return this->simplexList;
 }
 
 template <typename nodeType>
-void simplexTree<nodeType>::recurseGetEdges(std::vector<std::set<std::shared_ptr<nodeType>, cmpByWeight<std::shared_ptr<nodeType>>>> &edgeList, std::shared_ptr<simplexTreeNode<nodeType>> current, int depth, int maxDepth)
+void simplexTree<nodeType>::recurseGetEdges(std::vector<typename simplexBase<nodeType>::filtration> &edgeList, unsigned slot, int maxDepth)
 {
-	for (auto ptr = current->child; ptr != nullptr; ptr = ptr->sibling)
+	for (unsigned i = 0; i < nodes[slot].childCount; i++)
 	{
-		if (ptr->valid)
-			edgeList[depth].insert(ptr->simpNode);
+		unsigned c = child(slot, i);
+		edgeList[nodes[c].size - 1].insert(nodeAt(c));
 
-		if (ptr->child != nullptr && depth + 1 <= maxDepth)
-			recurseGetEdges(edgeList, ptr, depth + 1, maxDepth);
+		if (nodes[c].childCount > 0 && (int)nodes[c].size <= maxDepth)
+			recurseGetEdges(edgeList, c, maxDepth);
 	}
 	return;
 }
 
-/*
-template<typename nodeType>
-std::vector<std::shared_ptr<nodeType>> simplexTree<nodeType>::getAllCofacets(const std::set<unsigned>& simp, double simplexWeight, const std::unordered_map<std::shared_ptr<nodeType>, std::shared_ptr<nodeType>>& pivotPairs, bool checkEmergent){
-	// Needs rewrite for using std::set<unsigned>& simp instead of pointers
-
-	std::vector<templateNode_P> ret;
-	/*simplexTreeNode_P parentNode = find(simp->simplex.begin(), simp->simplex.end(), root);
-	if(parentNode == nullptr) return ret; //Simplex isn't in the simplex tree
-
-	simplexTreeNode_P tempNode;
-	auto it = simp->simplex.end();
-
-	while(true){
-		//Insert all of the children in reverse lexicographic order
-		for(auto ptr = parentNode->child; ptr != nullptr; ptr = ptr->sibling){
-			if(it == simp->simplex.end()) {
-					ret.push_back(ptr->simpNode.get()); //All children of simplex are cofacets
-			} else {
-				tempNode = find(it, simp->simplex.end(), ptr); //See if cofacet is in the tree
-				if(tempNode != nullptr&&ptr->valid){
-						ret.push_back(tempNode->simpNode.get());
-
-					//If we haven't found an emergent candidate and the weight of the maximal cofacet is equal to the simplex's weight
-					//		we have identified an emergent pair; at this point we can break because the interval is born and dies at the
-					//		same epsilon
-					if(checkEmergent && tempNode->simpNode->weight == simp->weight&& this->simplicialComplex != "alpha"){
-						if(pivotPairs.find(tempNode->simpNode->hash) == pivotPairs.end()) return ret; //Check to make sure the identified cofacet isn't a pivot
-						checkEmergent = false;
-					}
-				}
-			}
-		}
-		//Recurse backwards up the tree and try adding vertices at each level
-		--it;
-		if(parentNode->parent != nullptr) parentNode = parentNode->parent;
-		else break;
-	}
-
-	return ret;
-}*/
-
-
 template <typename nodeType>
 std::vector<std::shared_ptr<nodeType>> simplexTree<nodeType>::getAllFacets(std::shared_ptr<nodeType> simp)
 {
 	std::vector<templateNode_P> ret;
-	simplexTreeNode<nodeType> *parentNode = find(simp->simplex.begin(), simp->simplex.end(), root);
-	if (parentNode == nullptr)
-		return ret; // Simplex isn't in the simplex tree
+	if (simp->simplex.size() < 2 || findSlot(simp->simplex.begin(), simp->simplex.end()) == none)
+		return ret; // Simplex isn't in the simplex tree (or has no facets)
 
-	simplexTreeNode<nodeType> *tempNode;
-	auto it = simp->simplex.end();
-
-	while (true)
+	// Drop each vertex in turn, starting from the last
+	for (auto it = simp->simplex.rbegin(); it != simp->simplex.rend(); ++it)
 	{
-		--it;
-		if (parentNode != root.get())
-			parentNode = parentNode->parent;
-		else
-			break;
+		std::set<unsigned> facet = simp->simplex;
+		facet.erase(*it);
 
-		// Insert all of the children in reverse lexicographic order
-		tempNode = find(std::next(it), simp->simplex.end(), parentNode);
-		if (tempNode != nullptr && tempNode->valid)
-		{
-			ret.push_back(tempNode->simpNode);
-		}
+		unsigned slot = findSlot(facet.begin(), facet.end());
+		if (slot != none)
+			ret.push_back(nodeAt(slot));
 	}
 
 	return ret;
@@ -769,51 +693,50 @@ template <typename nodeType>
 std::vector<std::shared_ptr<nodeType>> simplexTree<nodeType>::getAllCofacets(const std::set<unsigned> &simplex, double simplexWeight, const std::unordered_map<std::shared_ptr<nodeType>, std::shared_ptr<nodeType>> &pivotPairs, bool checkEmergent)
 {
 	std::vector<templateNode_P> ret;
-	auto parentNode = find(simplex.begin(), simplex.end(), root);
-	// auto parentNode = parNode.get();
-	if (parentNode == nullptr)
+	unsigned parentSlot = findSlot(simplex.begin(), simplex.end());
+	if (simplex.empty() || parentSlot == none)
 		return ret; // Simplex isn't in the simplex tree
 
-	simplexTreeNode<nodeType> *tempNode;
-	std::cout << "simplexTree getAllCofacets" << std::endl;
+	// Walk back up the path of the simplex; below each prefix, a child whose vertex falls before the
+	//	next vertex of the simplex, followed by the remaining suffix, is a cofacet
 	auto it = simplex.end();
 	while (true)
 	{
 		// Insert all of the children in reverse lexicographic order
-		for (auto ptr = parentNode->child; ptr != nullptr; ptr = ptr->sibling)
+		for (unsigned i = nodes[parentSlot].childCount; i-- > 0;)
 		{
+			unsigned ptr = child(parentSlot, i);
 			if (it == simplex.end())
 			{
-				ret.push_back(ptr->simpNode); // All children of simplex are cofacets
+				ret.push_back(nodeAt(ptr)); // All children of simplex are cofacets
+				continue;
 			}
-			else
+			if (nodes[ptr].vertex >= *it)
+				continue;
+
+			unsigned tempSlot = findSlot(it, simplex.end(), ptr); // See if cofacet is in the tree
+			if (tempSlot != none)
 			{
+				auto tempNode = nodeAt(tempSlot);
+				ret.push_back(tempNode);
 
-				// TODO: Reimplement
-				tempNode = find(it, simplex.end(), ptr); // See if cofacet is in the tree
-				if (tempNode != nullptr)
+				// If we haven't found an emergent candidate and the weight of the maximal cofacet is equal to the simplex's weight
+				//		we have identified an emergent pair; at this point we can break because the interval is born and dies at the
+				//		same epsilon
+				if (checkEmergent && tempNode->weight == simplexWeight && this->simplicialComplex != "alpha")
 				{
-					ret.push_back(tempNode->simpNode);
-
-					// If we haven't found an emergent candidate and the weight of the maximal cofacet is equal to the simplex's weight
-					//		we have identified an emergent pair; at this point we can break because the interval is born and dies at the
-					//		same epsilon
-					if (checkEmergent && tempNode->simpNode->weight == simplexWeight && this->simplicialComplex != "alpha")
-					{
-						if (pivotPairs.find(tempNode->simpNode) == pivotPairs.end())
-							return ret; // Check to make sure the identified cofacet isn't a pivot
-						checkEmergent = false;
-					}
+					if (pivotPairs.find(tempNode) == pivotPairs.end())
+						return ret; // Check to make sure the identified cofacet isn't a pivot
+					checkEmergent = false;
 				}
 			}
 		}
 
 		// Recurse backwards up the tree and try adding vertices at each level
-		--it;
-		if (parentNode->parent != nullptr)
-			parentNode = parentNode->parent;
-		else
+		if (parentSlot == 0)
 			break;
+		--it;
+		parentSlot = nodes[parentSlot].parent;
 	}
 	return ret;
 }
@@ -961,10 +884,11 @@ validateNodes(root);*/
 }
 
 template <typename nodeType>
-std::pair<std::vector<std::set<unsigned>>, std::vector<std::set<unsigned>>> simplexTree<nodeType>::recurseReduce(simplexTreeNode_P simplex, std::vector<std::set<unsigned>> removals, std::vector<std::set<unsigned>> checked)
+std::pair<std::vector<std::set<unsigned>>, std::vector<std::set<unsigned>>> simplexTree<nodeType>::recurseReduce(unsigned slot, std::vector<std::set<unsigned>> removals, std::vector<std::set<unsigned>> checked)
 {
-	checked.push_back(simplex->simpNode->simplex);
-	auto subsets = this->ut.getSubsets(simplex->simpNode->simplex);
+	std::set<unsigned> simplex = simplexOf(slot);
+	checked.push_back(simplex);
+	auto subsets = this->ut.getSubsets(simplex);
 	std::set<unsigned> maxFace;
 
 	bool canRemove = true;
@@ -1010,61 +934,62 @@ std::pair<std::vector<std::set<unsigned>>, std::vector<std::set<unsigned>>> simp
 	return std::make_pair(removals, checked);
 }
 
+
 template <typename nodeType>
-bool simplexTree<nodeType>::find(std::set<unsigned>)
+bool simplexTree<nodeType>::find(std::set<unsigned> simplex)
 {
+	return lookupSlot(simplex) != none;
+}
 
-	this->ut.writeLog("simplexTree", "find(std::set<unsigned>) not implemented!");
-	return 0;
+template <typename nodeType>
+double simplexTree<nodeType>::findWeight(std::set<unsigned> simplex)
+{
+	unsigned slot = lookupSlot(simplex);
+	return slot != none ? nodes[slot].weight : -1;
 }
 
-// A recursive function to delete a simplex (and sub-branches) from the tree.
+// Delete a simplex and every simplex containing it from the tree.
 template <typename nodeType>
 bool simplexTree<nodeType>::deletion(std::set<unsigned> removalEntry)
 {
-	// Remove the entry in the simplex tree
-	//  bool found = true;
-	//  simplexNode_P curNode = (*simplexList[0].begin());
-	//  int d = removalEntry.size() - 1;
-
-	/*for(int i = 0; i < dimensions[d].size(); i++){
-		if(removalEntry == dimensions[d][i]->simplexSet){
-			curNode = dimensions[d][i];
-			dimensions[d]->erase(dimensions[d].begin() + i);
-			return deletion(curNode);
-		}
-	}*/
+	if (lookupSlot(removalEntry) == none)
+		return false;
 
-	this->ut.writeLog("simplexTree", "deletion(std::set<unsigned>) not implemented!");
-	return false;
+	deleteCofacesRecurse(0, removalEntry.begin(), removalEntry.end());
+	return true;
 }
 
-// A recursive function to delete a simplex (and sub-branches) from the tree.
+// Remove the subtrees below slot whose paths contain the vertices [it, end)
+//	The path to slot already holds the vertices of the simplex before it
 template <typename nodeType>
-bool simplexTree<nodeType>::deletion(simplexTreeNode<nodeType> *removalEntry)
+void simplexTree<nodeType>::deleteCofacesRecurse(unsigned slot, std::set<unsigned>::const_iterator it, std::set<unsigned>::const_iterator end)
 {
-	simplexTreeNode<nodeType> *curNode = removalEntry;
-
-	// Iterate each child and delete
-	/*auto it = curNode->children.begin();
-	while(it != curNode->children.end()){
-		deletion(*(it));
-		it++;
-	}
-	nodeCount--;*/
+	// Children are sorted by vertex and the vertices increase along a path, so only the children before *it
+	//	can still reach *it further down; the children after it cannot contain it
+	unsigned pos = childPosition(slot, *it);
 
-	// Remove from the simplex list
-	// simplexList[curNode->simplex.size() - 1].erase(simplexList[curNode->simplex.size() - 1].find(curNode));
+	for (unsigned i = 0; i < pos; i++)
+		deleteCofacesRecurse(child(slot, i), it, end);
 
-	// delete curNode;
-	return false;
+	if (pos < nodes[slot].childCount && nodes[child(slot, pos)].vertex == *it)
+	{
+		if (std::next(it) == end) // Every simplex below this child contains the removed simplex
+			removeChild(slot, pos);
+		else
+			deleteCofacesRecurse(child(slot, pos), std::next(it), end);
+	}
 }
 
 template <typename nodeType>
 void simplexTree<nodeType>::clear()
 {
 	// Clear the simplexTree structure
-	root = nullptr;
+	nodes.clear();
+	freeNodes.clear();
+	childPool.clear();
+	freeBlocks.clear();
+	simplices.clear();
+	slotIndex.clear();
 
 	this->simplexOffset = this->runningVectorCount;
 	this->runningVectorIndices.clear();
@@ -1077,5 +1002,6 @@ void simplexTree<nodeType>::clear()
 
 // Explicit Template Class Instantiation
 template class simplexTree<simplexNode>;
+template class simplexTree<wideSimplexNode>;
 template class simplexTree<alphaNode>;
 template class simplexTree<witnessNode>;
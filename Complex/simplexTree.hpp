@@ -4,6 +4,8 @@
 #include "kdTree.hpp"
 
 #include <set>
+#include <vector>
+#include <climits>
 #include <unordered_map>
 
 // Header file for simplexTree class - see simplexTree.cpp for descriptions
@@ -11,76 +13,68 @@
 template <class nodeType>
 class simplexTree : public simplexBase<nodeType>
 {
-private:
 public:
-    // SimplexTreeNode wraps a simplexNode and tree pointers; these are internal to the construction
-    //   The child holds the shared pointer. Free children and siblings to clear the tree.
-    template <typename nodetype>
-    struct simplexTreeNode
-    {
+    // Typedef for nodeType shared pointers handed out through the simplexBase interface
+    typedef std::shared_ptr<nodeType> templateNode_P;
 
-        struct cmpByIndex
-        {
-            bool operator()(const simplexTreeNode *lhs, const simplexTreeNode *rhs) const
-            {
-                return lhs->simpNode->index < rhs->simpNode->index;
-            }
-            bool operator()(const simplexTreeNode &lhs, const simplexTreeNode &rhs) const
-            {
-                return lhs.simpNode->index < rhs.simpNode->index;
-            }
-        };
-
-        std::shared_ptr<nodeType> simpNode;                           // SharedPtr to the nodeType
-        std::shared_ptr<simplexTreeNode<nodeType>> child = nullptr;   // SharedPtr to child
-        std::shared_ptr<simplexTreeNode<nodeType>> sibling = nullptr; // SharedPtr to sibling
-        simplexTreeNode *parent = nullptr;
-        std::set<simplexTreeNode *, cmpByIndex> children;
-        bool valid = true;
-
-        // SimplexNode Constructor Passthrough
-        template <typename U = nodeType, typename std::enable_if<std::is_same<U, simplexNode>::value, int>::type = 0>
-        simplexTreeNode() { simpNode = std::make_shared<nodeType>(simplexNode()); }
-
-        template <typename U = nodeType, typename std::enable_if<std::is_same<U, simplexNode>::value, int>::type = 0>
-        simplexTreeNode(std::set<unsigned> simp, double wt) { simpNode = std::make_shared<simplexNode>(simplexNode(simp, wt)); }
-
-        // AlphaNode Constructor Passthrough
-        template <typename U = nodeType, typename std::enable_if<std::is_same<U, alphaNode>::value, int>::type = 0>
-        simplexTreeNode() { simpNode = std::make_shared<alphaNode>(alphaNode()); }
-
-        template <typename U = nodeType, typename std::enable_if<std::is_same<U, alphaNode>::value, int>::type = 0>
-        simplexTreeNode(std::set<unsigned> simp, double wt) { simpNode = std::make_shared<alphaNode>(alphaNode(simp, wt)); }
-
-        // WitnessNode Constructor Passthrough
-        template <typename U = nodeType, typename std::enable_if<std::is_same<U, witnessNode>::value, int>::type = 0>
-        simplexTreeNode() { simpNode = std::make_shared<witnessNode>(witnessNode()); }
-
-        template <typename U = nodeType, typename std::enable_if<std::is_same<U, witnessNode>::value, int>::type = 0>
-        simplexTreeNode(std::set<unsigned> simp, double wt) { simpNode = std::make_shared<witnessNode>(witnessNode(simp, wt)); }
-    };
+private:
+    static const unsigned none = UINT_MAX; // Null slot
 
-    // Typedefs for nodeType shared pointers; simplexTreeNode_P is the tree structure, templateNode_P is the simplex node structure
-    typedef std::shared_ptr<simplexTreeNode<nodeType>> simplexTreeNode_P;
-    typedef std::shared_ptr<nodeType> templateNode_P;
-    simplexTreeNode_P root = nullptr; // Empty node at root of tree (empty simplex)
+    // A simplex of the tree, stored by value in the node pool. The vertices on the path from the root
+    //   spell the simplex; the children of a node are a contiguous block of childPool sorted by vertex.
+    struct treeNode
+    {
+        unsigned vertex = none;     // Last (largest) vertex of the simplex
+        unsigned parent = none;     // Slot of the simplex without its last vertex
+        unsigned childOffset = 0;   // Start of the child block in childPool
+        unsigned childCount = 0;    // Child slots in use
+        unsigned childCapacity = 0; // Size of the child block (0 or a power of two)
+        unsigned size = 0;          // Number of vertices in the simplex
+        double weight = 0;
+    };
 
-    // Presumably private functions (Not implemented in simplexBase)
-    struct simplexTreeNode<nodeType> *find(std::set<unsigned>::iterator, std::set<unsigned>::iterator, simplexTreeNode_P);
-    struct simplexTreeNode<nodeType> *find(std::set<unsigned>::iterator, std::set<unsigned>::iterator, simplexTreeNode<nodeType> *);
+    std::vector<treeNode> nodes;                   // Node pool; slot 0 is the root (empty simplex)
+    std::vector<unsigned> freeNodes;               // Released slots, reused before the pool grows
+    std::vector<unsigned> childPool;               // Sibling arrays of child slots
+    std::vector<std::vector<unsigned>> freeBlocks; // Released child blocks, by log2 of their capacity
+    std::vector<templateNode_P> simplices;         // nodeType of a slot, built on demand for the simplexBase interface
+
+    // Combinatorial hash -> slot of each simplex size (hashes only identify a simplex within one size);
+    //   find/findWeight/deletion look simplices up here instead of walking down the tree
+    std::vector<std::unordered_map<simplexKey, unsigned, indexHash>> slotIndex;
+
+    unsigned child(unsigned slot, unsigned i) const { return childPool[nodes[slot].childOffset + i]; }
+    unsigned childPosition(unsigned slot, unsigned vertex) const;
+    unsigned findChild(unsigned slot, unsigned vertex) const;
+    unsigned allocateBlock(unsigned capacity);
+    void releaseBlock(unsigned offset, unsigned capacity);
+    unsigned addChild(unsigned slot, unsigned vertex, double weight);
+    void removeChild(unsigned slot, unsigned position);
+    void freeSubtree(unsigned slot);
+    void deleteCofacesRecurse(unsigned slot, std::set<unsigned>::const_iterator, std::set<unsigned>::const_iterator);
+
+    double insertDistance(unsigned vertex);
+    std::set<unsigned> simplexOf(unsigned slot) const;
+    templateNode_P nodeAt(unsigned slot);
+    unsigned findSlot(std::set<unsigned>::const_iterator, std::set<unsigned>::const_iterator, unsigned = 0) const;
+
+    static simplexKey binomial(unsigned, unsigned);
+    simplexKey slotHash(unsigned slot) const;
+    unsigned lookupSlot(const std::set<unsigned> &) const;
 
-    std::vector<std::set<templateNode_P, cmpByWeight<templateNode_P>>> getAllEdges();
-    void recurseGetEdges(std::vector<std::set<templateNode_P, cmpByWeight<templateNode_P>>> &, simplexTreeNode_P, int, int);
+public:
+    const std::vector<typename simplexBase<nodeType>::filtration> &getAllEdges();
+    void recurseGetEdges(std::vector<typename simplexBase<nodeType>::filtration> &, unsigned, int);
 
     // Constructors
     simplexTree(double, int);
 
-    std::pair<std::vector<std::set<unsigned>>, std::vector<std::set<unsigned>>> recurseReduce(simplexTreeNode_P, std::vector<std::set<unsigned>>, std::vector<std::set<unsigned>>);
-    void printTree(simplexTreeNode_P);
-    void printTree1(simplexTreeNode_P);
-    void recurseInsert(simplexTreeNode<nodeType> *, unsigned, int, double, std::set<unsigned>);
+    std::pair<std::vector<std::set<unsigned>>, std::vector<std::set<unsigned>>> recurseReduce(unsigned, std::vector<std::set<unsigned>>, std::vector<std::set<unsigned>>);
+    void printTree(unsigned);
+    void printTree1(unsigned);
+    void recurseInsert(unsigned, double);
     double findWeight(std::set<unsigned>);
-    void deleteIndexRecurse(int, simplexTreeNode<nodeType> *);
+    void deleteIndexRecurse(int, unsigned);
     void deleteWeightEdgeGraph(int index);
 
     // virtual interface functions
@@ -106,24 +100,17 @@ public:
     void expandDimensions(int) { return; };
     std::vector<templateNode_P> expandDimension(std::vector<templateNode_P> edges) { return std::vector<templateNode_P>(); };
 
-    // void reduceComplex();
-
     std::vector<templateNode_P> getAllCofacets(const std::set<unsigned> &, double, const std::unordered_map<templateNode_P, templateNode_P> &, bool);
-    std::vector<nodeType *> getAllCofacets(templateNode_P, const std::unordered_map<long long, templateNode_P> &, bool) { return std::vector<nodeType *>(); };
+    std::vector<nodeType *> getAllCofacets(templateNode_P, const std::unordered_map<simplexKey, templateNode_P, indexHash> &, bool) { return std::vector<nodeType *>(); };
     std::vector<templateNode_P> getAllCofacets(const std::set<unsigned> &) { return std::vector<templateNode_P>(); };
 
     std::vector<nodeType *> getAllFacets(nodeType *) { return std::vector<nodeType *>(); };
     std::vector<templateNode_P> getAllFacets(templateNode_P);
 
-    // Commenting out for now - not sure if the first argument type is what we want to use
-
-    // std::vector<std::set<simplexNode_P, cmpByWeight>> getAllEdges();
-
-    void recurseInsertDsimplex(simplexTreeNode_P node, std::vector<int> simp, std::vector<std::vector<double>> inputData);
+    void recurseInsertDsimplex(unsigned slot, std::vector<int> simp, std::vector<std::vector<double>> inputData);
     void buildAlphaComplex(std::vector<std::vector<int>> dsimplexmesh, int npts, std::vector<std::vector<double>> inputData);
-    void validateNodes(simplexTreeNode_P headPointer);
+    void validateNodes(unsigned slot);
     bool deletion(std::set<unsigned>);
-    bool deletion(simplexTreeNode<nodeType> *);
     void graphInducedComplex(int dim, std::vector<std::vector<double>> inputData, double beta) { return; };
 
     void reduceComplex();
@@ -0,0 +1,210 @@
+#include <string>
+#include <vector>
+#include <set>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include "sparseRipsComplex.hpp"
+#include "kdTree.hpp"
+
+template <typename nodeType>
+sparseRipsComplex<nodeType>::sparseRipsComplex(double maxE, double maxD) : simplexArrayList<nodeType>::simplexArrayList(maxE, maxD)
+{
+	/**
+	sparseRipsComplex(double maxE, double maxD)
+
+	@brief Initializes the sparse Rips complex
+	@tparam nodeType The data type of the simplex node.
+	@param maxE The max epsilon limit for complex construction.
+	@param maxD The max dimension limit for complex construction.
+*/
+	this->simplexType = "sparseRips";
+}
+
+template <typename nodeType>
+void sparseRipsComplex<nodeType>::greedyPermutation(const std::vector<std::vector<double>> &points)
+{
+	/**
+	greedyPermutation(const std::vector<std::vector<double>> &points)
+
+	@brief Orders the points by farthest point sampling, starting from point 0. The insertion radius of a point is its
+		distance to the points placed before it (infinite for the first); the radii are non-increasing along the permutation.
+	@tparam nodeType The data type of the simplex node.
+	@param points The point cloud.
+*/
+	auto [order, radii] = utils::maxminLandmarks(points, points.size());
+	permutation = std::move(order);
+
+	insertionRadius.assign(points.size(), std::numeric_limits<double>::infinity());
+	for (size_t i = 0; i < permutation.size(); i++)
+		insertionRadius[permutation[i]] = radii[i];
+}
+
+template <typename nodeType>
+double sparseRipsComplex<nodeType>::relaxedWeight(double lambda, double alpha) const
+{
+	/**
+	relaxedWeight(double lambda, double alpha)
+
+	@brief Weight added to the distances of a point with insertion radius lambda at scale alpha. Zero until lambda / sparsity,
+		then growing to lambda / (1 - sparsity) at lambda / (sparsity (1 - sparsity)), where the point leaves the filtration.
+	@tparam nodeType The data type of the simplex node.
+	@param lambda Insertion radius of the point.
+	@param alpha Scale (radius) of the filtration.
+	@return double
+*/
+	if (alpha <= lambda / sparsity)
+		return 0;
+	if (alpha <= lambda / (sparsity * (1 - sparsity)))
+		return alpha - lambda / sparsity;
+	return sparsity * alpha;
+}
+
+template <typename nodeType>
+double sparseRipsComplex<nodeType>::edgeBirth(double dist, double lambdaP, double lambdaQ) const
+{
+	/**
+	edgeBirth(double dist, double lambdaP, double lambdaQ)
+
+	@brief Smallest scale alpha at which dist + relaxedWeight(p) + relaxedWeight(q) <= 2 alpha. The reach 2 alpha - weights is
+		piecewise linear and non-decreasing with breakpoints where either weight changes phase, so the segment holding dist is
+		found by walking the breakpoints and interpolated exactly.
+	@tparam nodeType The data type of the simplex node.
+	@param dist Distance between the points.
+	@param lambdaP Insertion radius of the first point.
+	@param lambdaQ Insertion radius of the second point.
+	@return double The scale (radius) the edge enters the filtration at.
+*/
+	auto reach = [&](double alpha)
+	{ return 2 * alpha - relaxedWeight(lambdaP, alpha) - relaxedWeight(lambdaQ, alpha); };
+
+	if (dist <= 0)
+		return 0;
+
+	double breaks[4] = {lambdaP / sparsity, lambdaP / (sparsity * (1 - sparsity)), lambdaQ / sparsity, lambdaQ / (sparsity * (1 - sparsity))};
+	std::sort(breaks, breaks + 4);
+
+	double prev = 0, prevReach = 0;
+	for (double b : breaks)
+	{
+		if (std::isinf(b))
+			break;
+		if (b <= prev)
+			continue;
+
+		double r = reach(b);
+		if (r >= dist)
+			return prev + (dist - prevReach) * (b - prev) / (r - prevReach);
+		prev = b;
+		prevReach = r;
+	}
+
+	// Past the last breakpoint the weights of the (finite radius) points grow as sparsity * alpha
+	double slope = 2 - (std::isinf(lambdaP) ? 0 : sparsity) - (std::isinf(lambdaQ) ? 0 : sparsity);
+	return prev + (dist - prevReach) / slope;
+}
+
+template <typename nodeType>
+void sparseRipsComplex<nodeType>::buildSparseRips(const std::vector<std::vector<double>> &points, double eps)
+{
+	/**
+	buildSparseRips(const std::vector<std::vector<double>> &points, double eps)
+
+	@brief Builds the edges of the sparse Rips filtration into the neighborhood graph of the complex. An edge (p, q), q later
+		in the greedy permutation, is kept if it is born before q leaves the filtration; it is weighted by twice its birth
+		scale so unperturbed edges keep their Rips (diameter) weight. Candidates for q come from a kdTree radius query
+		bounded by its lifetime, so only O(n) edges are ever examined for a doubling metric. The graph also records the
+		weight each vertex leaves the filtration at, which bounds the weight of the simplices expanded from its edges.
+	@tparam nodeType The data type of the simplex node.
+	@param points The point cloud.
+	@param eps Approximation parameter of the sparse filtration, in (0, 1).
+*/
+	if (!(eps > 0 && eps < 1))
+	{
+		this->ut.writeLog(this->simplexType, "Sparsity must be in (0, 1); using 0.5");
+		eps = 0.5;
+	}
+	sparsity = eps;
+	greedyPermutation(points);
+
+	const size_t n = points.size();
+	std::vector<unsigned> rank(n);
+	for (unsigned i = 0; i < n; i++)
+		rank[permutation[i]] = i;
+
+	kdTree tree(points, n);
+	std::vector<std::vector<neighborGraph::edge>> found(n);
+
+#pragma omp parallel for schedule(dynamic, 64)
+	for (size_t q = 0; q < n; q++)
+	{
+		if (std::isinf(insertionRadius[q]))
+			continue;
+
+		const double death = insertionRadius[q] / (sparsity * (1 - sparsity)); // Scale q leaves the filtration at
+		for (size_t p : tree.neighborhoodIndices(points[q], std::min(2 * death, this->maxEpsilon)))
+		{
+			if (rank[p] >= rank[q])
+				continue;
+
+			double sq = 0;
+			for (size_t k = 0; k < points[q].size(); k++)
+				sq += (points[p][k] - points[q][k]) * (points[p][k] - points[q][k]);
+
+			double birth = edgeBirth(std::sqrt(sq), insertionRadius[p], insertionRadius[q]);
+			if (birth <= death && 2 * birth <= this->maxEpsilon)
+				found[q].push_back({(unsigned)p, (unsigned)q, 2 * birth});
+		}
+	}
+
+	std::vector<neighborGraph::edge> edges;
+	for (auto &adj : found)
+	{
+		edges.insert(edges.end(), adj.begin(), adj.end());
+		std::vector<neighborGraph::edge>().swap(adj);
+	}
+
+	sparseGraph.build(n, edges);
+
+	// A simplex whose edges all survive still leaves the filtration with its first vertex to die -> the graph carries the
+	//	(diameter-scale) deaths, and the flag expansions reject simplices heavier than the death of one of their vertices
+	std::vector<double> deaths(n);
+	for (size_t q = 0; q < n; q++)
+		deaths[q] = 2 * insertionRadius[q] / (sparsity * (1 - sparsity));
+	sparseGraph.setDeaths(std::move(deaths));
+	this->neighGraph = &sparseGraph;
+
+	this->ut.writeDebug("sparseRips", "\tSparse filtration: " + std::to_string(n) + " vertices, " + std::to_string(edges.size()) + " edges (sparsity " + std::to_string(sparsity) + ")");
+}
+
+template <typename nodeType>
+double sparseRipsComplex<nodeType>::getSize()
+{
+	/**
+	getSize()
+
+	@brief Size of the complex in bytes, including the sparse graph and the permutation.
+	@tparam nodeType The data type of the simplex node.
+	@return double
+*/
+	return simplexArrayList<nodeType>::getSize() + sparseGraph.getSize() + permutation.size() * (sizeof(unsigned) + sizeof(double));
+}
+
+template <typename nodeType>
+sparseRipsComplex<nodeType>::~sparseRipsComplex()
+{
+	/**
+	~sparseRipsComplex()
+
+	@brief Destructs the sparse Rips complex and frees used memory.
+	@tparam nodeType The data type of the simplex node.
+*/
+	this->simplexList.clear();
+}
+
+// Explicit Template Class Instantiation
+template class sparseRipsComplex<simplexNode>;
+template class sparseRipsComplex<wideSimplexNode>;
+template class sparseRipsComplex<alphaNode>;
+template class sparseRipsComplex<witnessNode>;
@@ -0,0 +1,41 @@
+#pragma once
+#include <set>
+#include <vector>
+#include "simplexArrayList.hpp"
+#include "neighborGraph.hpp"
+
+// Header file for sparseRipsComplex class - see sparseRipsComplex.cpp for descriptions
+
+/**
+ * @brief Sparse Vietoris-Rips complex (Sheehy, "Linear-Size Approximations to the Vietoris-Rips Filtration")
+ *
+ * Points are ordered by a greedy (farthest point) permutation; a point is relaxed out of the filtration
+ * once the scale passes its insertion radius over sparsity * (1 - sparsity). The edges that survive,
+ * with their perturbed weights, form a neighborhood graph of linear size whose flag complex is a
+ * (1 + O(sparsity))-approximation of the Rips filtration; it is expanded like any simplexArrayList, except that a
+ * simplex is dropped once its weight passes the death of one of its vertices.
+ */
+template <typename nodeType>
+class sparseRipsComplex : public simplexArrayList<nodeType>
+{
+	typedef std::shared_ptr<nodeType> templateNode_P;
+
+private:
+	neighborGraph sparseGraph; // Edges of the sparse filtration, weighted by their (diameter-scale) birth
+
+	double relaxedWeight(double, double) const;
+	double edgeBirth(double, double, double) const;
+
+public:
+	double sparsity = 0.5;					  // Approximation parameter epsilon of the sparse filtration, in (0, 1)
+	std::vector<unsigned> permutation;		  // Greedy permutation of the points
+	std::vector<double> insertionRadius;	  // Distance of each point to the points before it in the permutation
+
+	sparseRipsComplex(double, double);
+
+	void greedyPermutation(const std::vector<std::vector<double>> &);
+	void buildSparseRips(const std::vector<std::vector<double>> &, double);
+
+	double getSize();
+	~sparseRipsComplex();
+};
@@ -1,11 +1,11 @@
 #include <string>
 #include <vector>
 #include <set>
-#include <math.h>
+#include <cmath>
 #include <algorithm>
+#include <type_traits>
 #include "witnessComplex.hpp"
-
-// Yanxio , Yanlin and  Jisun are working on witness complex and will post there code here.
+#include "omp.h"
 
 template <typename nodeType>
 witnessComplex<nodeType>::witnessComplex(double maxE, double maxD) : simplexArrayList<nodeType>::simplexArrayList(0, 0)
@@ -18,14 +18,178 @@ witnessComplex<nodeType>::witnessComplex(double maxE, double maxD) : simplexArra
 	@param maxE The max epsilon limit for complex construction.
 	@param maxD The max dimension limit for complex construction.
 */
-
-	std::cout << "Constructed Witness Complex!" << std::endl;
-
 	this->simplexType = "witnessComplex";
 	this->maxEpsilon = maxE;
 	this->maxDimension = maxD;
 }
 
+template <typename nodeType>
+void witnessComplex<nodeType>::selectLandmarks(const std::vector<std::vector<double>> &points, size_t count)
+{
+	/**
+	selectLandmarks(const std::vector<std::vector<double>> &points, size_t count)
+
+	@brief Picks count landmarks by maxmin selection (see utils::maxminLandmarks).
+	@tparam nodeType The data type of the simplex node.
+	@param points The point cloud.
+	@param count Number of landmarks.
+*/
+	auto [selected, radii] = utils::maxminLandmarks(points, std::max<size_t>(count, 1));
+	landmarks = std::move(selected);
+	landmarkRadius = std::move(radii);
+}
+
+template <typename nodeType>
+void witnessComplex<nodeType>::buildWitnessComplex(const std::vector<std::vector<double>> &points, size_t count, unsigned relaxation)
+{
+	/**
+	buildWitnessComplex(const std::vector<std::vector<double>> &points, size_t count, unsigned relaxation)
+
+	@brief Builds the lazy witness complex: selects the landmarks, inserts them as the vertices and stores the witnessed
+		edges as the neighborhood graph of the complex. Witnesses are processed in blocks of blockSize points across
+		threads; each block computes its distances to the landmarks only, so memory stays at threads x blockSize x landmarks
+		rather than n^2. A witness only reaches the landmarks within m_nu(w) + maxEpsilon of it, and each thread keeps the
+		earliest weight of the edges it saw before they are merged.
+	@tparam nodeType The data type of the simplex node.
+	@param points The point cloud; every point is a witness.
+	@param count Number of landmarks.
+	@param relaxation nu, the nearest landmark distance subtracted from each witness (0, 1 or 2 typically).
+*/
+	nu = relaxation;
+	selectLandmarks(points, count);
+
+	const size_t n = points.size(), m = landmarks.size();
+	if (n == 0)
+		return;
+	const size_t dim = points[0].size();
+	const double maxE = this->maxEpsilon;
+
+	// Pack the landmarks into a contiguous buffer for the distance blocks
+	std::vector<double> landmarkCoords(m * dim);
+	for (size_t l = 0; l < m; l++)
+		std::copy(points[landmarks[l]].begin(), points[landmarks[l]].end(), landmarkCoords.begin() + l * dim);
+
+	nearestLandmark.assign(n, 0);
+	std::vector<std::unordered_map<unsigned long long, double>> witnessed(omp_get_max_threads());
+
+#pragma omp parallel
+	{
+		auto &found = witnessed[omp_get_thread_num()];
+		std::vector<double> block;
+		std::vector<std::pair<double, unsigned>> near(m);
+
+#pragma omp for schedule(dynamic, 1)
+		for (size_t start = 0; start < n; start += blockSize)
+		{
+			const size_t end = std::min(n, start + blockSize);
+
+			// Distances from this block of witnesses to every landmark
+			block.resize((end - start) * m);
+			for (size_t w = start; w < end; w++)
+			{
+				const double *a = points[w].data();
+				for (size_t l = 0; l < m; l++)
+				{
+					const double *b = landmarkCoords.data() + l * dim;
+					double sq = 0;
+#pragma omp simd reduction(+ : sq)
+					for (size_t k = 0; k < dim; k++)
+						sq += (a[k] - b[k]) * (a[k] - b[k]);
+					block[(w - start) * m + l] = std::sqrt(sq);
+				}
+			}
+
+			for (size_t w = start; w < end; w++)
+			{
+				const double *dist = block.data() + (w - start) * m;
+				for (unsigned l = 0; l < m; l++)
+					near[l] = {dist[l], l};
+
+				nearestLandmark[w] = std::min_element(near.begin(), near.end())->second;
+
+				// m_nu(w) -> distance to the nu-th nearest landmark
+				double relax = 0;
+				if (nu > 0)
+				{
+					auto nth = near.begin() + std::min<size_t>(nu, m) - 1;
+					std::nth_element(near.begin(), nth, near.end());
+					relax = nth->first;
+				}
+
+				// Landmarks close enough to witness an edge below maxEpsilon, nearest first
+				auto reach = std::partition(near.begin(), near.end(), [&](const std::pair<double, unsigned> &x)
+											{ return x.first - relax <= maxE; });
+				std::sort(near.begin(), reach);
+
+				for (auto j = near.begin() + 1; j < reach; ++j)
+				{
+					const double weight = std::max(0.0, j->first - relax);
+					for (auto i = near.begin(); i != j; ++i)
+					{
+						unsigned long long key = (unsigned long long)std::min(i->second, j->second) * m + std::max(i->second, j->second);
+						auto [it, inserted] = found.try_emplace(key, weight);
+						if (!inserted && weight < it->second)
+							it->second = weight;
+					}
+				}
+			}
+		}
+	}
+
+	// Merge the edges seen by each thread, keeping the earliest witness
+	auto &edgeMap = witnessed[0];
+	for (size_t t = 1; t < witnessed.size(); t++)
+	{
+		for (auto &[key, weight] : witnessed[t])
+		{
+			auto [it, inserted] = edgeMap.try_emplace(key, weight);
+			if (!inserted && weight < it->second)
+				it->second = weight;
+		}
+		std::unordered_map<unsigned long long, double>().swap(witnessed[t]);
+	}
+
+	std::vector<neighborGraph::edge> edges;
+	edges.reserve(edgeMap.size());
+	for (auto &[key, weight] : edgeMap)
+		edges.push_back({(unsigned)(key / m), (unsigned)(key % m), weight});
+	std::unordered_map<unsigned long long, double>().swap(edgeMap);
+
+	witnessGraph.build(m, edges);
+	this->neighGraph = &witnessGraph;
+
+	// The landmarks are the vertices of the complex
+	for (size_t l = 0; l < m; l++)
+		this->insert();
+
+	if constexpr (std::is_same_v<nodeType, witnessNode>)
+	{ // Record the landmark coordinates and the points each landmark is nearest to
+		std::vector<templateNode_P> vertices(m);
+		for (auto &vertex : this->simplexList[0])
+			vertices[*vertex->simplex.begin()] = vertex;
+
+		for (size_t l = 0; l < m; l++)
+			vertices[l]->landmarkPt = points[landmarks[l]];
+		for (size_t w = 0; w < n; w++)
+			vertices[nearestLandmark[w]]->witnessPts.insert(w);
+	}
+
+	this->ut.writeDebug("witnessComplex", "\tWitness complex: " + std::to_string(m) + " landmarks, " + std::to_string(n) + " witnesses, " + std::to_string(edges.size()) + " edges (nu " + std::to_string(nu) + ")");
+}
+
+template <typename nodeType>
+double witnessComplex<nodeType>::getSize()
+{
+	/**
+	getSize()
+
+	@brief Size of the complex in bytes, including the witnessed edges and the landmark bookkeeping.
+	@tparam nodeType The data type of the simplex node.
+	@return double
+*/
+	return simplexArrayList<nodeType>::getSize() + witnessGraph.getSize() + landmarks.size() * (sizeof(unsigned) + sizeof(double)) + nearestLandmark.size() * sizeof(unsigned);
+}
+
 template <typename nodeType>
 witnessComplex<nodeType>::~witnessComplex()
 {
@@ -40,5 +204,6 @@ witnessComplex<nodeType>::~witnessComplex()
 
 // Explicit Template Class Instantiation
 template class witnessComplex<simplexNode>;
+template class witnessComplex<wideSimplexNode>;
 template class witnessComplex<alphaNode>;
 template class witnessComplex<witnessNode>;
@@ -1,29 +1,41 @@
-
 #pragma once
 #include <set>
+#include <vector>
 #include <unordered_map>
 #include "simplexArrayList.hpp"
+#include "neighborGraph.hpp"
+
+// Header file for witnessComplex class - see witnessComplex.cpp for descriptions
 
+/**
+ * @brief Lazy witness complex (de Silva and Carlsson) on maxmin landmarks
+ *
+ * The vertices are landmarks picked from the point cloud by maxmin selection; vertex i is point landmarks[i].
+ * Every point witnesses an edge (a, b) from max(d(a, w), d(b, w)) - m_nu(w), where m_nu(w) is the distance from w
+ * to its nu-th nearest landmark (0 for nu = 0), and the edge weight is the earliest such value over the witnesses.
+ * Higher simplices are the flag complex of these edges, expanded like any simplexArrayList.
+ */
 template <typename nodeType>
 class witnessComplex : public simplexArrayList<nodeType>
 {
 	typedef std::shared_ptr<nodeType> templateNode_P;
 
 private:
+	neighborGraph witnessGraph; // Witnessed edges between the landmarks
+
+	static const size_t blockSize = 256; // Witnesses per block of the landmark x witness distances handed to a thread
+
 public:
+	unsigned nu = 2;					   // Witness relaxation -> distance to the nu-th nearest landmark is subtracted
+	std::vector<unsigned> landmarks;	   // Point of each landmark, in maxmin order
+	std::vector<double> landmarkRadius;	   // Maxmin insertion radius of each landmark
+	std::vector<unsigned> nearestLandmark; // Closest landmark to each point
+
 	witnessComplex(double, double);
 
-	// virtual interface functions
-	// double getSize();
-	// void insert();
-	// bool find(std::set<unsigned>);
-	// int simplexCount();
-	// int vertexCount();
-	// void prepareCofacets(int);
-	// void prepareFacets(int);
-	// std::vector<templateNode_P> getAllCofacets(const std::set<unsigned>&, double, const std::unordered_map<templateNode_P, templateNode_P>&, bool = true);
-	// bool deletion(std::set<unsigned>);
-	// void expandDimensions(int);
+	void selectLandmarks(const std::vector<std::vector<double>> &, size_t);
+	void buildWitnessComplex(const std::vector<std::vector<double>> &, size_t, unsigned);
 
+	double getSize();
 	~witnessComplex();
 };
@@ -989,8 +989,8 @@ extern "C"
 		std::vector<std::vector<double>> *l_workData;
 		std::vector<unsigned> *l_centroidLabels;
 		std::vector<std::vector<double>> *l_inputData;
-		std::vector<std::vector<double>> *l_distMatrix;
-		std::vector<std::vector<bool>> *l_incidenceMatrix;
+		distanceMatrix *l_distMatrix;
+		bitMatrix *l_incidenceMatrix;
 		std::vector<std::set<unsigned>> *l_boundaries;
 
 		if (args["nodeType"] == "alphaNode")
@@ -1021,6 +1021,20 @@ extern "C"
 			l_incidenceMatrix = &ret->incidenceMatrix;
 			l_boundaries = &ret->boundaries;
 		}
+		else if (wideKeys(data.size(), std::stoi(args["dimensions"])))
+		{ // Simplex hashes of this many points outgrow 64 bits
+			auto ret = processpyLHFWrapper<wideSimplexNode>(args, data);
+			l_bettiTable = &ret->bettiTable;
+			l_ident = &ret->ident;
+			l_stats = &ret->stats;
+			l_runLog = &ret->runLog;
+			l_workData = &ret->workData;
+			l_centroidLabels = &ret->centroidLabels;
+			l_inputData = &ret->inputData;
+			l_distMatrix = &ret->distMatrix;
+			l_incidenceMatrix = &ret->incidenceMatrix;
+			l_boundaries = &ret->boundaries;
+		}
 		else
 		{
 			auto ret = processpyLHFWrapper<simplexNode>(args, data);
@@ -1086,8 +1100,10 @@ extern "C"
 
 		std::for_each(l_inputData->begin(), l_inputData->end(), [inputData_retStruct](const auto &row) mutable
 					  { inputData_retStruct = std::copy(row.begin(), row.end(), inputData_retStruct); });
-		std::for_each(l_distMatrix->begin(), l_distMatrix->end(), [distMatrix_retStruct](const auto &row) mutable
-					  { distMatrix_retStruct = std::copy(row.begin(), row.end(), distMatrix_retStruct); });
+		// Expand the condensed distance matrix into the square (upper triangular) layout expected by the caller
+		for (size_t i = 0; i < l_distMatrix->size(); i++)
+			for (size_t j = 0; j < l_distMatrix->size(); j++)
+				distMatrix_retStruct[i * l_distMatrix->size() + j] = (j > i) ? (*l_distMatrix)(i, j) : 0;
 		std::for_each(l_workData->begin(), l_workData->end(), [workData_retStruct](const auto &row) mutable
 					  { workData_retStruct = std::copy(row.begin(), row.end(), workData_retStruct); });
 		centroidLabels_retStruct = l_centroidLabels->data();
@@ -35,6 +35,7 @@ public:
 
 // Explicit Template Class Instantiation
 template class LHF<simplexNode>;
+template class LHF<wideSimplexNode>;
 template class LHF<alphaNode>;
 template class LHF<witnessNode>;
 
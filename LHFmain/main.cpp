@@ -9,19 +9,14 @@
 #include <string>
 
 template <typename nodeType>
-void runLHF(pipePacket<nodeType> &wD, std::map<std::string, std::string> &args, int &argc, char *argv[])
+void runLHF(pipePacket<nodeType> &wD, std::vector<std::vector<double>> &inputData, std::map<std::string, std::string> &args, int &argc, char *argv[])
 {
 
 	// Define external classes used for reading input, parsing arguments, writing output
 	auto lhflib = LHF<nodeType>();
-	auto rs = readInput();
 
-	if (args["pipeline"] != "slidingwindow" && args["pipeline"] != "naivewindow" && args["mode"] != "mpi")
-	{
-		// Read data from inputFile CSV
-		wD.inputData = rs.readCSV(args["inputFile"]);
-		wD.workData = wD.inputData;
-	}
+	wD.inputData = inputData;
+	wD.workData = wD.inputData;
 
 	// If data was found in the inputFile
 	if (wD.inputData.size() > 0 || args["pipeline"] == "slidingwindow" || args["pipeline"] == "naivewindow" || args["mode"] == "mpi")
@@ -114,25 +109,36 @@ int main(int argc, char *argv[])
 	// Determine what pipe we will be running
 	argParser::setPipeline(args);
 
+	// Read data from inputFile CSV
+	std::vector<std::vector<double>> inputData;
+	if (args["pipeline"] != "slidingwindow" && args["pipeline"] != "naivewindow" && args["mode"] != "mpi")
+		inputData = readInput().readCSV(args["inputFile"]);
+
 	// Create a pipePacket (datatype) to store the complex and pass between engines
 
-	if (args["nodeType"] == "simplexNode")
+	if (args["nodeType"] == "simplexNode" && wideKeys(inputData.size(), std::stoi(args["dimensions"])))
+	{ // Simplex hashes of this many points outgrow 64 bits
+		auto wD = pipePacket<wideSimplexNode>(args, args["complexType"]); // wD (workingData)
+
+		runLHF(wD, inputData, args, argc, argv);
+	}
+	else if (args["nodeType"] == "simplexNode")
 	{
 		auto wD = pipePacket<simplexNode>(args, args["complexType"]); // wD (workingData)
 
-		runLHF(wD, args, argc, argv);
+		runLHF(wD, inputData, args, argc, argv);
 	}
 	else if (args["nodeType"] == "alphaNode")
 	{
 		auto wD = pipePacket<alphaNode>(args, args["complexType"]); // wD (workingData)
 
-		runLHF(wD, args, argc, argv);
+		runLHF(wD, inputData, args, argc, argv);
 	}
 	else if (args["nodeType"] == "witnessNode")
 	{
 		auto wD = pipePacket<witnessNode>(args, args["complexType"]); // wD (workingData)
 
-		runLHF(wD, args, argc, argv);
+		runLHF(wD, inputData, args, argc, argv);
 	}
 
 	// delete wD.complex;
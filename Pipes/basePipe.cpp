@@ -12,6 +12,9 @@
 #include "basePipe.hpp"
 #include "distMatrixPipe.hpp"
 #include "neighGraphPipe.hpp"
+#include "sparseNeighGraphPipe.hpp"
+#include "sparseRipsPipe.hpp"
+#include "witnessPipe.hpp"
 #include "incrementalPersistence.hpp"
 #include "fastPersistence.hpp"
 #include "ripsPipe.hpp"
@@ -48,6 +51,18 @@ basePipe<nodeType> *basePipe<nodeType>::newPipe(const std::string &pipeType, con
 	{
 		return new neighGraphPipe<nodeType>();
 	}
+	else if (pipeType == "sparseNeighGraph")
+	{
+		return new sparseNeighGraphPipe<nodeType>();
+	}
+	else if (pipeType == "sparseRips")
+	{
+		return new sparseRipsPipe<nodeType>();
+	}
+	else if (pipeType == "witness")
+	{
+		return new witnessPipe<nodeType>();
+	}
 	else if (pipeType == "incrementalPersistence" || pipeType == "inc")
 	{
 		return new incrementalPersistence<nodeType>();
@@ -244,5 +259,6 @@ bool basePipe<nodeType>::configPipe(std::map<std::string, std::string> &configMa
 
 // Explicit Template Class Instantiation
 template class basePipe<simplexNode>;
+template class basePipe<wideSimplexNode>;
 template class basePipe<alphaNode>;
 template class basePipe<witnessNode>;
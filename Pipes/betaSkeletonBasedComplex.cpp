@@ -15,7 +15,9 @@
 #include <functional>
 #include <set>
 #include <algorithm>
+#include <limits>
 #include "betaSkeletonBasedComplex.hpp"
+#include "geometryKernels.hpp"
 #include "alphaComplex.hpp"
 #include "qhullPipe.hpp"
 #include "utils.hpp"
@@ -69,7 +71,7 @@ void betaSkeletonBasedComplex<nodeType>::runPipe(pipePacket<nodeType> &inData)
 	for (int x = 0; x < inData.inputData.size(); x++)
 		for (int y = x + 1; y < inData.inputData.size(); y++)
 		{
-			distanceSum += (*((alphaComplex<nodeType> *)inData.complex)->distMatrix)[x][y];
+			distanceSum += (*((alphaComplex<nodeType> *)inData.complex)->distMatrix)(x, y);
 			count = count + 1;
 		}
 	double averageDistance = distanceSum / count;
@@ -231,7 +233,7 @@ void betaSkeletonBasedComplex<nodeType>::runPipe(pipePacket<nodeType> &inData)
 	//	((alphaComplex<nodeType>*)inData.complex)->buildAlphaComplex(dsimplexmesh,inData.inputData.size(),inData.inputData);
 	//	((alphaComplex<nodeType>*)inData.complex)->buildFilteration(dsimplexmesh,inData.inputData.size(),inData.inputData,this->beta);
 	//        ((alphaComplex<nodeType>*)inData.complex)->buildBetaComplexFilteration(dsimplexmesh, inData.inputData.size(),inData.inputData, tree);
-	std::vector<std::vector<bool>> incidenceMatrix(inData.inputData.size(), std::vector<bool>(inData.inputData.size(), 0));
+	bitMatrix incidenceMatrix(inData.inputData.size());
 	int countd1 = 0;
 	for (auto x : dsimplexmesh)
 	{
@@ -240,14 +242,14 @@ void betaSkeletonBasedComplex<nodeType>::runPipe(pipePacket<nodeType> &inData)
 			{
 				int origin = x[i];
 				int destination = x[j];
-				if (incidenceMatrix[origin][destination] != true)
+				if (!incidenceMatrix.test(origin, destination))
 					countd1++;
-				incidenceMatrix[origin][destination] = true;
+				incidenceMatrix.set(origin, destination);
 			}
 	}
 
 	// std::cout<<"Edges ="<<countd1<<" ";
-	inData.incidenceMatrix = incidenceMatrix;
+	inData.incidenceMatrix = std::move(incidenceMatrix);
 	std::ofstream file("PHdSphereDimensionWiseMeshSize.txt", std::ios_base::app);
 	file << this->betaMode << "," << inData.inputData.size() << "," << inData.inputData[0].size() << "," << this->beta << "," << dsimplexmesh.size() << std::endl;
 	file.close();
@@ -453,20 +455,7 @@ int betaSkeletonBasedComplex<alphaNode>::getoppvertex(std::vector<unsigned> simp
 		face1 = simplex;
 		face1.erase(std::remove(face1.begin(), face1.end(), x), face1.end());
 		std::set<unsigned> face(face1.begin(), face1.end());
-		std::vector<double> faceCC;
-		if (face.size() > 2)
-			faceCC = utils::circumCenter(face, inputData);
-		else if (face.size() == 2)
-		{
-			auto first = face.begin();
-			std::vector<double> fR;
-			std::vector<double> fA = inputData[*first];
-			std::advance(first, 1);
-			std::vector<double> fB = inputData[*first];
-			std::transform(fA.begin(), fA.end(), fB.begin(), std::back_inserter(fR), [](double e1, double e2)
-						   { return ((e1 + e2) / 2); });
-			faceCC = fR;
-		}
+		std::vector<double> faceCC = geometryKernels::circumCenter(face, inputData);
 		if (mindist > utils::vectors_distance(faceCC, circumCenter))
 			oppvertex = x;
 	}
@@ -478,8 +467,8 @@ bool betaSkeletonBasedComplex<alphaNode>::checkInsertDsimplex(std::vector<unsign
 	double maxEdge = 0;
 	for (auto x : dsimplex)
 		for (auto y : dsimplex)
-			if (maxEdge < inData.distMatrix[x][y])
-				maxEdge = inData.distMatrix[x][y];
+			if (maxEdge < inData.distMatrix(x, y))
+				maxEdge = inData.distMatrix(x, y);
 
 	if (maxEdge > this->epsilon)
 		return false;
@@ -524,7 +513,7 @@ bool betaSkeletonBasedComplex<alphaNode>::checkInsertDsimplex(std::vector<unsign
 			if(simplex.size()>2)
 				circumRadius = utils::circumRadius(simplex,((alphaComplex<alphaNode>*)inData.complex)->distMatrix);
 			else
-				circumRadius = pow(inData.distMatrix[dsimplex[0]][dsimplex[1]]/2,2);
+				circumRadius = pow(inData.distMatrix(dsimplex[0], dsimplex[1])/2,2);
 			bool first = true;
 
 			std::vector<size_t> neighbors;
@@ -551,7 +540,7 @@ bool betaSkeletonBasedComplex<alphaNode>::checkInsertDsimplex(std::vector<unsign
 				if(face.size()>2)
 					faceRadius = utils::circumRadius(face,((alphaComplex<alphaNode>*)inData.complex)->distMatrix);
 				else
-					faceRadius = pow(inData.distMatrix[face1[0]][face1[1]]/2,2);
+					faceRadius = pow(inData.distMatrix(face1[0], face1[1])/2,2);
 
 				std::vector<double> hpcoff = utils::nullSpaceOfMatrix(face,inData.inputData,faceCC,sqrt(faceRadius));
 				std::vector<double> betaCenter;
@@ -715,26 +704,9 @@ bool betaSkeletonBasedComplex<alphaNode>::checkInsertDsimplex(std::vector<unsign
 		if (beta < 1)
 			beta = 1 / beta;
 		std::set<unsigned> simplex(dsimplex.begin(), dsimplex.end());
-		std::vector<double> circumCenter;
-		if (simplex.size() > 2)
-			circumCenter = utils::circumCenter(simplex, inData.inputData);
-		else if (simplex.size() == 2)
-		{
-			auto first = simplex.begin();
-			std::vector<double> R;
-			std::vector<double> A = inData.inputData[*first];
-			std::advance(first, 1);
-			std::vector<double> B = inData.inputData[*first];
-			std::transform(A.begin(), A.end(), B.begin(), std::back_inserter(R), [](double e1, double e2)
-						   { return ((e1 + e2) / 2); });
-			circumCenter = R;
-		}
+		std::vector<double> circumCenter = geometryKernels::circumCenter(simplex, inData.inputData);
 
-		double circumRadius;
-		if (simplex.size() > 2)
-			circumRadius = utils::circumRadius(simplex, &inData.distMatrix);
-		else
-			circumRadius = pow(inData.distMatrix[dsimplex[0]][dsimplex[1]] / 2, 2);
+		double circumRadius = utils::circumRadius(simplex, &inData.distMatrix);
 		bool first = true;
 
 		bool obtuse = false;
@@ -744,33 +716,29 @@ bool betaSkeletonBasedComplex<alphaNode>::checkInsertDsimplex(std::vector<unsign
 		{
 			CCfacingfacet = getoppvertex(dsimplex, inData.inputData, circumCenter);
 		}
+		// Circumspheres of the facets in one batch; facet k omits the k-th vertex of the simplex
+		const size_t dim = inData.inputData[0].size();
+		std::vector<unsigned> facets;
+		for (auto x : simplex)
+			for (auto y : simplex)
+				if (y != x)
+					facets.push_back(y);
+		std::vector<double> facetCenters, facetRadii;
+		geometryKernels::circumCenters(facets, simplex.size() - 1, inData.inputData, facetCenters);
+		geometryKernels::circumRadii(facets, simplex.size() - 1, inData.distMatrix, facetRadii);
+		size_t facet = 0;
+
 		std::vector<size_t> neighbors;
 		std::vector<std::vector<size_t>> neighborsCircleIntersection;
 		for (auto x : simplex)
 		{
+			const size_t k = facet++;
 			std::vector<unsigned> face1;
 			face1 = dsimplex;
 			face1.erase(std::remove(face1.begin(), face1.end(), x), face1.end());
 			std::set<unsigned> face(face1.begin(), face1.end());
-			std::vector<double> faceCC;
-			if (face.size() > 2)
-				faceCC = utils::circumCenter(face, inData.inputData);
-			else if (face.size() == 2)
-			{
-				auto first = face.begin();
-				std::vector<double> fR;
-				std::vector<double> fA = inData.inputData[*first];
-				std::advance(first, 1);
-				std::vector<double> fB = inData.inputData[*first];
-				std::transform(fA.begin(), fA.end(), fB.begin(), std::back_inserter(fR), [](double e1, double e2)
-							   { return ((e1 + e2) / 2); });
-				faceCC = fR;
-			}
-			double faceRadius;
-			if (face.size() > 2)
-				faceRadius = utils::circumRadius(face, &inData.distMatrix);
-			else
-				faceRadius = pow((inData.distMatrix[face1[0]][face1[1]] / 2), 2);
+			std::vector<double> faceCC(facetCenters.begin() + k * dim, facetCenters.begin() + (k + 1) * dim);
+			double faceRadius = facetRadii[k] < 0 ? std::numeric_limits<double>::max() : facetRadii[k];
 			auto result = utils::nullSpaceOfMatrix(face, inData.inputData, faceCC, sqrt(faceRadius));
 			std::vector<double> hpcoff = result.first;
 			std::vector<std::vector<double>> refbetaCenters;
@@ -859,24 +827,8 @@ bool betaSkeletonBasedComplex<alphaNode>::checkInsertDsimplex(std::vector<unsign
 		std::vector<double> circumCenter;
 		std::vector<double> circumCenterfaces;
 		std::vector<double> circumCenterfaces1;
-		if (simplex.size() > 2)
-			circumCenter = utils::circumCenter(simplex, inData.inputData);
-		else if (simplex.size() == 2)
-		{
-			auto first = simplex.begin();
-			std::vector<double> R;
-			std::vector<double> A = inData.inputData[*first];
-			std::advance(first, 1);
-			std::vector<double> B = inData.inputData[*first];
-			std::transform(A.begin(), A.end(), B.begin(), std::back_inserter(R), [](double e1, double e2)
-						   { return ((e1 + e2) / 2); });
-			circumCenter = R;
-		}
-		double circumRadius;
-		if (simplex.size() > 2)
-			circumRadius = utils::circumRadius(simplex, &inData.distMatrix);
-		else
-			circumRadius = pow(inData.distMatrix[dsimplex[0]][dsimplex[1]] / 2, 2);
+		circumCenter = geometryKernels::circumCenter(simplex, inData.inputData);
+		double circumRadius = utils::circumRadius(simplex, &inData.distMatrix);
 		bool first = true;
 		for (auto x : simplex)
 		{
@@ -1002,5 +954,6 @@ bool betaSkeletonBasedComplex<nodeType>::checkInsertDsimplex(std::vector<unsigne
 }
 
 template class betaSkeletonBasedComplex<simplexNode>;
+template class betaSkeletonBasedComplex<wideSimplexNode>;
 template class betaSkeletonBasedComplex<alphaNode>;
 template class betaSkeletonBasedComplex<witnessNode>;
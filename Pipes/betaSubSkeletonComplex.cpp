@@ -48,7 +48,7 @@ void betaSubSkeletonComplex<nodeType>::runPipe(pipePacket<nodeType> &inData)
 	for (int x = 0; x < inData.inputData.size(); x++)
 		for (int y = x + 1; y < inData.inputData.size(); y++)
 		{
-			distanceSum += (*((alphaComplex<nodeType> *)inData.complex)->distMatrix)[x][y];
+			distanceSum += (*((alphaComplex<nodeType> *)inData.complex)->distMatrix)(x, y);
 			count = count + 1;
 		}
 	double averageDistance = distanceSum / count;
@@ -170,7 +170,7 @@ void betaSubSkeletonComplex<nodeType>::runPipe(pipePacket<nodeType> &inData)
 	//	((alphaComplex<nodeType>*)inData.complex)->buildAlphaComplex(dsimplexmesh,inData.inputData.size(),inData.inputData);
 	//	((alphaComplex<nodeType>*)inData.complex)->buildFilteration(dsimplexmesh,inData.inputData.size(),inData.inputData,this->beta);
 	//        ((alphaComplex<nodeType>*)inData.complex)->buildBetaComplexFilteration(dsimplexmesh, inData.inputData.size(),inData.inputData, tree);
-	std::vector<std::vector<bool>> incidenceMatrix(inData.inputData.size(), std::vector<bool>(inData.inputData.size(), 0));
+	bitMatrix incidenceMatrix(inData.inputData.size());
 	int countd1 = 0;
 	for (auto x : dsimplexmesh)
 	{
@@ -179,14 +179,14 @@ void betaSubSkeletonComplex<nodeType>::runPipe(pipePacket<nodeType> &inData)
 			{
 				int origin = x[i];
 				int destination = x[j];
-				if (incidenceMatrix[origin][destination] != true)
+				if (!incidenceMatrix.test(origin, destination))
 					countd1++;
-				incidenceMatrix[origin][destination] = true;
+				incidenceMatrix.set(origin, destination);
 			}
 	}
 
 	// std::cout<<"Edges ="<<countd1<<" ";
-	inData.incidenceMatrix = incidenceMatrix;
+	inData.incidenceMatrix = std::move(incidenceMatrix);
 	std::ofstream file("PHdSphereDimensionWiseMeshSize.txt", std::ios_base::app);
 	file << this->betaMode << "," << inData.inputData.size() << "," << inData.inputData[0].size() << "," << this->beta << "," << dsimplexmesh.size() << std::endl;
 	file.close();
@@ -200,8 +200,8 @@ bool betaSubSkeletonComplex<alphaNode>::checkInsertSubDsimplex(std::vector<unsig
 	double maxEdge = 0;
 	for (auto x : dsimplex)
 		for (auto y : dsimplex)
-			if (maxEdge < inData.distMatrix[x][y])
-				maxEdge = inData.distMatrix[x][y];
+			if (maxEdge < inData.distMatrix(x, y))
+				maxEdge = inData.distMatrix(x, y);
 
 	if (maxEdge > this->epsilon)
 		return false;
@@ -407,5 +407,6 @@ bool betaSubSkeletonComplex<nodeType>::checkInsertSubDsimplex(std::vector<unsign
 }
 
 template class betaSubSkeletonComplex<simplexNode>;
+template class betaSubSkeletonComplex<wideSimplexNode>;
 template class betaSubSkeletonComplex<alphaNode>;
 template class betaSubSkeletonComplex<witnessNode>;
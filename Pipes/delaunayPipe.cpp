@@ -1,6 +1,6 @@
 #include <CGAL/config.h>
 #include <CGAL/Epick_d.h>
-#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Delaunay_triangulation.h>
 #include "delaunayPipe.hpp"
 #include "alphaComplex.hpp"
 #include "utils.hpp"
@@ -15,10 +15,16 @@ delaunayPipe<nodeType>::delaunayPipe()
   return;
 }
 
-std::vector<std::vector<unsigned>> qdelaunay_o(std::vector<std::vector<double>> &inputData)
+/**
+ * @brief Delaunay triangulation of the input with CGAL's dynamic-dimension kernel.
+ *
+ * @param inputData The point cloud.
+ * @param cells Output; the vertex indices of the finite cells, stored back to back.
+ * @return unsigned Vertices per cell; the affine dimension of the cloud plus one.
+ */
+unsigned qdelaunay_o(const std::vector<std::vector<double>> &inputData, std::vector<unsigned> &cells)
 {
   int dim = inputData[0].size();
-  // typedef CGAL::Delaunay_triangulation<CGAL::Epick_d<CGAL::Dimension_tag<7>>> T;
   typedef CGAL::Delaunay_triangulation<CGAL::Epick_d<CGAL::Dynamic_dimension_tag>> T;
   T dt(dim);
   std::vector<T::Point> points;
@@ -32,23 +38,24 @@ std::vector<std::vector<unsigned>> qdelaunay_o(std::vector<std::vector<double>>
   }
   dt.insert(points.begin(), points.end());
   points.clear();
-  size_t number_of_finite_full_cell = dt.number_of_finite_full_cells();
-  std::vector<std::vector<unsigned>> dsimplexes(number_of_finite_full_cell, std::vector<unsigned>(dim + 1));
-#pragma omp parallel for
-  for (int j = 0; j <= dim; ++j)
-  {
-    auto i = dt.finite_full_cells_begin();
-    for (size_t k = 0; k < number_of_finite_full_cell; k++)
-      dsimplexes[k][j] = index_of_vertex[(i++)->vertex(j)->point()];
-  }
-  return dsimplexes;
+
+  // A degenerate cloud spans fewer than dim dimensions, and its full cells have fewer than dim + 1 vertices
+  const unsigned cellSize = dt.current_dimension() + 1;
+  cells.resize(dt.number_of_finite_full_cells() * cellSize);
+  auto out = cells.begin();
+  for (auto c = dt.finite_full_cells_begin(); c != dt.finite_full_cells_end(); ++c)
+    for (unsigned j = 0; j < cellSize; j++)
+      *out++ = index_of_vertex[c->vertex(j)->point()];
+  return cellSize;
 }
+
 // runPipe -> Run the configured functions of this pipeline segment
 template <typename nodeType>
 void delaunayPipe<nodeType>::runPipe(pipePacket<nodeType> &inData)
 {
-  ((alphaComplex<alphaNode> *)inData.complex)->dsimplexmesh = qdelaunay_o(inData.inputData);
-  ((alphaComplex<nodeType> *)inData.complex)->buildAlphaComplex(inData.complex->dsimplexmesh, inData.inputData.size(), inData.inputData);
+  auto complex = (alphaComplex<nodeType> *)inData.complex;
+  complex->delaunayCellSize = qdelaunay_o(inData.inputData, complex->delaunayCells);
+  complex->buildAlphaComplex(complex->delaunayCells, complex->delaunayCellSize, inData.inputData.size(), inData.inputData);
   return;
 }
 
@@ -82,19 +89,20 @@ void delaunayPipe<nodeType>::outputData(pipePacket<nodeType> &inData)
   std::ofstream file;
   file.open("output/" + this->pipeType + "_output.csv");
   // code to print the data
-  for (const auto &simplex : inData.complex->dsimplexmesh)
+  auto complex = (alphaComplex<nodeType> *)inData.complex;
+  const unsigned cellSize = complex->delaunayCellSize;
+  for (size_t c = 0; cellSize != 0 && c < complex->delaunayCells.size(); c += cellSize)
   {
-    if (simplex.empty())
-      continue;
-    for (size_t i = 0; i < simplex.size() - 1; i++)
-      file << simplex[i] << ",";
-    file << simplex.back() << "\n";
+    for (size_t i = 0; i < cellSize - 1; i++)
+      file << complex->delaunayCells[c + i] << ",";
+    file << complex->delaunayCells[c + cellSize - 1] << "\n";
   }
-  
+
   file.close();
   return;
 }
 
 template class delaunayPipe<simplexNode>;
+template class delaunayPipe<wideSimplexNode>;
 template class delaunayPipe<alphaNode>;
 template class delaunayPipe<witnessNode>;
\ No newline at end of file
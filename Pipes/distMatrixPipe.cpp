@@ -41,28 +41,8 @@ void distMatrixPipe<nodeType>::runPipe(pipePacket<nodeType> &inData)
 		@tparam nodeType The data type of the simplex node.
 		@param inData The pipePacket data being used in the pipeline.
 	*/
-	if (inData.distMatrix.size() > 0)
-		inData.distMatrix.clear();
-	inData.distMatrix.resize(inData.workData.size(), std::vector<double>(inData.workData.size(), 0));
-
-	for (unsigned i = 0; i < inData.workData.size(); i++)
-	{
-		for (unsigned j = i + 1; j < inData.workData.size(); j++)
-		{
-			// Vector distance between i, j
-			inData.distMatrix[i][j] = this->ut.vectors_distance(inData.workData[i], inData.workData[j]);
-		}
-	}
-
-	for (unsigned i = 0; i < inData.workData.size(); i++)
-	{
-		double r_i = 0;
-
-		for (unsigned j = 0; j < inData.workData.size(); j++)
-			r_i = std::max(r_i, inData.distMatrix[std::min(i, j)][std::max(i, j)]);
-
-		enclosingRadius = std::min(enclosingRadius, r_i);
-	}
+	// Distances and the enclosing radius are computed in one blocked, parallel pass
+	enclosingRadius = std::min(enclosingRadius, inData.distMatrix.build(inData.workData));
 
 	if (inData.complex->complexType == "betaComplex" && (this->betaMode == "lune" || this->betaMode == "circle"))
 		inData.incidenceMatrix = this->ut.betaNeighbors(inData.inputData, beta, betaMode);
@@ -134,11 +114,11 @@ void distMatrixPipe<nodeType>::outputData(pipePacket<nodeType> &inData)
 	std::ofstream file;
 	file.open("output/" + this->pipeType + "_output.csv");
 
-	for (std::vector<double> a : inData.distMatrix)
+	for (unsigned i = 0; i < inData.distMatrix.size(); i++)
 	{
-		for (auto d : a)
+		for (unsigned j = 0; j < inData.distMatrix.size(); j++)
 		{
-			file << d << ",";
+			file << (j > i ? inData.distMatrix(i, j) : 0) << ",";
 		}
 		file << "\n";
 	}
@@ -149,5 +129,6 @@ void distMatrixPipe<nodeType>::outputData(pipePacket<nodeType> &inData)
 
 // Explicit Template Class Instantiation
 template class distMatrixPipe<simplexNode>;
+template class distMatrixPipe<wideSimplexNode>;
 template class distMatrixPipe<alphaNode>;
 template class distMatrixPipe<witnessNode>;
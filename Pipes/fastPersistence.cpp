@@ -43,11 +43,12 @@ std::vector<simplexNodePointer> fastPersistence<nodeType>::persistenceByDimensio
 		simplexNodePointer simplex = (*columnIndexIter); // The current simplex
 
 		// Not a pivot -> need to reduce
-		if (it == pivots.end() || (*it)->weight != simplex->weight || (*it)->simplex != simplex->simplex)
+		if (it == pivots.end() || (*it)->weight != simplex->weight || !sameSimplex(*it, simplex))
 		{
 			//	std::cout<<mode<<" "<<simplicialComplex<<" "<<complexType<<std::endl;
 			// Get all cofacets using emergent pair optimization
-			std::vector<simplexNodePointer> faceList = (mode == "homology" ? inData.complex->getAllFacets(simplex) : (inData.complex->simplexType == "alphaComplex" ? inData.complex->getAllCofacets(simplex) : inData.complex->getAllCofacets(simplex->simplex, simplex->weight, pivotPairs, true)));
+			std::vector<simplexNodePointer> faceList;
+			columnFaces(inData, simplex, dimension, mode, pivotPairs, true, faceList);
 
 			std::vector<simplexNodePointer> columnV; // Reduction column of matrix V
 			columnV.push_back(simplex);				 // Initially V=I -> 1's along diagonal
@@ -106,7 +107,7 @@ std::vector<simplexNodePointer> fastPersistence<nodeType>::persistenceByDimensio
 
 					if (recordIntervals && simplex->weight != pivot->weight)
 					{
-						bettiBoundaryTableEntry des = {dimension, std::min(pivot->weight, simplex->weight), std::max(pivot->weight, simplex->weight), this->ut.extractBoundaryPoints(v[simplex])};
+						bettiBoundaryTableEntry des = {dimension, std::min(pivot->weight, simplex->weight), std::max(pivot->weight, simplex->weight), boundaryPoints(v[simplex], mode == "homology" ? dimension + 1 : dimension)};
 						/*
 						if(inData.complex->simplexType=="alphaComplex"){
 						std::vector<double> centroid(inData.inputData[0].size());
@@ -139,7 +140,144 @@ std::vector<simplexNodePointer> fastPersistence<nodeType>::persistenceByDimensio
 					for (simplexNodePointer simp : v[pivotPairs[pivot]])
 					{
 						columnV.push_back(simp);
-						std::vector<simplexNodePointer> faces = (mode == "homology" ? inData.complex->getAllFacets(simp) : (inData.complex->simplexType == "alphaComplex" ? inData.complex->getAllCofacets(simp) : inData.complex->getAllCofacets(simp->simplex)));
+						columnFaces(inData, simp, dimension, mode, pivotPairs, false, faceList);
+					}
+					std::make_heap(faceList.begin(), faceList.end(), compStruct);
+				}
+			}
+			// Was a pivot, skip the evaluation and queue next pivot
+		}
+		else
+			++it;
+	}
+
+	return nextPivots;
+}
+
+// columnFaces -> Append the faces of a column to faces: facets for homology, cofacets for cohomology (emergent pairs end the
+//	enumeration early when checkEmergent is set)
+template <class nodeType>
+void fastPersistence<nodeType>::columnFaces(pipePacket<nodeType> &inData, const templateNode_P &simplex, unsigned, const std::string &mode, const std::unordered_map<templateNode_P, templateNode_P> &pivotPairs, bool checkEmergent, std::vector<templateNode_P> &faces)
+{
+	std::vector<templateNode_P> ret = (mode == "homology" ? inData.complex->getAllFacets(simplex) : (inData.complex->simplexType == "alphaComplex" ? inData.complex->getAllCofacets(simplex) : inData.complex->getAllCofacets(simplex->simplex, simplex->weight, pivotPairs, checkEmergent)));
+	faces.insert(faces.end(), ret.begin(), ret.end());
+}
+
+// Flat records -> the faces are looked up in the dimension indexed by prepareFlat; homology columns are the
+//	(dimension + 1)-simplex pivots of the cohomology pass
+template <class nodeType>
+template <unsigned maxVertices>
+void fastPersistence<nodeType>::columnFaces(pipePacket<nodeType> &inData, flatRecord<maxVertices> *simplex, unsigned dimension, const std::string &mode, const std::unordered_map<flatRecord<maxVertices> *, flatRecord<maxVertices> *> &pivotPairs, bool checkEmergent, std::vector<flatRecord<maxVertices> *> &faces)
+{
+	simplexArrayList<nodeType> *complex = (simplexArrayList<nodeType> *)inData.complex;
+	if (mode == "homology")
+		complex->getAllFacets(*simplex, dimension + 1, faces);
+	else
+		complex->getAllCofacets(*simplex, dimension, pivotPairs, checkEmergent, faces);
+}
+
+// implicitByDimension -> Ripser-style cohomology reduction over implicit simplices
+//	Columns, cofacets and V entries are (diameter, index) pairs; vertices are only recovered to report boundary points
+template <class nodeType>
+template <typename index>
+std::vector<typename fastPersistence<nodeType>::template implicitNode<index>> fastPersistence<nodeType>::implicitByDimension(pipePacket<nodeType> &inData, simplexArrayList<nodeType> *complex, std::vector<implicitNode<index>> &columns, std::vector<implicitNode<index>> pivots, unsigned dimension)
+{
+	sortImplicit compStruct;
+	std::sort(columns.begin(), columns.end(), compStruct);
+	std::sort(pivots.begin(), pivots.end(), compStruct);
+	typename std::vector<implicitNode<index>>::iterator it = pivots.begin();
+
+	std::vector<implicitNode<index>> nextPivots;					   // Pivots for the next dimension
+	std::unordered_map<index, std::vector<implicitNode<index>>, indexHash> v; // Store only the reduction matrix V and compute R implicity
+	std::unordered_map<index, index, indexHash> pivotPairs;					   // For each pivot index, which column has that pivot
+
+	// Iterate over columns to reduce in reverse order
+	for (auto &simplex : columns)
+	{
+		// Not a pivot -> need to reduce
+		if (it == pivots.end() || it->second != simplex.second)
+		{
+			// Get all cofacets using emergent pair optimization
+			std::vector<implicitNode<index>> faceList = complex->getAllCofacets(simplex, dimension, pivotPairs, true);
+
+			std::vector<implicitNode<index>> columnV; // Reduction column of matrix V
+			columnV.push_back(simplex);		   // Initially V=I -> 1's along diagonal
+
+			// Build a heap using the coface list to reduce and store in V
+			std::make_heap(faceList.begin(), faceList.end(), compStruct);
+
+			while (true)
+			{
+				implicitNode<index> pivot;
+
+				while (!faceList.empty())
+				{
+					pivot = faceList.front();
+
+					// Rotate the heap
+					std::pop_heap(faceList.begin(), faceList.end(), compStruct);
+					faceList.pop_back();
+
+					if (!faceList.empty() && pivot.second == faceList.front().second)
+					{ // Coface is in twice -> evaluates to 0 mod 2
+
+						// Rotate the heap
+						std::pop_heap(faceList.begin(), faceList.end(), compStruct);
+						faceList.pop_back();
+					}
+					else
+					{
+						faceList.push_back(pivot);
+						std::push_heap(faceList.begin(), faceList.end(), compStruct);
+						break;
+					}
+				}
+
+				if (faceList.empty())
+				{ // Column completely reduced
+					break;
+				}
+
+				auto pivotPair = pivotPairs.find(pivot.second);
+				if (pivotPair == pivotPairs.end())
+				{ // Column cannot be reduced
+					pivotPairs.insert({pivot.second, simplex.second});
+					nextPivots.push_back(pivot);
+
+					std::sort(columnV.begin(), columnV.end(), compStruct);
+					auto it = columnV.begin();
+					while (it != columnV.end())
+					{
+						if ((it + 1) != columnV.end() && it->second == (it + 1)->second)
+							++it;
+						else
+							v[simplex.second].push_back(*it);
+						++it;
+					}
+
+					if (simplex.first != pivot.first)
+					{
+						// Vertices were never stored -> recover them from the indices for the boundary points
+						std::set<unsigned> boundaryPoints;
+						for (auto &simp : v[simplex.second])
+						{
+							std::set<unsigned> vertices = complex->getVertices(simp.second, dimension, complex->vertexCount());
+							boundaryPoints.insert(vertices.begin(), vertices.end());
+						}
+
+						bettiBoundaryTableEntry des = {dimension, std::min(pivot.first, simplex.first), std::max(pivot.first, simplex.first), boundaryPoints};
+						inData.bettiTable.push_back(des);
+					}
+
+					break;
+				}
+				else
+				{
+					// Reduce the column of R by computing the appropriate columns of D by enumerating cofacets
+					for (auto &simp : v[pivotPair->second])
+					{
+						columnV.push_back(simp);
+						std::vector<implicitNode<index>> faces = complex->getAllCofacets(simp, dimension, pivotPairs, false);
 						faceList.insert(faceList.end(), faces.begin(), faces.end());
 					}
 					std::make_heap(faceList.begin(), faceList.end(), compStruct);
@@ -154,6 +292,63 @@ std::vector<simplexNodePointer> fastPersistence<nodeType>::persistenceByDimensio
 	return nextPivots;
 }
 
+// implicitPersistence -> Reduce each dimension of an implicit complex, starting from the edges and the dim 0 pivots
+template <class nodeType>
+template <typename index>
+void fastPersistence<nodeType>::implicitPersistence(pipePacket<nodeType> &inData, simplexArrayList<nodeType> *complex, const std::vector<templateNode_P> &pivots)
+{
+	std::vector<implicitNode<index>> simplices, implicitPivots;
+	for (auto &edge : complex->getDimEdges(1))
+		simplices.push_back({edge->weight, (index)edge->hash});
+	for (auto &pivot : pivots)
+		implicitPivots.push_back({pivot->weight, (index)pivot->hash});
+
+	for (unsigned d = 1; d < static_cast<unsigned>(dim) && !simplices.empty(); d++)
+	{
+		if (d != 1)
+			simplices = complex->expandDimension(simplices, d);
+
+		implicitPivots = implicitByDimension(inData, complex, simplices, implicitPivots, d);
+	}
+}
+
+// flatPersistence -> Reduce each dimension of a complex in flat storage, starting from the edges and the dim 0 pivots
+//	Each dimension is expanded from the previous one into an array in the arena of the complex when it is needed as
+//	cofacets, and the whole complex is freed at once by releasing the arena
+template <class nodeType>
+template <unsigned maxVertices>
+void fastPersistence<nodeType>::flatPersistence(pipePacket<nodeType> &inData, simplexArrayList<nodeType> *complex, const std::vector<templateNode_P> &pivots)
+{
+	const auto &edges = complex->getDimEdges(1);
+	std::vector<flatDimension<maxVertices>> simplices = {{}, complex->template flatten<maxVertices>({edges.begin(), edges.end()})};
+
+	// The dim 0 pivots are edge nodes -> their records in the flat edges
+	std::vector<flatRecord<maxVertices> *> flatPivots;
+	complex->prepareFlat(simplices[1]);
+	for (auto &pivot : pivots)
+		flatPivots.push_back(complex->template findFlat<maxVertices>(pivot->hash));
+
+	for (unsigned d = 1; d < static_cast<unsigned>(dim) && !simplices[d].empty(); d++)
+	{
+		simplices.push_back(complex->expandFlat(simplices[d], d + 1));
+		complex->prepareFlat(simplices[d + 1]);
+
+		std::vector<flatRecord<maxVertices> *> columns(simplices[d].size());
+		for (size_t i = 0; i < columns.size(); i++)
+			columns[i] = &simplices[d][i];
+		flatPivots = persistenceByDimension(inData, std::move(columns), flatPivots, d, sortReverseLexicographic(), "cohomology", inv != "true");
+
+		// Representative cycles -> homology on the pivot columns, whose facets are the records of dimension d
+		if (inv == "true")
+		{
+			complex->prepareFlat(simplices[d]);
+			persistenceByDimension(inData, flatPivots, std::vector<flatRecord<maxVertices> *>(), d, sortLexicographic(), "homology", true);
+		}
+	}
+
+	complex->releaseArena();
+}
+
 // runPipe -> Run the configured functions of this pipeline segment
 //
 //	FastPersistence: For computing the persistence pairs from simplicial complex:
@@ -161,8 +356,8 @@ std::vector<simplexNodePointer> fastPersistence<nodeType>::persistenceByDimensio
 template <class nodeType>
 void fastPersistence<nodeType>::runPipe(pipePacket<nodeType> &inData)
 {
-	// Get all edges for the simplexArrayList or simplexTree
-	std::vector<std::set<std::shared_ptr<nodeType>, cmpByWeight<std::shared_ptr<nodeType>>>> edges = inData.complex->getAllEdges();
+	// Get all edges for the simplexArrayList or simplexTree; the sealed filtrations are read in place
+	const auto &edges = inData.complex->getAllEdges();
 
 	if (edges.size() <= 1)
 		return;
@@ -227,7 +422,7 @@ void fastPersistence<nodeType>::runPipe(pipePacket<nodeType> &inData)
 
 	// std::cout << "mappedIndices.size = " << mappedIndices.size() << '\n';
 
-	for (int i = 0; i < inData.workData.size(); i++)
+	for (int i = 0; i < static_cast<int>(inData.workData.size()); i++)
 	{
 		if (uf.find(i) == i)
 		{ // i is the name of a connected component
@@ -251,7 +446,32 @@ void fastPersistence<nodeType>::runPipe(pipePacket<nodeType> &inData)
 
 	bool involuted = (inv == "true");
 
-	for (unsigned d = 1; d < dim && d < edges.size() - 1; d++)
+	if (implicit == "true" && (inData.complex->simplexType == "simplexArrayList" || inData.complex->simplexType == "sparseRips" || inData.complex->simplexType == "witnessComplex"))
+	{
+		// Implicit complex -> only the vertices and edges were built; each higher dimension exists as (diameter, index) pairs
+		//	expanded from the previous dimension, and cofacets are enumerated from the indices on demand
+		simplexArrayList<nodeType> *complex = (simplexArrayList<nodeType> *)inData.complex;
+		if (involuted)
+			this->ut.writeDebug("fastPersistence", "Involuted homology is not available for implicit complexes; reporting cocycle boundaries");
+
+		// Simplex indices are C(n, d + 1)-sized; past 64 bits the reduction runs on __int128 indices
+		if (complex->bin.isWide())
+		{
+			this->ut.writeDebug("fastPersistence", "Simplex indices exceed 64 bits; using 128-bit indices");
+			implicitPersistence<__int128>(inData, complex, pivots);
+		}
+		else
+			implicitPersistence<long long>(inData, complex, pivots);
+	}
+	else if (storage == "flat" && (inData.complex->simplexType == "simplexArrayList" || inData.complex->simplexType == "sparseRips"))
+	{
+		// Flat storage -> only the vertices and edges were built as nodes; the higher dimensions are flatSimplex records
+		//	in the arena of the complex, sized for the dim + 1 vertices of the largest simplex
+		flatDispatch(dim, [&]<unsigned maxVertices>()
+					 { flatPersistence<maxVertices>(inData, (simplexArrayList<nodeType> *)inData.complex, pivots); });
+	}
+
+	for (unsigned d = 1; d < static_cast<unsigned>(dim) && d + 1 < edges.size(); d++)
 	{
 
 		inData.complex->prepareCofacets(d);
@@ -334,12 +554,26 @@ bool fastPersistence<nodeType>::configPipe(std::map<std::string, std::string> &c
 	if (pipe != configMap.end())
 		this->inv = configMap["involuted"];
 
+	pipe = configMap.find("implicit");
+	if (pipe != configMap.end())
+		this->implicit = configMap["implicit"];
+
 	pipe = configMap.find("dimensions");
 	if (pipe != configMap.end())
 		this->dim = std::atoi(configMap["dimensions"].c_str());
 	else
 		return false;
 
+	pipe = configMap.find("storage");
+	if (pipe != configMap.end())
+		this->storage = configMap["storage"];
+	std::string error = storageError(this->storage, this->dim);
+	if (!error.empty())
+	{
+		this->ut.writeError("fastPersistence", error);
+		return false;
+	}
+
 	pipe = configMap.find("epsilon");
 	if (pipe != configMap.end())
 		this->maxEpsilon = std::atof(configMap["epsilon"].c_str());
@@ -358,12 +592,13 @@ bool fastPersistence<nodeType>::configPipe(std::map<std::string, std::string> &c
 	if (pipe != configMap.end())
 		this->complexType = configMap["complexType"];
 	this->configured = true;
-	this->ut.writeDebug("fastPersistence", "Configured with parameters { dim: " + configMap["dimensions"] + ", complexType: " + configMap["complexType"] + ", eps: " + configMap["epsilon"]);
+	this->ut.writeDebug("fastPersistence", "Configured with parameters { dim: " + configMap["dimensions"] + ", complexType: " + configMap["complexType"] + ", eps: " + configMap["epsilon"] + ", implicit: " + this->implicit + ", storage: " + this->storage);
 	this->ut.writeDebug("fastPersistence", "\t\t\t\tdebug: " + strDebug + ", outputFile: " + this->outputFile + " }");
 
 	return true;
 }
 
 template class fastPersistence<simplexNode>;
+template class fastPersistence<wideSimplexNode>;
 template class fastPersistence<alphaNode>;
 template class fastPersistence<witnessNode>;
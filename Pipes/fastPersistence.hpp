@@ -5,6 +5,7 @@
 #include <vector>
 #include "basePipe.hpp"
 #include "simplexBase.hpp"
+#include "simplexArrayList.hpp"
 #include "utils.hpp"
 #include "unionFind.hpp"
 
@@ -12,11 +13,19 @@ template <typename nodeType>
 class fastPersistence : public basePipe<nodeType>
 {
 	typedef std::shared_ptr<nodeType> templateNode_P;
+	template <typename index>
+	using implicitNode = typename simplexArrayList<nodeType>::template implicitNode<index>;
+	template <unsigned maxVertices>
+	using flatRecord = typename simplexArrayList<nodeType>::template flatRecord<maxVertices>;
+	template <unsigned maxVertices>
+	using flatDimension = typename simplexArrayList<nodeType>::template flatDimension<maxVertices>;
 
 private:
 	int shift = 0;
 	double maxEpsilon;
 	std::string inv = "false";
+	std::string implicit = "false";
+	std::string storage = "nodes";
 
 	struct sortReverseLexicographic
 	{ // Sort nodes by weight, then by lexicographic order
@@ -39,6 +48,16 @@ private:
 				return a->weight > b->weight;
 			}
 		}
+
+		// Flat simplices of one dimension -> reverse lexicographic order is ascending hash
+		template <unsigned maxVertices, typename key>
+		bool operator()(const flatSimplex<maxVertices, key> *a, const flatSimplex<maxVertices, key> *b) const
+		{
+			if (a->weight == b->weight)
+				return (simplexKey)a->hash < (simplexKey)b->hash;
+			else
+				return a->weight > b->weight;
+		}
 	};
 
 	struct sortLexicographic
@@ -62,6 +81,39 @@ private:
 				return a->weight < b->weight;
 			}
 		}
+
+		// Flat simplices of one dimension -> reverse lexicographic order is ascending hash
+		template <unsigned maxVertices, typename key>
+		bool operator()(const flatSimplex<maxVertices, key> *a, const flatSimplex<maxVertices, key> *b) const
+		{
+			if (a->weight == b->weight)
+				return (simplexKey)a->hash < (simplexKey)b->hash;
+			else
+				return a->weight < b->weight;
+		}
+	};
+
+	// Column operations of persistenceByDimension for the node and the flat (simplexArrayList::flatten) storage
+	void columnFaces(pipePacket<nodeType> &, const templateNode_P &, unsigned, const std::string &, const std::unordered_map<templateNode_P, templateNode_P> &, bool, std::vector<templateNode_P> &);
+	template <unsigned maxVertices>
+	void columnFaces(pipePacket<nodeType> &, flatRecord<maxVertices> *, unsigned, const std::string &, const std::unordered_map<flatRecord<maxVertices> *, flatRecord<maxVertices> *> &, bool, std::vector<flatRecord<maxVertices> *> &);
+	static bool sameSimplex(const templateNode_P &a, const templateNode_P &b) { return a->simplex == b->simplex; }
+	template <unsigned maxVertices>
+	static bool sameSimplex(const flatRecord<maxVertices> *a, const flatRecord<maxVertices> *b) { return a == b; }
+	std::set<unsigned> boundaryPoints(const std::vector<templateNode_P> &boundary, unsigned) { return this->ut.extractBoundaryPoints(boundary); }
+	template <unsigned maxVertices>
+	std::set<unsigned> boundaryPoints(const std::vector<flatRecord<maxVertices> *> &boundary, unsigned dim) { return this->ut.extractBoundaryPoints(boundary, dim); }
+
+	struct sortImplicit
+	{ // Sort implicit simplices by weight, then by reverse lexicographic order (ascending index)
+		template <typename implicitSimplex>
+		bool operator()(const implicitSimplex &a, const implicitSimplex &b) const
+		{
+			if (a.first == b.first)
+				return a.second < b.second;
+			else
+				return a.first > b.first;
+		}
 	};
 
 public:
@@ -73,4 +125,12 @@ public:
 
 	template <class simplexNodePointer, class comp>
 	std::vector<simplexNodePointer> persistenceByDimension(pipePacket<nodeType> &, std::vector<simplexNodePointer>, std::vector<simplexNodePointer> pivots, unsigned, comp, std::string, bool);
+
+	template <unsigned maxVertices>
+	void flatPersistence(pipePacket<nodeType> &, simplexArrayList<nodeType> *, const std::vector<templateNode_P> &);
+
+	template <typename index>
+	void implicitPersistence(pipePacket<nodeType> &, simplexArrayList<nodeType> *, const std::vector<templateNode_P> &);
+	template <typename index>
+	std::vector<implicitNode<index>> implicitByDimension(pipePacket<nodeType> &, simplexArrayList<nodeType> *, std::vector<implicitNode<index>> &, std::vector<implicitNode<index>> pivots, unsigned);
 };
@@ -3,15 +3,17 @@
 #include "readInput.hpp"
 #include "writeOutput.hpp"
 #include "multifileops.hpp"
+#include "taskFrontier.hpp"
 #include <limits>
 #include <random>
 #include <chrono>
 #include <execution>
 #include <filesystem>
+#include <omp.h>
 #include <mpi.h>
 
-template <typename nodeType>
-helixDistPipe<nodeType>::helixDistPipe()
+template <typename nodeType, typename indexType>
+helixDistPipe<nodeType, indexType>::helixDistPipe()
 {
 	this->pipeType = "helixDistPipe";
 	MPI_Barrier(MPI_COMM_WORLD);
@@ -30,8 +32,8 @@ helixDistPipe<nodeType>::helixDistPipe()
 	}
 }
 
-template <typename nodeType>
-helixDistPipe<nodeType>::~helixDistPipe()
+template <typename nodeType, typename indexType>
+helixDistPipe<nodeType, indexType>::~helixDistPipe()
 {
 	if (this->rank == 0)
 	{
@@ -41,9 +43,181 @@ helixDistPipe<nodeType>::~helixDistPipe()
 	}
 }
 
+// mpi_index_type -> MPI datatype of the vertex indices exchanged between processes
+template <typename indexType>
+static MPI_Datatype mpi_index_type()
+{
+	static_assert(sizeof(indexType) == sizeof(int32_t), "helixDistPipe exchanges its vertices as MPI_INT32_T");
+	return MPI_INT32_T;
+}
+
+// expand_local_shell -> Expand the d-1 simplexes held by this process, removing the facets of every new dsimplex from the map
+template <typename nodeType, typename indexType>
+std::vector<std::vector<indexType>> helixDistPipe<nodeType, indexType>::expand_local_shell(std::map<std::vector<indexType>, indexType> &local_d_1_shell_map)
+{
+	std::vector<std::vector<indexType>> local_dsimplexes_output;
+	while (!local_d_1_shell_map.empty()) // Compute dsimplexes for individual process
+	{
+		auto iter = local_d_1_shell_map.begin();
+		std::vector<indexType> first_vector = iter->first;
+		indexType omission = iter->second;
+		local_d_1_shell_map.erase(iter);
+		indexType new_point = this->expand_d_minus_1_simplex(first_vector, omission);
+		if (new_point == -1)
+			continue;
+		first_vector.insert(std::lower_bound(first_vector.begin(), first_vector.end(), new_point), new_point);
+		for (auto &i : first_vector)
+		{
+			std::vector<indexType> key = first_vector;
+			key.erase(std::find(key.begin(), key.end(), i));
+			local_d_1_shell_map.erase(key);
+		}
+		local_dsimplexes_output.push_back(std::move(first_vector));
+	}
+	this->report_cospherical();
+	return local_dsimplexes_output;
+}
+
+// outer_shell -> Facets of the dsimplexes mapped to their omitted vertex; a facet shared by two dsimplexes is marked -1
+template <typename nodeType, typename indexType>
+std::map<std::vector<indexType>, indexType> helixDistPipe<nodeType, indexType>::outer_shell(const std::vector<std::vector<indexType>> &dsimplexes)
+{
+	std::map<std::vector<indexType>, indexType> outer_d_1_shell;
+	for (auto &new_simplex : dsimplexes)
+	{
+		for (size_t i = 0; i < new_simplex.size(); i++)
+		{
+			std::vector<indexType> key = new_simplex;
+			key.erase(key.begin() + i);
+			auto it = outer_d_1_shell.try_emplace(std::move(key), new_simplex[i]);
+			it.first->second = (it.second ? new_simplex[i] : -1);
+		}
+	}
+	return outer_d_1_shell;
+}
+
+// shuffle_facets -> Send every facet to the process owning its hash (MPI_Alltoallv) and merge the received facets
+//    The in-memory counterpart of MultiFile::compressMap: a facet received with two different omitted vertices
+//    (or already marked -1) is shared by two dsimplexes and dropped, as is a facet of the previous iteration's
+//    input. A facet is always owned by the same process, so previous only holds the facets of this process.
+template <typename nodeType, typename indexType>
+std::map<std::vector<indexType>, indexType> helixDistPipe<nodeType, indexType>::shuffle_facets(const std::map<std::vector<indexType>, indexType> &outer_d_1_shell, const std::set<std::vector<indexType>> &previous)
+{
+	const size_t record = this->dim + 1; // Facet vertices followed by the omitted vertex
+	const MPI_Datatype datatype = mpi_index_type<indexType>();
+	vectorHash hasher;
+
+	std::vector<std::vector<indexType>> outgoing(this->numProcesses);
+	for (auto &[facet, omission] : outer_d_1_shell)
+	{
+		auto &buffer = outgoing[hasher(facet) % this->numProcesses];
+		buffer.insert(buffer.end(), facet.begin(), facet.end());
+		buffer.push_back(omission);
+	}
+
+	std::vector<int> sendCounts(this->numProcesses), sendDispls(this->numProcesses), recvCounts(this->numProcesses), recvDispls(this->numProcesses);
+	std::vector<indexType> sendBuffer;
+	for (int p = 0; p < this->numProcesses; p++)
+	{
+		sendCounts[p] = outgoing[p].size();
+		sendDispls[p] = sendBuffer.size();
+		sendBuffer.insert(sendBuffer.end(), outgoing[p].begin(), outgoing[p].end());
+		std::vector<indexType>().swap(outgoing[p]);
+	}
+	MPI_Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+	size_t total = 0;
+	for (int p = 0; p < this->numProcesses; p++)
+	{
+		recvDispls[p] = total;
+		total += recvCounts[p];
+	}
+	std::vector<indexType> recvBuffer(total);
+	MPI_Alltoallv(sendBuffer.data(), sendCounts.data(), sendDispls.data(), datatype, recvBuffer.data(), recvCounts.data(), recvDispls.data(), datatype, MPI_COMM_WORLD);
+	std::vector<indexType>().swap(sendBuffer);
+
+	std::map<std::vector<indexType>, indexType> merged;
+	for (size_t i = 0; i < recvBuffer.size(); i += record)
+	{
+		indexType omission = recvBuffer[i + record - 1];
+		auto it = merged.try_emplace(std::vector<indexType>(recvBuffer.begin() + i, recvBuffer.begin() + i + record - 1), omission);
+		if (!it.second && it.first->second != omission)
+			it.first->second = -1;
+	}
+	std::erase_if(merged, [&](const auto &entry)
+				  { return entry.second == -1 || previous.count(entry.first); });
+	return merged;
+}
+
+// gather_dsimplexes -> Collect the dsimplexes of every process on rank 0 (sorted, without duplicates)
+template <typename nodeType, typename indexType>
+void helixDistPipe<nodeType, indexType>::gather_dsimplexes(const std::vector<std::vector<indexType>> &dsimplexes, std::vector<std::vector<unsigned>> &dsimplexmesh)
+{
+	const size_t record = this->dim + 1;
+	const MPI_Datatype datatype = mpi_index_type<indexType>();
+
+	std::vector<indexType> sendBuffer;
+	sendBuffer.reserve(dsimplexes.size() * record);
+	for (auto &simplex : dsimplexes)
+		sendBuffer.insert(sendBuffer.end(), simplex.begin(), simplex.end());
+	int count = sendBuffer.size();
+	std::vector<int> counts(this->numProcesses), displs(this->numProcesses);
+	MPI_Gather(&count, 1, MPI_INT, counts.data(), 1, MPI_INT, 0, MPI_COMM_WORLD);
+
+	size_t total = 0;
+	if (this->rank == 0)
+		for (int p = 0; p < this->numProcesses; p++)
+		{
+			displs[p] = total;
+			total += counts[p];
+		}
+	std::vector<indexType> recvBuffer(total);
+	MPI_Gatherv(sendBuffer.data(), count, datatype, recvBuffer.data(), counts.data(), displs.data(), datatype, 0, MPI_COMM_WORLD);
+	if (this->rank != 0)
+		return;
+
+	// A dsimplex reached from facets held by two processes in the same iteration is found twice
+	std::vector<std::vector<unsigned>> gathered;
+	gathered.reserve(total / record);
+	for (size_t i = 0; i < recvBuffer.size(); i += record)
+		gathered.emplace_back(recvBuffer.begin() + i, recvBuffer.begin() + i + record);
+	std::sort(gathered.begin(), gathered.end());
+	gathered.erase(std::unique(gathered.begin(), gathered.end()), gathered.end());
+	dsimplexmesh.insert(dsimplexmesh.end(), std::make_move_iterator(gathered.begin()), std::make_move_iterator(gathered.end()));
+}
+
+// expand_alltoall -> Layer by layer expansion with the d-1 shell hash partitioned across the processes and exchanged in memory
+template <typename nodeType, typename indexType>
+void helixDistPipe<nodeType, indexType>::expand_alltoall(std::map<std::vector<indexType>, indexType> &&inner_d_1_shell, std::vector<std::vector<indexType>> &&dsimplexes, pipePacket<nodeType> &inData)
+{
+	// Distribute the shell computed by rank 0 to the owners of its facets
+	std::map<std::vector<indexType>, indexType> local_d_1_shell_map = this->shuffle_facets(inner_d_1_shell, {});
+	inner_d_1_shell.clear();
+
+	int iter_counter = 1;
+	while (true)
+	{
+		uint64_t local_size = local_d_1_shell_map.size(), shell_size = 0;
+		MPI_Allreduce(&local_size, &shell_size, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+		if (shell_size == 0)
+			break;
+
+		std::set<std::vector<indexType>> previous;
+		for (auto &entry : local_d_1_shell_map)
+			previous.insert(previous.end(), entry.first);
+
+		std::vector<std::vector<indexType>> local_dsimplexes_output = this->expand_local_shell(local_d_1_shell_map);
+		this->ut.writeLog("helixDistPipe", "Iter " + std::to_string(iter_counter) + " on process " + std::to_string(this->rank) + " Found " + std::to_string(local_dsimplexes_output.size()) + " dsimplexes");
+
+		local_d_1_shell_map = this->shuffle_facets(this->outer_shell(local_dsimplexes_output), previous);
+		dsimplexes.insert(dsimplexes.end(), std::make_move_iterator(local_dsimplexes_output.begin()), std::make_move_iterator(local_dsimplexes_output.end()));
+		iter_counter++;
+	}
+	this->gather_dsimplexes(dsimplexes, inData.complex->dsimplexmesh);
+}
+
 // run -> Run the configured functions of this line segment
-template <typename nodeType>
-void helixDistPipe<nodeType>::runPipe(pipePacket<nodeType> &inData)
+template <typename nodeType, typename indexType>
+void helixDistPipe<nodeType, indexType>::runPipe(pipePacket<nodeType> &inData)
 {
 	this->inputData = inData.inputData;
 	this->data_set_size = this->inputData.size();
@@ -58,21 +232,22 @@ void helixDistPipe<nodeType>::runPipe(pipePacket<nodeType> &inData)
 		this->ut.writeDebug("HelixDistPipe", "InputData needs atleast dim + 2 points for Delaunay Triangulation to work.");
 		return; // Not enough points
 	}
-	this->active_data.resize(this->data_set_size, 0);
+	this->prepare_search();
 
-	std::clog << "MPI configured with " << this->numProcesses << " processes" << std::endl;
+	this->ut.writeLog("helixDistPipe", "MPI configured with " + std::to_string(this->numProcesses) + " processes");
 
 	// Initialization of algorithm by serial processing
+	std::vector<std::vector<indexType>> initial_dsimplexes;
+	std::vector<std::pair<std::vector<indexType>, indexType>> inner_d_1_shell;
 	if (this->rank == 0)
 	{
 		// Perform initial iteration normally
-		std::vector<std::vector<short>> initial_dsimplexes = {this->first_simplex()};
-		std::vector<std::pair<std::vector<short>, short>> inner_d_1_shell;
+		initial_dsimplexes = {this->first_simplex()};
 		for (auto &new_simplex : initial_dsimplexes)
 		{
 			for (auto &i : new_simplex)
 			{
-				std::vector<short> key = new_simplex;
+				std::vector<indexType> key = new_simplex;
 				key.erase(std::find(key.begin(), key.end(), i));
 				inner_d_1_shell.push_back(std::make_pair(key, i));
 			}
@@ -80,11 +255,11 @@ void helixDistPipe<nodeType>::runPipe(pipePacket<nodeType> &inData)
 		// Compute 10000 facets per process to reduce no of iterations
 		for (int i = 0; i < 3; i++)
 		{
-			std::set<std::vector<short>> outer_dsimplexes;
+			std::set<std::vector<indexType>> outer_dsimplexes;
 			for (auto &[facet, point] : inner_d_1_shell)
 			{
-				std::vector<short> first_vector = facet;
-				short new_point = this->expand_d_minus_1_simplex(first_vector, point, inData.distMatrix);
+				std::vector<indexType> first_vector = facet;
+				indexType new_point = this->expand_d_minus_1_simplex(first_vector, point);
 				if (new_point == -1)
 					continue;
 				first_vector.push_back(new_point);
@@ -93,17 +268,24 @@ void helixDistPipe<nodeType>::runPipe(pipePacket<nodeType> &inData)
 			}
 			this->reduce(outer_dsimplexes, inner_d_1_shell, initial_dsimplexes);
 		}
-		std::clog << "Iter 0 on process " << this->rank << " Found " << initial_dsimplexes.size() << " dsimplexes" << std::endl;
+		this->ut.writeLog("helixDistPipe", "Iter 0 on process " + std::to_string(this->rank) + " Found " + std::to_string(initial_dsimplexes.size()) + " dsimplexes");
+	}
 
+	if (this->exchange == "alltoall")
+	{
+		this->expand_alltoall({inner_d_1_shell.begin(), inner_d_1_shell.end()}, std::move(initial_dsimplexes), inData);
+		return;
+	}
+
+	if (this->rank == 0)
+	{
 		std::sort(initial_dsimplexes.begin(), initial_dsimplexes.end());
 		writeOutput::writeBinary(initial_dsimplexes, ".output/0_0.bin");
 
 		initial_dsimplexes.clear();
+		// An empty shell writes no input file, so every process leaves the loop below on its first read
 		if (inner_d_1_shell.empty())
-		{
 			this->ut.writeDebug("HelixDistPipe", "Delaunay Triangulation collapsed before Distributed Implementation criteria reached.");
-			return;
-		}
 		writeOutput::writeBinary(inner_d_1_shell, ".input/1.dat");
 	}
 
@@ -114,30 +296,16 @@ void helixDistPipe<nodeType>::runPipe(pipePacket<nodeType> &inData)
 	int iter_counter = 1;
 	while (true)
 	{
-		std::map<std::vector<short>, short> local_d_1_shell_map = readInput::readBinaryMap(".input/" + std::to_string(iter_counter) + ".dat", this->numProcesses, this->rank);
-		if (local_d_1_shell_map.empty())
+		std::map<std::vector<indexType>, indexType> local_d_1_shell_map = readInput::readBinaryMap<indexType>(".input/" + std::to_string(iter_counter) + ".dat", this->numProcesses, this->rank);
+
+		// A process whose block of a small shell is empty keeps going until the whole shell is
+		uint64_t local_size = local_d_1_shell_map.size(), shell_size = 0;
+		MPI_Allreduce(&local_size, &shell_size, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+		if (shell_size == 0)
 			break;
-		std::vector<std::vector<short>> local_dsimplexes_output;
-		while (!local_d_1_shell_map.empty()) // Compute dsimplexes for individual process
-		{
-			auto iter = local_d_1_shell_map.begin();
-			std::vector<short> first_vector = iter->first;
-			short omission = iter->second;
-			local_d_1_shell_map.erase(iter);
-			short new_point = this->expand_d_minus_1_simplex(first_vector, omission, inData.distMatrix);
-			if (new_point == -1)
-				continue;
-			first_vector.insert(std::lower_bound(first_vector.begin(), first_vector.end(), new_point), new_point);
-			for (auto &i : first_vector)
-			{
-				std::vector<short> key = first_vector;
-				key.erase(std::find(key.begin(), key.end(), i));
-				local_d_1_shell_map.erase(key);
-			}
-			local_dsimplexes_output.push_back(std::move(first_vector));
-		}
+		std::vector<std::vector<indexType>> local_dsimplexes_output = this->expand_local_shell(local_d_1_shell_map);
 
-		std::clog << "Iter " << iter_counter << " on process " << this->rank << " Found " << local_dsimplexes_output.size() << " dsimplexes" << std::endl;
+		this->ut.writeLog("helixDistPipe", "Iter " + std::to_string(iter_counter) + " on process " + std::to_string(this->rank) + " Found " + std::to_string(local_dsimplexes_output.size()) + " dsimplexes");
 		// Commit dsimplexes to file
 
 		if (!local_dsimplexes_output.empty())
@@ -147,17 +315,7 @@ void helixDistPipe<nodeType>::runPipe(pipePacket<nodeType> &inData)
 		}
 
 		// Compute facets from current layer and store to intermediate file
-		std::map<std::vector<short>, short> outer_d_1_shell;
-		for (auto &new_simplex : local_dsimplexes_output)
-		{
-			for (short i = 0; i < new_simplex.size(); i++)
-			{
-				std::vector<short> key = new_simplex;
-				key.erase(key.begin() + i);
-				auto it = outer_d_1_shell.try_emplace(std::move(key), new_simplex[i]);
-				it.first->second = (it.second ? new_simplex[i] : -1);
-			}
-		}
+		std::map<std::vector<indexType>, indexType> outer_d_1_shell = this->outer_shell(local_dsimplexes_output);
 		local_dsimplexes_output.clear();
 		writeOutput::writeBinary(outer_d_1_shell, ".intermediate/" + std::to_string(this->rank) + ".dat");
 		outer_d_1_shell.clear();
@@ -168,7 +326,7 @@ void helixDistPipe<nodeType>::runPipe(pipePacket<nodeType> &inData)
 		if (this->rank == 0)
 		{
 			// Perform custom multifile sort on the intermediate simplexes also remove duplicate entries
-			MultiFile<MapBinaryFile, std::pair<std::vector<short>, short>> facets(".intermediate");
+			MultiFile<MapBinaryFile<indexType>, std::pair<std::vector<indexType>, indexType>> facets(".intermediate");
 			facets.compressMap(".input/" + std::to_string(iter_counter + 1) + ".dat", iter_counter);
 		}
 
@@ -178,15 +336,15 @@ void helixDistPipe<nodeType>::runPipe(pipePacket<nodeType> &inData)
 	}
 	if (this->rank == 0)
 	{
-		MultiFile<VectorBinaryFile, std::vector<short>> dsimplexes(".output");
+		MultiFile<VectorBinaryFile<indexType>, std::vector<indexType>> dsimplexes(".output");
 		dsimplexes.loadAggregateData(inData.complex->dsimplexmesh);
 	}
 	return;
 }
 
 // configPipe -> configure the function settings of this pipeline segment
-template <typename nodeType>
-bool helixDistPipe<nodeType>::configPipe(std::map<std::string, std::string> &configMap)
+template <typename nodeType, typename indexType>
+bool helixDistPipe<nodeType, indexType>::configPipe(std::map<std::string, std::string> &configMap)
 {
 	std::string strDebug;
 
@@ -202,14 +360,25 @@ bool helixDistPipe<nodeType>::configPipe(std::map<std::string, std::string> &con
 
 	this->ut = utils(strDebug, this->outputFile);
 
+	pipe = configMap.find("exchange");
+	if (pipe != configMap.end())
+	{
+		if (configMap["exchange"] != "file" && configMap["exchange"] != "alltoall")
+		{
+			this->ut.writeError("helixDistPipe", "Unknown exchange '" + configMap["exchange"] + "' (file|alltoall)");
+			return false;
+		}
+		this->exchange = configMap["exchange"];
+	}
+
 	this->configured = true;
 	this->ut.writeDebug("helixDistPipe", "Configured with parameters { eps: " + configMap["epsilon"] + " , debug: " + strDebug + ", outputFile: " + this->outputFile + " }");
 
 	return true;
 }
 // outputData -> used for tracking each stage of the pipeline's data output without runtime
-template <typename nodeType>
-void helixDistPipe<nodeType>::outputData(pipePacket<nodeType> &inData)
+template <typename nodeType, typename indexType>
+void helixDistPipe<nodeType, indexType>::outputData(pipePacket<nodeType> &inData)
 {
 	if (this->rank == 0)
 	{
@@ -229,5 +398,6 @@ void helixDistPipe<nodeType>::outputData(pipePacket<nodeType> &inData)
 }
 
 template class helixDistPipe<simplexNode>;
+template class helixDistPipe<wideSimplexNode>;
 template class helixDistPipe<alphaNode>;
 template class helixDistPipe<witnessNode>;
\ No newline at end of file
@@ -5,11 +5,17 @@
 #include "helixPipe.hpp"
 
 // base constructor
-template <typename nodeType>
-class helixDistPipe : public helixPipe<nodeType>
+template <typename nodeType, typename indexType = int32_t>
+class helixDistPipe : public helixPipe<nodeType, indexType>
 {
 private:
   int rank = 0, numProcesses = 0;
+  std::string exchange = "file"; // Exchange of the d-1 shell between iterations (file|alltoall)
+  std::vector<std::vector<indexType>> expand_local_shell(std::map<std::vector<indexType>, indexType> &local_d_1_shell_map);
+  std::map<std::vector<indexType>, indexType> outer_shell(const std::vector<std::vector<indexType>> &dsimplexes);
+  std::map<std::vector<indexType>, indexType> shuffle_facets(const std::map<std::vector<indexType>, indexType> &outer_d_1_shell, const std::set<std::vector<indexType>> &previous);
+  void gather_dsimplexes(const std::vector<std::vector<indexType>> &dsimplexes, std::vector<std::vector<unsigned>> &dsimplexmesh);
+  void expand_alltoall(std::map<std::vector<indexType>, indexType> &&inner_d_1_shell, std::vector<std::vector<indexType>> &&dsimplexes, pipePacket<nodeType> &inData);
 
 public:
   helixDistPipe();
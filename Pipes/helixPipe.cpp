@@ -1,17 +1,17 @@
 #include "helixPipe.hpp"
+#include "geometryKernels.hpp"
+#include "taskFrontier.hpp"
 #include <Eigen/Dense>
 #include <limits>
 #include <omp.h>
 #include <random>
 #include <chrono>
-#include <execution>
 #include <fstream>
 #include <ranges>
-// #define PARALLEL
 
 // Solution to equation of a hyperplane
-template <typename nodeType>
-std::vector<double> helixPipe<nodeType>::solvePlaneEquation(const std::vector<short> &points)
+template <typename nodeType, typename indexType>
+std::vector<double> helixPipe<nodeType, indexType>::solvePlaneEquation(const std::vector<indexType> &points)
 {
 	int numPoints = points.size();
 	Eigen::MatrixXd A(numPoints, numPoints);
@@ -22,37 +22,46 @@ std::vector<double> helixPipe<nodeType>::solvePlaneEquation(const std::vector<sh
 }
 
 // Compute the seed simplex for initialization of algorithm
-template <typename nodeType>
-std::vector<short> helixPipe<nodeType>::first_simplex()
+template <typename nodeType, typename indexType>
+std::vector<indexType> helixPipe<nodeType, indexType>::first_simplex()
 {
-	std::vector<short> simplex(this->dim);
+	std::vector<indexType> simplex(this->dim);
 	std::iota(simplex.begin(), simplex.end(), 0); // Pseudo Random initialization of Splitting Hyperplane
 	auto seed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
 	auto rng = std::default_random_engine{};
-	std::vector<short> outer_points;
+	std::vector<indexType> outer_points;
+	std::vector<double> equation;
 	while (true)
 	{
 		simplex.insert(simplex.end(), outer_points.begin(), outer_points.end());
 		std::shuffle(simplex.begin(), simplex.end(), rng);
 		outer_points.clear();
 		simplex.resize(this->dim);
-		auto equation = this->solvePlaneEquation(simplex);
+		equation = this->solvePlaneEquation(simplex);
 		for (unsigned i = 0; i < this->data_set_size; i++)
 			if (std::find(simplex.begin(), simplex.end(), i) == simplex.end() && utils::dot(this->inputData[i], equation) > 1)
 				outer_points.push_back(i);
 		if (outer_points.empty()) // Converge Hyperplane to Convex Hull
 			break;
 	}
+	// The hull facet has every point on its inner side; the last point is its Delaunay neighbor there
+	indexType point = this->expand_facet(simplex, equation, true, -1);
+	if (point != -1)
+	{
+		simplex.push_back(point);
+		std::sort(simplex.begin(), simplex.end());
+		return simplex;
+	}
 	double radius = 0;
 	std::vector<double> center;
-	for (short i = 0; i < this->data_set_size; i++) // BruteForce to Find last point for construction of simplex.
+	for (indexType i = 0; i < this->data_set_size; i++) // BruteForce to Find last point for construction of simplex.
 	{
 		if (std::find(simplex.begin(), simplex.end(), i) != simplex.end())
 			continue;
 		simplex.push_back(i);
-		center = utils::circumCenter(simplex, this->inputData);
+		center = geometryKernels::circumCenter(simplex, this->inputData);
 		radius = utils::vectors_distance(center, this->inputData[i]);
-		short point;
+		indexType point;
 		for (point = 0; point < this->data_set_size; point++)
 		{
 			if (std::find(simplex.begin(), simplex.end(), point) == simplex.end() && utils::vectors_distance(center, this->inputData[point]) < radius)
@@ -67,8 +76,8 @@ std::vector<short> helixPipe<nodeType>::first_simplex()
 }
 
 // Perform DFS walk on the cospherical region
-template <typename nodeType>
-void helixPipe<nodeType>::cospherical_handler(std::vector<short> &simp, int &tp, short &omission, std::vector<std::vector<double>> &distMatrix)
+template <typename nodeType, typename indexType>
+void helixPipe<nodeType, indexType>::cospherical_handler(std::vector<indexType> &simp, int &tp, indexType &omission)
 {
 	auto triangulation_point = tp;
 	auto temp = simp;
@@ -81,7 +90,7 @@ void helixPipe<nodeType>::cospherical_handler(std::vector<short> &simp, int &tp,
 		new_face.erase(std::find(new_face.begin(), new_face.end(), i));
 		if (simp == new_face)
 			continue;
-		auto new_point = this->expand_d_minus_1_simplex(new_face, i, distMatrix);
+		auto new_point = this->expand_d_minus_1_simplex(new_face, i);
 		if (new_point == -1)
 			continue;
 		new_face.push_back(new_point);
@@ -90,183 +99,233 @@ void helixPipe<nodeType>::cospherical_handler(std::vector<short> &simp, int &tp,
 	}
 }
 
-#if 0
-// Compute the P_newpoint for provided Facet, P_context Pair
-template <typename nodeType>
-short helixPipe<nodeType>::expand_d_minus_1_simplex(std::vector<short> &simp, short &omission, std::vector<std::vector<double>> &distMatrix)
+// Distance between two points; a plain loop, this runs once per candidate
+static double point_distance(const std::vector<double> &a, const std::vector<double> &b)
 {
-	auto normal = solvePlaneEquation(simp);
-	auto p1 = utils::circumCenter(simp, this->inputData);
-	bool direction = (dot(normal, this->inputData[omission]) > 1);
-	std::vector<double> radius_vec(this->data_set_size, 0);
-	double largest_radius = 0, smallest_radius = std::numeric_limits<double>::max() / 2, ring_radius = utils::vectors_distance(p1, this->inputData[simp[0]]);
-	int triangulation_point = -1;
-	bool flag = true;
-	std::set<short> simplex(simp.begin(), simp.end());
-	simplex.insert(omission);
-	for (auto &new_point : this->search_space)
-	{
-		if (simplex.find(new_point) == simplex.end() && (direction ^ dot(normal, this->inputData[new_point]) > 1))
-		{
-			simp.push_back(new_point);
-			auto temp = utils::vectors_distance(p1, this->inputData[new_point]);
-			if (ring_radius > temp)
-			{
-				auto temp_radius = utils::circumRadius(simp, distMatrix);
-				radius_vec[new_point] = (temp_radius >= 0) ? sqrt(temp_radius) : utils::vectors_distance(utils::circumCenter(simp, this->inputData), this->inputData[new_point]);
-				if (largest_radius < radius_vec[new_point])
-				{
-					largest_radius = radius_vec[new_point];
-					triangulation_point = new_point;
-					flag = false;
-				}
-			}
-			else if (flag && 2 * smallest_radius > temp) // reduce search space
-			{
-				auto temp_radius = utils::circumRadius(simp, distMatrix);
-				radius_vec[new_point] = (temp_radius >= 0) ? sqrt(temp_radius) : utils::vectors_distance(utils::circumCenter(simp, this->inputData), this->inputData[new_point]);
-				if (smallest_radius > radius_vec[new_point])
-				{
-					smallest_radius = radius_vec[new_point];
-					triangulation_point = new_point;
-				}
-			}
-			simp.pop_back();
-		}
-	}
-	int count = 0;
-	if (triangulation_point != -1)
-	{
-		double triangulation_radius = radius_vec[triangulation_point];
-		count = std::count_if(radius_vec.begin(), radius_vec.end(), [triangulation_radius](double val)
-							  { return std::abs(1 - (val / triangulation_radius)) <= 0.000000000001; });
-		if (count != 1)
-		{
-			std::cout << "Triangulation radius is " << triangulation_radius << std::endl;
-#ifdef PARALLEL
-#pragma omp critical
-			{
-				// cospherical_handler(simp,triangulation_point,omission,distMatrix);
-			}
-#else
-			// cospherical_handler(simp,triangulation_point,omission,distMatrix);
-#endif
-			return -1;
-		}
-	}
-	return triangulation_point;
+	double sum = 0;
+	for (size_t k = 0; k < a.size(); k++)
+		sum += (a[k] - b[k]) * (a[k] - b[k]);
+	return sqrt(sum);
 }
 
-#else
 // Compute the P_newpoint for provided Facet, P_context Pair
-template <typename nodeType>
-short helixPipe<nodeType>::expand_d_minus_1_simplex(std::vector<short> &simp, short &omission, std::vector<std::vector<double>> &distMatrix)
+template <typename nodeType, typename indexType>
+indexType helixPipe<nodeType, indexType>::expand_d_minus_1_simplex(std::vector<indexType> &simp, indexType &omission)
 {
-	// Mandatory requirements
 	auto normal = this->solvePlaneEquation(simp);
 	bool direction = utils::dot(normal, inputData[omission]) > 1;
+	return this->expand_facet(simp, normal, direction, omission);
+}
 
-	// Filter points opposite to hyperplane
-	for (size_t idx = 0; idx < this->active_data.size(); ++idx)
-		this->active_data[idx] = direction ^ (utils::dot(normal, inputData[idx]) > 1) ? 0 : std::numeric_limits<double>::infinity();
-
-	// Deactivate points from original simplex
-	this->active_data[omission] = std::numeric_limits<double>::infinity();
-	for (const auto &point : simp)
-		this->active_data[point] = std::numeric_limits<double>::infinity();
-
-	// Early return if plane is on convex hull
-	if (std::all_of(this->active_data.begin(), this->active_data.end(), [](double isActive)
-					{ return isActive == std::numeric_limits<double>::infinity(); }))
-		return -1;
+/**
+ * @brief Find the Delaunay neighbor of a facet on one side of its hyperplane normal . x = 1.
+ *
+ * Candidates come from kd-tree ball queries around the circumcenter c of the facet (radius r). If a point of
+ * the far side lies inside the ball (c, r), the neighbor is the one of those with the largest circumradius.
+ * Otherwise the circumcenter of the neighbor lies beyond c at some distance t and a point at radius R is at
+ * most R + t = R + sqrt(R^2 - r^2) from c, so the ball grows (doubling) until it holds a candidate and is then
+ * widened once to that bound of the best radius found; no point outside it can have a smaller circumsphere.
+ *
+ * @param simp The d-1 facet.
+ * @param normal Coefficients of the facet hyperplane.
+ * @param direction Side of the known simplex (normal . x > 1); the search is on the other side.
+ * @param omission Point of the known simplex opposite the facet, -1 if there is none.
+ * @return indexType The new point, -1 on the convex hull or in a cospherical region.
+ */
+template <typename nodeType, typename indexType>
+indexType helixPipe<nodeType, indexType>::expand_facet(std::vector<indexType> &simp, const std::vector<double> &normal, bool direction, indexType omission)
+{
+	auto far_side = [&](size_t idx)
+	{
+		return idx != (size_t)omission && std::find(simp.begin(), simp.end(), idx) == simp.end() && (direction ^ (utils::dot(normal, inputData[idx]) > 1));
+	};
 
-	// Default values
-	short triangulation_point = -1;
 	// Calculate the circumcenter of the facet
-	auto center = utils::circumCenter(simp, inputData);
+	auto center = geometryKernels::circumCenter(simp, inputData);
+	auto ring_radius = point_distance(center, this->inputData[simp[0]]);
 
-	for (size_t idx = 0; idx < this->active_data.size(); ++idx)
-		if (this->active_data[idx] != std::numeric_limits<double>::infinity())
-			this->active_data[idx] = utils::vectors_distance(center, inputData[idx]);
+	// Radius of each candidate coface, from the coordinates of its circumcenter; the cofaces of one pass form one batch
+	std::vector<unsigned> candidates, cofaces;
+	std::vector<double> radii, centers;
+	const unsigned m = simp.size() + 1;
+	auto evaluate = [&](size_t from)
+	{
+		cofaces.clear();
+		for (size_t c = from; c < candidates.size(); ++c)
+		{
+			cofaces.insert(cofaces.end(), simp.begin(), simp.end());
+			cofaces.push_back(candidates[c]);
+		}
+		geometryKernels::circumCenters(cofaces, m, this->inputData, centers);
+		for (size_t c = from; c < candidates.size(); ++c)
+		{
+			const double *coface_center = centers.data() + (c - from) * this->dim, *point = this->inputData[candidates[c]].data();
+			double sum = 0;
+			for (unsigned k = 0; k < this->dim; k++)
+				sum += (coface_center[k] - point[k]) * (coface_center[k] - point[k]);
+			radii.push_back(sqrt(sum));
+		}
+	};
 
-	auto ring_radius = utils::vectors_distance(center, this->inputData[simp[0]]);
+	indexType triangulation_point = -1;
+	double triangulation_radius = 0;
 
-	// Check for any distances less than the distance to the first simplex point
-	if (std::find_if(this->active_data.begin(), this->active_data.end(), [&](double distance)
-					 { return distance < ring_radius; }) == this->active_data.end())
+	// Search inside space with largest circumradius
+	for (auto idx : this->tree.neighborhoodIndices(center, ring_radius))
+		if (point_distance(center, inputData[idx]) < ring_radius && far_side(idx))
+			candidates.push_back(idx);
+	if (!candidates.empty())
 	{
-		// Search outside space with smallest circumradius
-		double smallest_radius = std::numeric_limits<double>::max() / 2;
-		for (size_t idx = 0; idx < this->active_data.size(); ++idx)
-		{
-			if (this->active_data[idx] != std::numeric_limits<double>::infinity() && this->active_data[idx] > ring_radius && this->active_data[idx] < 2 * smallest_radius)
+		evaluate(0);
+		for (size_t c = 0; c < candidates.size(); ++c)
+			if (triangulation_radius < radii[c])
 			{
-				simp.push_back(idx);
-				auto temp_radius = utils::circumRadius(simp, distMatrix);
-				this->active_data[idx] = (temp_radius >= 0) ? sqrt(temp_radius) : utils::vectors_distance(utils::circumCenter(simp, this->inputData), this->inputData[idx]);
-				simp.pop_back();
-				if (smallest_radius > this->active_data[idx])
-				{
-					smallest_radius = this->active_data[idx];
-					triangulation_point = idx;
-				}
+				triangulation_radius = radii[c];
+				triangulation_point = candidates[c];
 			}
-			else
-				this->active_data[idx] = 0;
-		}
 	}
 	else
 	{
-		// Search inside space with largest circumradius
-		double largest_radius = 0;
-		for (size_t idx = 0; idx < this->active_data.size(); ++idx)
+		// Search outside space with smallest circumradius
+		double limit = 0; // Distance to the farthest corner of the bounding box, every point is within it
+		for (size_t k = 0; k < center.size(); k++)
+		{
+			double side = std::max(center[k] - this->lower_corner[k], this->upper_corner[k] - center[k]);
+			limit += side * side;
+		}
+		limit = sqrt(limit);
+
+		triangulation_radius = std::numeric_limits<double>::max();
+		double searched = ring_radius, reach = ring_radius > 0 ? 2 * ring_radius : limit;
+		while (true)
 		{
-			if (this->active_data[idx] != std::numeric_limits<double>::infinity() && this->active_data[idx] < ring_radius)
+			size_t from = candidates.size();
+			for (auto idx : this->tree.neighborhoodIndices(center, reach))
 			{
-				simp.push_back(idx);
-				auto temp_radius = utils::circumRadius(simp, distMatrix);
-				this->active_data[idx] = (temp_radius >= 0) ? sqrt(temp_radius) : utils::vectors_distance(utils::circumCenter(simp, this->inputData), this->inputData[idx]);
-				simp.pop_back();
-				if (largest_radius < this->active_data[idx])
+				double distance = point_distance(center, inputData[idx]);
+				if (distance > searched && distance <= reach && far_side(idx))
+					candidates.push_back(idx);
+			}
+			evaluate(from);
+			for (size_t c = from; c < candidates.size(); ++c)
+				if (triangulation_radius > radii[c])
 				{
-					largest_radius = this->active_data[idx];
-					triangulation_point = idx;
+					triangulation_radius = radii[c];
+					triangulation_point = candidates[c];
 				}
+			searched = reach;
+
+			if (triangulation_point != -1)
+			{
+				double bound = triangulation_radius + sqrt(std::max(0.0, triangulation_radius * triangulation_radius - ring_radius * ring_radius));
+				if (bound <= searched)
+					break;
+				reach = bound;
 			}
+			else if (reach >= limit)
+				return -1; // Plane is on convex hull
 			else
-				this->active_data[idx] = 0;
+				reach = std::min(2 * reach, limit);
 		}
 	}
-	double triangulation_radius = this->active_data[triangulation_point];
-	int count = std::count_if(this->active_data.begin(), this->active_data.end(), [triangulation_radius](double val)
+
+	int count = std::count_if(radii.begin(), radii.end(), [triangulation_radius](double val)
 							  { return std::abs(1 - (val / triangulation_radius)) <= 0.000000000001; });
 	if (count != 1)
 	{
-		std::cout << "Cospherical Region Found at triangulation radius " << triangulation_radius << std::endl;
-#ifdef PARALLEL
-#pragma omp critical
-		{
-			// this->cospherical_handler(simp,triangulation_point,omission,distMatrix);
-		}
-#else
-		// this->cospherical_handler(simp,triangulation_point,omission,distMatrix);
-#endif
+		this->cospherical_facets++; // Reported once per expansion, see report_cospherical
 		return -1;
 	}
 	return triangulation_point;
 }
-#endif
 
-template <typename nodeType>
-void helixPipe<nodeType>::reduce(std::set<std::vector<short>> &outer_dsimplexes, std::vector<std::pair<std::vector<short>, short>> &inner_d_1_shell, std::vector<std::vector<short>> &dsimplexes)
+// Build the candidate search structures over inputData (kd-tree and bounding box)
+template <typename nodeType, typename indexType>
+void helixPipe<nodeType, indexType>::prepare_search()
+{
+	this->tree = kdTree(this->inputData, this->data_set_size);
+	this->lower_corner = this->upper_corner = this->inputData[0];
+	for (auto &point : this->inputData)
+		for (unsigned k = 0; k < this->dim; k++)
+		{
+			this->lower_corner[k] = std::min(this->lower_corner[k], point[k]);
+			this->upper_corner[k] = std::max(this->upper_corner[k], point[k]);
+		}
+}
+
+// Log the facets left unexpanded in a cospherical region since the last report
+template <typename nodeType, typename indexType>
+void helixPipe<nodeType, indexType>::report_cospherical()
+{
+	size_t count = this->cospherical_facets.exchange(0);
+	if (count > 0)
+		this->ut.writeDebug("helixPipe", "Cospherical region found at " + std::to_string(count) + " facets");
+}
+
+/**
+ * @brief Expand the triangulation outwards from a shell of d-1 facets across all threads.
+ *
+ * Every (facet, omitted point) pair is a task of a work-stealing taskFrontier. A task finds the simplex
+ * on the far side of its facet and spawns a task for each of the other facets of that simplex. The facets
+ * and simplices seen so far are kept in concurrent hash maps: a facet is expanded by the first task that
+ * claims it, a facet claimed a second time already has a simplex on both sides and is marked closed, and a
+ * simplex reached from two facets at once is kept only once.
+ *
+ * @param d_1_shell The facets of the known simplices with the point opposite each one.
+ * @param dsimplexes Output; the new simplices are appended.
+ */
+template <typename nodeType, typename indexType>
+void helixPipe<nodeType, indexType>::expand_frontier(const std::vector<std::pair<std::vector<indexType>, indexType>> &d_1_shell, std::vector<std::vector<indexType>> &dsimplexes)
+{
+	concurrentHashMap<std::vector<indexType>, bool> facets;		// Claimed facets -> closed (a simplex is known on both sides)
+	concurrentHashMap<std::vector<indexType>, bool> simplices; // Simplices found so far
+	for (auto &simplex : dsimplexes)
+		simplices.insert(simplex, true);
+	for (auto &facet : d_1_shell)
+		facets.insert(facet.first, false);
+
+	std::vector<std::vector<std::vector<indexType>>> found(omp_get_max_threads());
+	taskFrontier<std::pair<std::vector<indexType>, indexType>> engine;
+	engine.run(d_1_shell, [&](std::pair<std::vector<indexType>, indexType> &task, auto &&spawn)
+				 {
+		bool closed = false;
+		if (facets.find(task.first, closed) && closed)
+			return;
+
+		std::vector<indexType> simplex = task.first;
+		indexType new_point = this->expand_d_minus_1_simplex(simplex, task.second);
+		if (new_point == -1)
+			return;
+		simplex.insert(std::lower_bound(simplex.begin(), simplex.end(), new_point), new_point);
+		if (!simplices.insert(simplex, true))
+			return;
+
+		for (size_t i = 0; i < simplex.size(); i++)
+		{
+			if (simplex[i] == new_point)
+				continue;
+			std::vector<indexType> key = simplex;
+			key.erase(key.begin() + i);
+			if (facets.insertOrVisit(key, false, [](bool &closed)
+									 { closed = true; }))
+				spawn(std::make_pair(std::move(key), simplex[i]));
+		}
+		found[omp_get_thread_num()].push_back(std::move(simplex)); });
+
+	for (auto &local : found)
+		std::move(local.begin(), local.end(), std::back_inserter(dsimplexes));
+}
+
+template <typename nodeType, typename indexType>
+void helixPipe<nodeType, indexType>::reduce(std::set<std::vector<indexType>> &outer_dsimplexes, std::vector<std::pair<std::vector<indexType>, indexType>> &inner_d_1_shell, std::vector<std::vector<indexType>> &dsimplexes)
 {
-	std::map<std::vector<short>, short> outer_d_1_shell;
+	std::map<std::vector<indexType>, indexType> outer_d_1_shell;
 	for (auto &new_simplex : outer_dsimplexes)
 	{
 		dsimplexes.emplace_back(new_simplex);
-		for (short i = 0; i < new_simplex.size(); i++)
+		for (size_t i = 0; i < new_simplex.size(); i++)
 		{
-			std::vector<short> key = new_simplex;
+			std::vector<indexType> key = new_simplex;
 			key.erase(key.begin() + i);
 			auto it = outer_d_1_shell.try_emplace(std::move(key), new_simplex[i]);
 			if (!it.second)
@@ -274,13 +333,9 @@ void helixPipe<nodeType>::reduce(std::set<std::vector<short>> &outer_dsimplexes,
 		}
 	}
 	outer_dsimplexes.clear();
-#ifndef NO_PARALLEL_ALGORITHMS
-	std::for_each(std::execution::par_unseq, inner_d_1_shell.begin(), inner_d_1_shell.end(), [&](const auto &simp)
-				  { outer_d_1_shell.erase(simp.first); }); // Remove faces from previous iteration
-#else
-	std::for_each(inner_d_1_shell.begin(), inner_d_1_shell.end(), [&](const auto &simp)
-				  { outer_d_1_shell.erase(simp.first); });
-#endif
+	// Remove faces from previous iteration; erasing rebalances the map, so this stays serial
+	for (auto &simp : inner_d_1_shell)
+		outer_d_1_shell.erase(simp.first);
 	inner_d_1_shell.clear();
 	inner_d_1_shell.reserve(outer_d_1_shell.size());
 	std::move(outer_d_1_shell.begin(), outer_d_1_shell.end(), std::back_inserter(inner_d_1_shell));
@@ -288,8 +343,8 @@ void helixPipe<nodeType>::reduce(std::set<std::vector<short>> &outer_dsimplexes,
 }
 
 // runPipe -> Run the configured functions of this pipeline segment
-template <typename nodeType>
-void helixPipe<nodeType>::runPipe(pipePacket<nodeType> &inData)
+template <typename nodeType, typename indexType>
+void helixPipe<nodeType, indexType>::runPipe(pipePacket<nodeType> &inData)
 {
 	this->inputData = inData.inputData;
 	this->data_set_size = this->inputData.size();
@@ -299,77 +354,64 @@ void helixPipe<nodeType>::runPipe(pipePacket<nodeType> &inData)
 	if (this->data_set_size < this->dim + 2)
 		return; // Not enough points
 
-	this->active_data.resize(this->data_set_size, 0);
+	this->prepare_search();
 
 	this->dsimplexmesh = {this->first_simplex()};
-	short new_point;
-#ifdef PARALLEL
-	std::vector<std::pair<std::vector<short>, short>> inner_d_1_shell;
-	for (auto &new_simplex : this->dsimplexmesh)
+	indexType new_point;
+	if (this->frontier != "serial")
 	{
-		for (auto &i : new_simplex)
+		std::vector<std::pair<std::vector<indexType>, indexType>> inner_d_1_shell;
+		for (auto &i : this->dsimplexmesh[0])
 		{
-			std::vector<short> key = new_simplex;
+			std::vector<indexType> key = this->dsimplexmesh[0];
 			key.erase(std::find(key.begin(), key.end(), i));
 			inner_d_1_shell.push_back(std::make_pair(key, i));
 		}
+		this->expand_frontier(inner_d_1_shell, this->dsimplexmesh);
 	}
-	std::set<std::vector<short>> outer_dsimplexes;
-	while (inner_d_1_shell.size() != 0)
-	{
-#pragma omp parallel for private(new_point, this->this->active_data)
-		for (int i = 0; i < inner_d_1_shell.size(); i++)
-		{
-			auto iter = inner_d_1_shell[i];
-			new_point = this->expand_d_minus_1_simplex(iter.first, iter.second, inData.distMatrix);
-			if (new_point == -1)
-				continue;
-			iter.first.push_back(new_point);
-			std::sort(iter.first.begin(), iter.first.end());
-			if (outer_dsimplexes.find(iter.first) == outer_dsimplexes.end())
-#pragma omp critical
-				outer_dsimplexes.insert(iter.first);
-		}
-		std::cout << "Intermediate dsimplex size " << outer_dsimplexes.size() << std::endl;
-		this->reduce(outer_dsimplexes, inner_d_1_shell, this->dsimplexmesh);
-	}
-#else
-	std::map<std::vector<short>, short> inner_d_1_shell;
-	for (auto &new_simplex : this->dsimplexmesh)
+	else
 	{
-		for (auto &i : new_simplex)
+		std::map<std::vector<indexType>, indexType> inner_d_1_shell;
+		for (auto &new_simplex : this->dsimplexmesh)
 		{
-			std::vector<short> key = new_simplex;
-			key.erase(std::find(key.begin(), key.end(), i));
-			inner_d_1_shell.emplace(key, i);
+			for (auto &i : new_simplex)
+			{
+				std::vector<indexType> key = new_simplex;
+				key.erase(std::find(key.begin(), key.end(), i));
+				inner_d_1_shell.emplace(key, i);
+			}
 		}
-	}
-	while (!inner_d_1_shell.empty())
-	{
-		auto iter = inner_d_1_shell.begin();
-		std::vector<short> first_vector = iter->first;
-		short omission = iter->second;
-		inner_d_1_shell.erase(iter);
-		new_point = this->expand_d_minus_1_simplex(first_vector, omission, inData.distMatrix);
-		if (new_point == -1)
-			continue;
-		first_vector.push_back(new_point);
-		std::sort(first_vector.begin(), first_vector.end());
-		this->dsimplexmesh.push_back(first_vector);
-		for (auto &i : first_vector)
+		while (!inner_d_1_shell.empty())
 		{
-			if (i == new_point)
+			auto iter = inner_d_1_shell.begin();
+			std::vector<indexType> first_vector = iter->first;
+			indexType omission = iter->second;
+			inner_d_1_shell.erase(iter);
+			new_point = this->expand_d_minus_1_simplex(first_vector, omission);
+			if (new_point == -1)
 				continue;
-			std::vector<short> key = first_vector;
-			key.erase(std::find(key.begin(), key.end(), i));
-			auto temp = inner_d_1_shell.emplace(key, i);
-			if (!temp.second)
-				inner_d_1_shell.erase(temp.first); // Create new shell and remove collided faces max only 2 can occur.
+			first_vector.push_back(new_point);
+			std::sort(first_vector.begin(), first_vector.end());
+			this->dsimplexmesh.push_back(first_vector);
+			for (auto &i : first_vector)
+			{
+				if (i == new_point)
+					continue;
+				std::vector<indexType> key = first_vector;
+				key.erase(std::find(key.begin(), key.end(), i));
+				auto temp = inner_d_1_shell.emplace(key, i);
+				if (!temp.second)
+					inner_d_1_shell.erase(temp.first); // Create new shell and remove collided faces max only 2 can occur.
+			}
 		}
 	}
-#endif
-	std::vector<std::vector<int>> cache(this->data_set_size, std::vector<int>(this->data_set_size, 0));
+	this->report_cospherical();
 	std::sort(this->dsimplexmesh.begin(),this->dsimplexmesh.end());
+	if (!this->debug)
+		return;
+
+	// Debug: print the n x n edge matrix of the triangulation
+	std::vector<std::vector<int>> cache(this->data_set_size, std::vector<int>(this->data_set_size, 0));
 	for (auto simplex : this->dsimplexmesh)
 		for (int i = 0; i < simplex.size() - 1; i++)
 			for (int j = i + 1; j < simplex.size(); j++)
@@ -390,16 +432,16 @@ void helixPipe<nodeType>::runPipe(pipePacket<nodeType> &inData)
 }
 
 // basePipe constructor
-template <typename nodeType>
-helixPipe<nodeType>::helixPipe()
+template <typename nodeType, typename indexType>
+helixPipe<nodeType, indexType>::helixPipe()
 {
 	this->pipeType = "helixPipe";
 	return;
 }
 
 // configPipe -> configure the function settings of this pipeline segment
-template <typename nodeType>
-bool helixPipe<nodeType>::configPipe(std::map<std::string, std::string> &configMap)
+template <typename nodeType, typename indexType>
+bool helixPipe<nodeType, indexType>::configPipe(std::map<std::string, std::string> &configMap)
 {
 	std::string strDebug;
 
@@ -415,14 +457,25 @@ bool helixPipe<nodeType>::configPipe(std::map<std::string, std::string> &configM
 
 	this->ut = utils(strDebug, this->outputFile);
 
+	pipe = configMap.find("frontier");
+	if (pipe != configMap.end())
+	{
+		if (configMap["frontier"] != "parallel" && configMap["frontier"] != "serial")
+		{
+			this->ut.writeError("helixPipe", "Unknown frontier '" + configMap["frontier"] + "' (parallel|serial)");
+			return false;
+		}
+		this->frontier = configMap["frontier"];
+	}
+
 	this->configured = true;
 	this->ut.writeDebug("helixPipe", "Configured with parameters { eps: " + configMap["epsilon"] + " , debug: " + strDebug + ", outputFile: " + this->outputFile + " }");
 
 	return true;
 }
 // outputData -> used for tracking each stage of the pipeline's data output without runtime
-template <typename nodeType>
-void helixPipe<nodeType>::outputData(pipePacket<nodeType> &inData)
+template <typename nodeType, typename indexType>
+void helixPipe<nodeType, indexType>::outputData(pipePacket<nodeType> &inData)
 {
 	std::ofstream file;
 	file.open("output/" + this->pipeType + "_output.csv");
@@ -441,5 +494,6 @@ void helixPipe<nodeType>::outputData(pipePacket<nodeType> &inData)
 }
 
 template class helixPipe<simplexNode>;
+template class helixPipe<wideSimplexNode>;
 template class helixPipe<alphaNode>;
 template class helixPipe<witnessNode>;
\ No newline at end of file
@@ -2,23 +2,38 @@
 
 #include "basePipe.hpp"
 #include "utils.hpp"
+#include "kdTree.hpp"
+#include <cstdint>
+#include <atomic>
 
 // basePipe constructor
-template <typename nodeType>
+//    Vertices are indexType (signed, -1 marks a missing point): int32_t triangulates up to 2^31 - 1 points. The complexes
+//    store vertices as unsigned, so wider indices are rejected. Circumspheres come from the coordinates in inputData, the pipe
+//    does not read distMatrix
+template <typename nodeType, typename indexType = int32_t>
 class helixPipe : public basePipe<nodeType>
 {
+  static_assert(sizeof(indexType) <= sizeof(unsigned), "helixPipe vertices are stored as unsigned in the complex");
+
 protected:
-  std::vector<double> active_data;
   std::vector<std::vector<double>> inputData;
-  std::vector<std::vector<short>> dsimplexmesh;
-  std::set<std::vector<short>> spherical_dsimplexes;
+  kdTree tree;                            // Candidate search of expand_facet
+  std::vector<double> lower_corner, upper_corner; // Bounding box of inputData
+  std::vector<std::vector<indexType>> dsimplexmesh;
+  std::set<std::vector<indexType>> spherical_dsimplexes;
   unsigned dim;
   unsigned data_set_size;
-  std::vector<double> solvePlaneEquation(const std::vector<short> &points);
-  std::vector<short> first_simplex();
-  void reduce(std::set<std::vector<short>> &outer_dsimplexes, std::vector<std::pair<std::vector<short>, short>> &inner_d_1_shell, std::vector<std::vector<short>> &dsimplexes);
-  void cospherical_handler(std::vector<short> &simp, int &tp, short &omission, std::vector<std::vector<double>> &distMatrix);
-  short expand_d_minus_1_simplex(std::vector<short> &simp_vector, short &omission, std::vector<std::vector<double>> &distMatrix);
+  std::string frontier = "parallel"; // Expansion of the d-1 shell (parallel|serial)
+  std::atomic<size_t> cospherical_facets = 0; // Facets left unexpanded in a cospherical region since the last report
+  std::vector<double> solvePlaneEquation(const std::vector<indexType> &points);
+  std::vector<indexType> first_simplex();
+  void prepare_search();
+  void reduce(std::set<std::vector<indexType>> &outer_dsimplexes, std::vector<std::pair<std::vector<indexType>, indexType>> &inner_d_1_shell, std::vector<std::vector<indexType>> &dsimplexes);
+  void cospherical_handler(std::vector<indexType> &simp, int &tp, indexType &omission);
+  indexType expand_d_minus_1_simplex(std::vector<indexType> &simp_vector, indexType &omission);
+  indexType expand_facet(std::vector<indexType> &simp, const std::vector<double> &normal, bool direction, indexType omission);
+  void report_cospherical();
+  void expand_frontier(const std::vector<std::pair<std::vector<indexType>, indexType>> &d_1_shell, std::vector<std::vector<indexType>> &dsimplexes);
 
 public:
   helixPipe();
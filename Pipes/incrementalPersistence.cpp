@@ -30,6 +30,13 @@ template <class nodeType>
 template <typename simplexNodePointer, typename comp>
 std::vector<simplexNodePointer> incrementalPersistence<nodeType>::incrementalByDimension(pipePacket<nodeType> &inData, std::vector<simplexNodePointer> &edges, std::vector<simplexNodePointer> pivots, unsigned dimension, comp compStruct, std::string mode, bool recordIntervals)
 {
+	// Flat storage -> the columns are records in the arena of the complex, and the cofacets of a column are records in a scratch
+	//	arena released once the column is reduced instead of nodes new'd and deleted one by one
+	constexpr bool flat = !std::is_same_v<simplexNodePointer, templateNode_P>;
+	typedef std::conditional_t<flat, simplexNodePointer, nodeType *> facePointer;
+	std::vector<std::byte> scratchBlock(flat ? 1 << 16 : 0);
+	std::pmr::monotonic_buffer_resource scratch(scratchBlock.data(), scratchBlock.size());
+
 	std::sort(edges.begin(), edges.end(), compStruct);
 	std::sort(pivots.begin(), pivots.end(), compStruct);
 
@@ -37,7 +44,7 @@ std::vector<simplexNodePointer> incrementalPersistence<nodeType>::incrementalByD
 
 	std::vector<simplexNodePointer> nextPivots;								   // Pivots for the next dimension
 	std::unordered_map<simplexNodePointer, std::vector<simplexNodePointer>> v; // Store only the reduction matrix V and compute R implicity
-	std::unordered_map<long long, simplexNodePointer> pivotPairs;			   // For each pivot, which column has that pivot
+	std::unordered_map<simplexKey, simplexNodePointer, indexHash> pivotPairs; // For each pivot, which column has that pivot
 
 	simplexArrayList<nodeType> *complex;
 	if (inData.complex->simplexType == "simplexArrayList" || inData.complex->simplexType == "alphaComplex")
@@ -61,9 +68,8 @@ std::vector<simplexNodePointer> incrementalPersistence<nodeType>::incrementalByD
 		{
 
 			// Get all cofacets using emergent pair optimization
-			std::vector<nodeType *> faceList = (mode == "homology" ? complex->getAllFacets(simplex, saveVertices, dimension)
-																   : (inData.complex->simplexType == "alphaComplex" ? inData.complex->getAllCofacets_basePointer(simplex)
-																													: complex->getAllCofacets(simplex, pivotPairs, true, saveVertices, dimension)));
+			std::vector<facePointer> faceList;
+			columnFaces(inData, complex, simplex, dimension, mode, pivotPairs, true, scratch, faceList);
 
 			std::vector<simplexNodePointer> columnV; // Reduction column of matrix V
 			columnV.push_back(simplex);				 // Initially V=I -> 1's along diagonal
@@ -73,7 +79,7 @@ std::vector<simplexNodePointer> incrementalPersistence<nodeType>::incrementalByD
 
 			while (true)
 			{
-				nodeType *pivot;
+				facePointer pivot;
 
 				while (!faceList.empty())
 				{
@@ -85,8 +91,11 @@ std::vector<simplexNodePointer> incrementalPersistence<nodeType>::incrementalByD
 
 					if (!faceList.empty() && pivot->hash == faceList.front()->hash)
 					{ // Coface is in twice -> evaluates to 0 mod 2
-						delete pivot;
-						delete faceList.front();
+						if constexpr (!flat)
+						{
+							delete pivot;
+							delete faceList.front();
+						}
 
 						// Rotate the heap
 						std::pop_heap(faceList.begin(), faceList.end(), compStruct);
@@ -108,7 +117,10 @@ std::vector<simplexNodePointer> incrementalPersistence<nodeType>::incrementalByD
 				else if (pivotPairs.find(pivot->hash) == pivotPairs.end())
 				{ // Column cannot be reduced
 					pivotPairs.insert({pivot->hash, simplex});
-					nextPivots.push_back(std::shared_ptr<nodeType>(pivot));
+					if constexpr (flat) // The pivot outlives the scratch arena -> keep a copy in the arena of the complex
+						nextPivots.push_back(std::construct_at(complex->template arenaArray<std::remove_pointer_t<simplexNodePointer>>(1).data(), *pivot));
+					else
+						nextPivots.push_back(std::shared_ptr<nodeType>(pivot));
 
 					std::sort(columnV.begin(), columnV.end(), compStruct);
 					auto it = columnV.begin();
@@ -123,22 +135,30 @@ std::vector<simplexNodePointer> incrementalPersistence<nodeType>::incrementalByD
 
 					if (recordIntervals && simplex->weight != pivot->weight)
 					{
-						// If we haven't saved the vertices in each simplex, we need to recover them now to determine the boundary points
-						if (!saveVertices && inData.complex->simplexType != "alphaComplex")
+						std::set<unsigned> boundaryPoints;
+						if constexpr (flat)
+							boundaryPoints = this->ut.extractBoundaryPoints(v[simplex], mode == "homology" ? dimension + 1 : dimension);
+						else
 						{
-							for (simplexNodePointer simplex : v[simplex])
+							// If we haven't saved the vertices in each simplex, we need to recover them now to determine the boundary points
+							if (!saveVertices && inData.complex->simplexType != "alphaComplex")
 							{
-								simplex->simplex = complex->getVertices(simplex->hash, dimension + 1, nPts);
+								for (simplexNodePointer simplex : v[simplex])
+								{
+									simplex->simplex = complex->getVertices((simplexKey)simplex->hash, dimension + 1, nPts);
+								}
 							}
+							boundaryPoints = this->ut.extractBoundaryPoints(v[simplex]);
 						}
 
-						bettiBoundaryTableEntry des = {dimension, std::min(pivot->weight, simplex->weight), std::max(pivot->weight, simplex->weight), this->ut.extractBoundaryPoints(v[simplex])};
+						bettiBoundaryTableEntry des = {dimension, std::min(pivot->weight, simplex->weight), std::max(pivot->weight, simplex->weight), boundaryPoints};
 						inData.bettiTable.push_back(des);
 					}
 
 					// Don't delete the first entry because that is converted to a smart pointer and stored as a pivot
-					for (int i = 1; i < faceList.size(); i++)
-						delete faceList[i];
+					if constexpr (!flat)
+						for (size_t i = 1; i < faceList.size(); i++)
+							delete faceList[i];
 
 					break;
 				}
@@ -148,12 +168,12 @@ std::vector<simplexNodePointer> incrementalPersistence<nodeType>::incrementalByD
 					for (simplexNodePointer simp : v[pivotPairs[pivot->hash]])
 					{
 						columnV.push_back(simp);
-						std::vector<nodeType *> faces = (mode == "homology" ? complex->getAllFacets(simp, saveVertices, dimension) : (inData.complex->simplexType == "alphaComplex" ? inData.complex->getAllCofacets_basePointer(simp) : complex->getAllCofacets(simp, pivotPairs, false, saveVertices, dimension)));
-						faceList.insert(faceList.end(), faces.begin(), faces.end());
+						columnFaces(inData, complex, simp, dimension, mode, pivotPairs, false, scratch, faceList);
 					}
 					std::make_heap(faceList.begin(), faceList.end(), compStruct);
 				}
 			}
+			scratch.release();
 			// Was a pivot, skip the evaluation and queue next pivot
 		}
 		else
@@ -163,6 +183,61 @@ std::vector<simplexNodePointer> incrementalPersistence<nodeType>::incrementalByD
 	return nextPivots;
 }
 
+// columnFaces -> Append the faces of a column to faces: facets for homology, cofacets for cohomology (emergent pairs end the
+//	enumeration early when checkEmergent is set)
+template <typename nodeType>
+void incrementalPersistence<nodeType>::columnFaces(pipePacket<nodeType> &inData, simplexArrayList<nodeType> *complex, const templateNode_P &simplex, unsigned dimension, const std::string &mode, const std::unordered_map<simplexKey, templateNode_P, indexHash> &pivotPairs, bool checkEmergent, std::pmr::memory_resource &, std::vector<nodeType *> &faces)
+{
+	std::vector<nodeType *> ret = (mode == "homology" ? complex->getAllFacets(simplex, saveVertices, dimension)
+													  : (inData.complex->simplexType == "alphaComplex" ? inData.complex->getAllCofacets_basePointer(simplex)
+																									   : complex->getAllCofacets(simplex, pivotPairs, checkEmergent, saveVertices, dimension)));
+	faces.insert(faces.end(), ret.begin(), ret.end());
+}
+
+// Flat records -> the faces are built in the scratch arena of the column; homology columns are the (dimension + 1)-simplex
+//	pivots of the cohomology pass
+template <typename nodeType>
+template <unsigned maxVertices>
+void incrementalPersistence<nodeType>::columnFaces(pipePacket<nodeType> &, simplexArrayList<nodeType> *complex, flatRecord<maxVertices> *simplex, unsigned dimension, const std::string &mode, const std::unordered_map<simplexKey, flatRecord<maxVertices> *, indexHash> &pivotPairs, bool checkEmergent, std::pmr::memory_resource &scratch, std::vector<flatRecord<maxVertices> *> &faces)
+{
+	if (mode == "homology")
+		complex->getAllFacets(*simplex, dimension + 1, scratch, faces);
+	else
+		complex->getAllCofacets(*simplex, dimension, pivotPairs, checkEmergent, scratch, faces);
+}
+
+// flatPersistence -> Reduce each dimension of a complex in flat storage, starting from the edges and the dim 0 pivots
+//	Each dimension is expanded from the previous one into an array in the arena of the complex, and the whole complex
+//	(with the pivots kept between dimensions) is freed at once by releasing the arena
+template <typename nodeType>
+template <unsigned maxVertices>
+void incrementalPersistence<nodeType>::flatPersistence(pipePacket<nodeType> &inData, simplexArrayList<nodeType> *complex, const std::vector<templateNode_P> &edges, const std::vector<templateNode_P> &pivots)
+{
+	flatDimension<maxVertices> simplices = complex->template flatten<maxVertices>(edges);
+	flatDimension<maxVertices> edgePivots = complex->template flatten<maxVertices>(pivots);
+
+	std::vector<flatRecord<maxVertices> *> columns, flatPivots(edgePivots.size());
+	for (size_t i = 0; i < edgePivots.size(); i++)
+		flatPivots[i] = &edgePivots[i];
+
+	for (unsigned d = 1; d < (unsigned)dim && !simplices.empty(); d++)
+	{
+		if (d != 1)
+			simplices = complex->expandFlat(simplices, d);
+
+		columns.resize(simplices.size());
+		for (size_t i = 0; i < columns.size(); i++)
+			columns[i] = &simplices[i];
+		flatPivots = incrementalByDimension(inData, columns, flatPivots, d, sortReverseLexicographic(), "cohomology", inv != "true");
+
+		// Representative cycles -> homology on the pivot columns
+		if (inv == "true")
+			incrementalByDimension(inData, flatPivots, std::vector<flatRecord<maxVertices> *>(), d, sortLexicographic(), "homology", true);
+	}
+
+	complex->releaseArena();
+}
+
 // runPipe -> Run the configured functions of this pipeline segment
 //
 //	IncrementalPersistence: For computing the persistence pairs from simplicial complex:
@@ -183,15 +258,15 @@ void incrementalPersistence<nodeType>::runPipe(pipePacket<nodeType> &inData)
 	}
 
 	// Get the set of all points
-	auto e = complex->getDimEdges(0);
+	const auto &e = complex->getDimEdges(0);
 	// Convert the set to a vector
 	std::vector<std::shared_ptr<nodeType>> edges = std::vector<std::shared_ptr<nodeType>>(e.begin(), e.end());
+	nPts = e.size(); // Read before expanding; the alpha complex releases its vertices when building the edges
 	// Initialize the binomial table
 	complex->initBinom();
 	// Get the next dimension (edges)
 	edges = inData.complex->simplexType == "alphaComplex" ? complex->expanddelaunayDimension(1) : complex->expandDimension(edges);
 
-	nPts = e.size();
 	// Some notes on fast persistence:
 
 	//	-Vectors need to be stored in a lexicograhically ordered set of decreasing (d+1)-tuples (e.g. {3, 1, 0})
@@ -276,19 +351,29 @@ void incrementalPersistence<nodeType>::runPipe(pipePacket<nodeType> &inData)
 
 	bool involuted = (inv == "true");
 
-	for (unsigned d = 1; d < dim && !edges.empty(); d++)
+	if (storage == "flat" && inData.complex->simplexType == "simplexArrayList")
 	{
-		// //If d=1, we have already expanded the points into edges
-		// //Otherwise, we need to generate the higher dimensional edges (equivalent to simplexList[d])
-		if (d != 1)
-			edges = inData.complex->simplexType == "alphaComplex" ? complex->expanddelaunayDimension(d) : complex->expandDimension(edges, saveVertices, d);
+		// Flat storage -> the edges and everything above them are flatSimplex records in the arena of the complex, sized
+		//	for the dim + 1 vertices of the largest simplex
+		flatDispatch(dim, [&]<unsigned maxVertices>()
+					 { flatPersistence<maxVertices>(inData, complex, edges, pivots); });
+	}
+	else
+	{
+		for (unsigned d = 1; d < dim && !edges.empty(); d++)
+		{
+			// //If d=1, we have already expanded the points into edges
+			// //Otherwise, we need to generate the higher dimensional edges (equivalent to simplexList[d])
+			if (d != 1)
+				edges = inData.complex->simplexType == "alphaComplex" ? complex->expanddelaunayDimension(d) : complex->expandDimension(edges, saveVertices, d);
 
-		pivots = incrementalByDimension(inData, edges, pivots, d, sortReverseLexicographic(), "cohomology", !involuted);
+			pivots = incrementalByDimension(inData, edges, pivots, d, sortReverseLexicographic(), "cohomology", !involuted);
 
-		// To recover the representative cycles from the cocycles, we compute homology on just the pivot columns
-		if (involuted)
-		{
-			incrementalByDimension(inData, pivots, std::vector<std::shared_ptr<nodeType>>(), d, sortLexicographic(), "homology", true);
+			// To recover the representative cycles from the cocycles, we compute homology on just the pivot columns
+			if (involuted)
+			{
+				incrementalByDimension(inData, pivots, std::vector<std::shared_ptr<nodeType>>(), d, sortLexicographic(), "homology", true);
+			}
 		}
 	}
 
@@ -365,6 +450,16 @@ bool incrementalPersistence<nodeType>::configPipe(std::map<std::string, std::str
 	else
 		return false;
 
+	pipe = configMap.find("storage");
+	if (pipe != configMap.end())
+		this->storage = configMap["storage"];
+	std::string error = storageError(this->storage, this->dim);
+	if (!error.empty())
+	{
+		this->ut.writeError("incrementalPersistence", error);
+		return false;
+	}
+
 	pipe = configMap.find("epsilon");
 	if (pipe != configMap.end())
 		this->maxEpsilon = std::atof(configMap["epsilon"].c_str());
@@ -376,12 +471,13 @@ bool incrementalPersistence<nodeType>::configPipe(std::map<std::string, std::str
 		this->fnmod = configMap["fn"];
 
 	this->configured = true;
-	this->ut.writeDebug("incrementalPersistence", "Configured with parameters { dim: " + configMap["dimensions"] + ", complexType: " + configMap["complexType"] + ", eps: " + configMap["epsilon"]);
+	this->ut.writeDebug("incrementalPersistence", "Configured with parameters { dim: " + configMap["dimensions"] + ", complexType: " + configMap["complexType"] + ", eps: " + configMap["epsilon"] + ", storage: " + this->storage);
 	this->ut.writeDebug("incrementalPersistence", "\t\t\t\tdebug: " + strDebug + ", outputFile: " + this->outputFile + " }");
 
 	return true;
 }
 
 template class incrementalPersistence<simplexNode>;
+template class incrementalPersistence<wideSimplexNode>;
 template class incrementalPersistence<alphaNode>;
 template class incrementalPersistence<witnessNode>;
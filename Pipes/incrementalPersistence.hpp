@@ -4,8 +4,10 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <memory_resource>
 #include "basePipe.hpp"
 #include "simplexBase.hpp"
+#include "simplexArrayList.hpp"
 #include "utils.hpp"
 #include "unionFind.hpp"
 
@@ -19,6 +21,7 @@ private:
 	std::string inv = "false";
 
 	bool saveVertices = false; // Should we save the vertices of the simplices, or just their hashes
+	std::string storage = "nodes";
 
 	struct sortReverseLexicographic
 	{ // Sort nodes by weight, then by reverse lexicographic order
@@ -53,6 +56,18 @@ private:
 	};
 
 	typedef std::shared_ptr<nodeType> templateNode_P;
+	template <unsigned maxVertices>
+	using flatRecord = typename simplexArrayList<nodeType>::template flatRecord<maxVertices>;
+	template <unsigned maxVertices>
+	using flatDimension = typename simplexArrayList<nodeType>::template flatDimension<maxVertices>;
+
+	// Faces of a column of incrementalByDimension: nodes are new'd (and deleted by the reduction), flat records are carved from scratch
+	void columnFaces(pipePacket<nodeType> &, simplexArrayList<nodeType> *, const templateNode_P &, unsigned, const std::string &, const std::unordered_map<simplexKey, templateNode_P, indexHash> &, bool, std::pmr::memory_resource &, std::vector<nodeType *> &);
+	template <unsigned maxVertices>
+	void columnFaces(pipePacket<nodeType> &, simplexArrayList<nodeType> *, flatRecord<maxVertices> *, unsigned, const std::string &, const std::unordered_map<simplexKey, flatRecord<maxVertices> *, indexHash> &, bool, std::pmr::memory_resource &, std::vector<flatRecord<maxVertices> *> &);
+
+	template <unsigned maxVertices>
+	void flatPersistence(pipePacket<nodeType> &, simplexArrayList<nodeType> *, const std::vector<templateNode_P> &, const std::vector<templateNode_P> &);
 
 public:
 	int dim;
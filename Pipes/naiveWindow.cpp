@@ -72,7 +72,7 @@ void naiveWindow<nodeType>::runPipe(pipePacket<nodeType> &inData)
 				{
 					inData.workData = windowValues;
 
-					distMatrix.resize(inData.workData.size(), std::vector<double>(inData.workData.size(), 0));
+					distMatrix.resize(inData.workData.size());
 
 					// Iterate through each vector
 					for (unsigned i = 0; i < inData.workData.size(); i++)
@@ -87,7 +87,7 @@ void naiveWindow<nodeType>::runPipe(pipePacket<nodeType> &inData)
 								auto dist = this->ut.vectors_distance(inData.workData[i], inData.workData[j]);
 
 								if (dist < epsilon)
-									distMatrix[i][j] = dist;
+									distMatrix.set(i, j, dist);
 							}
 						}
 					}
@@ -258,5 +258,6 @@ void naiveWindow<nodeType>::outputData(pipePacket<nodeType> &inData)
 }
 
 template class naiveWindow<simplexNode>;
+template class naiveWindow<wideSimplexNode>;
 template class naiveWindow<alphaNode>;
 template class naiveWindow<witnessNode>;
@@ -17,7 +17,7 @@ private:
   std::map<std::string, std::string> subConfigMap;
   // void runComplexInitializer(pipePacket &);
 public:
-  std::vector<std::vector<double>> distMatrix;
+  distanceMatrix distMatrix;
   naiveWindow();
   void runPipe(pipePacket<nodeType> &);
   void outputData(pipePacket<nodeType> &);
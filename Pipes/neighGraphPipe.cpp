@@ -83,8 +83,8 @@ void neighGraphPipe<nodeType>::outputData(pipePacket<nodeType> &inData)
 {
 	std::ofstream file("output/" + this->pipeType + "_output.csv");
 
-	auto edges = inData.complex->getAllEdges();
-	for (auto edge : edges)
+	const auto &edges = inData.complex->getAllEdges();
+	for (auto &edge : edges)
 	{
 		for (auto a : edge)
 		{
@@ -104,5 +104,6 @@ void neighGraphPipe<nodeType>::outputData(pipePacket<nodeType> &inData)
 
 // Explicit Template Class Instantiation
 template class neighGraphPipe<simplexNode>;
+template class neighGraphPipe<wideSimplexNode>;
 template class neighGraphPipe<alphaNode>;
 template class neighGraphPipe<witnessNode>;
@@ -57,10 +57,9 @@ size_t pipePacket<nodeType>::getSize()
 	size += centroidLabels.size() * sizeof(centroidLabels[0]);
 
 	// 4. Calculate size of the distance matrix
-	for (auto& row : distMatrix)
-	{
-		size += row.size() * sizeof(row[0]);
-	}
+	size += distMatrix.getSize();
+	size += neighborhoodGraph.getSize();
+	size += incidenceMatrix.getSize();
 
 	// 5. Calculate size of complex storage
 	size += complex->getSize();
@@ -91,5 +90,6 @@ size_t pipePacket<nodeType>::getSize()
 
 // Explicit Template Class Instantiation
 template class pipePacket<simplexNode>;
+template class pipePacket<wideSimplexNode>;
 template class pipePacket<alphaNode>;
 template class pipePacket<witnessNode>;
@@ -1,5 +1,6 @@
 #pragma once
 #include "simplexBase.hpp"
+#include "distanceMatrix.hpp"
 #include <set>
 
 // Header file for pipePacket class - see pipePacket.cpp for descriptions
@@ -19,8 +20,9 @@ public:
 	std::vector<std::vector<double>> workData;
 	std::vector<unsigned> centroidLabels;
 	std::vector<std::vector<double>> inputData;
-	std::vector<std::vector<double>> distMatrix;
-	std::vector<std::vector<bool>> incidenceMatrix;
+	distanceMatrix distMatrix;
+	neighborGraph neighborhoodGraph;
+	bitMatrix incidenceMatrix;
 	simplexBase<nodeType> *complex = nullptr;
 
 	std::vector<std::set<unsigned>> boundaries;
@@ -239,7 +239,7 @@ void qhullPipe<nodeType>::outputData(pipePacket<nodeType> &inData)
 
 	file.open("output/" + inData.complex->complexType + "_output.csv");
 
-	for (auto a : inData.complex->simplexList)
+	for (auto &a : inData.complex->simplexList)
 	{
 		for (auto d : a)
 		{
@@ -258,5 +258,6 @@ void qhullPipe<nodeType>::outputData(pipePacket<nodeType> &inData)
 }
 
 template class qhullPipe<simplexNode>;
+template class qhullPipe<wideSimplexNode>;
 template class qhullPipe<alphaNode>;
 template class qhullPipe<witnessNode>;
@@ -31,17 +31,27 @@ template <typename nodeType>
 void ripsPipe<nodeType>::runPipe(pipePacket<nodeType> &inData)
 {
 
-	inData.complex->expandDimensions(dim);
+	// Collapse the dominated edges of the 1-skeleton first; the higher dimensions are then expanded from the remaining edges
+	if (collapse == "true" || collapse == "1")
+	{
+		inData.complex->expandDimensions(std::min(dim, 1));
+		this->ut.writeDebug("ripsPipe", "1-Skeleton Size: " + std::to_string(inData.complex->simplexCount()));
+
+		inData.complex->reduceComplex();
+
+		this->ut.writeDebug("ripsPipe", "Reduced 1-Skeleton Size: " + std::to_string(inData.complex->simplexCount()));
+	}
+
+	// Implicit complexes only store the edges; fastPersistence enumerates the higher simplices from their indices
+	//	Flat storage also stops at the edges; the persistence pipes expand the higher dimensions into the arena of the complex
+	if ((implicit == "true" && (inData.complex->simplexType == "simplexArrayList" || inData.complex->simplexType == "sparseRips" || inData.complex->simplexType == "witnessComplex")) || (storage == "flat" && (inData.complex->simplexType == "simplexArrayList" || inData.complex->simplexType == "sparseRips")))
+		inData.complex->expandDimensions(std::min(dim, 1));
+	else
+		inData.complex->expandDimensions(dim);
 
 	this->ut.writeDebug("ripsPipe", "Expanded Complex Size: " + std::to_string(inData.complex->simplexCount()));
 	this->ut.writeDebug("ripsPipe", "Expanded Complex Mem: " + std::to_string(inData.complex->getSize()));
 
-	/*if(collapse == "true" || collapse == "1"){
-		inData.complex->reduceComplex();
-
-		this->ut.writeDebug("ripsPipe","Reduced Complex Size: " + std::to_string(inData.complex->simplexCount()));
-		this->ut.writeDebug("ripsPipe", "Reduced Complex Mem: " + std::to_string(inData.complex->getSize()));
-	}*/
 	return;
 }
 
@@ -73,8 +83,16 @@ bool ripsPipe<nodeType>::configPipe(std::map<std::string, std::string> &configMa
 	if (pipe != configMap.end())
 		this->collapse = configMap["collapse"];
 
+	pipe = configMap.find("implicit");
+	if (pipe != configMap.end())
+		this->implicit = configMap["implicit"];
+
+	pipe = configMap.find("storage");
+	if (pipe != configMap.end())
+		this->storage = configMap["storage"];
+
 	this->configured = true;
-	this->ut.writeDebug("ripsPipe", "Configured with parameters { dim: " + std::to_string(dim) + " , debug: " + strDebug + ", outputFile: " + this->outputFile + ", collapse: " + this->collapse + " }");
+	this->ut.writeDebug("ripsPipe", "Configured with parameters { dim: " + std::to_string(dim) + " , debug: " + strDebug + ", outputFile: " + this->outputFile + ", collapse: " + this->collapse + ", implicit: " + this->implicit + ", storage: " + this->storage + " }");
 
 	return true;
 }
@@ -106,5 +124,6 @@ void ripsPipe<nodeType>::outputData(pipePacket<nodeType> &inData)
 }
 
 template class ripsPipe<simplexNode>;
+template class ripsPipe<wideSimplexNode>;
 template class ripsPipe<alphaNode>;
 template class ripsPipe<witnessNode>;
@@ -10,6 +10,8 @@ class ripsPipe : public basePipe<nodeType>
 private:
 public:
   std::string collapse;
+  std::string implicit = "false";
+  std::string storage = "nodes";
   int dim;
   ripsPipe();
   void runPipe(pipePacket<nodeType> &);
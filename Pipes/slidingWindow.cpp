@@ -261,7 +261,7 @@ void slidingWindow<nodeType>::updateStats()
     // pPack->complex->distMatrix->push_back( distMatLastRow );
     distMatrix.push_back(distMatLastRow);
 
-    // pPack.complex->setDistanceMatrix(&distMatrix);
+    // pPack.complex->setWindowDistanceMatrix(&distMatrix);
 
     // Update the average NN distance of the partition from which the last point was deleted and of the one to which the new point
     // is being added.
@@ -642,7 +642,7 @@ void slidingWindow<nodeType>::runPipe(pipePacket<nodeType> &inData)
                         }
                     }
 
-                    tempData.complex->setDistanceMatrix(&distMatrix);
+                    tempData.complex->setWindowDistanceMatrix(&distMatrix);
 
                     for (auto a : windowValues)
                         tempData.complex->insert();
@@ -822,5 +822,6 @@ void slidingWindow<nodeType>::outputData(pipePacket<nodeType> &inData)
 }
 
 template class slidingWindow<simplexNode>;
+template class slidingWindow<wideSimplexNode>;
 template class slidingWindow<alphaNode>;
 template class slidingWindow<witnessNode>;
@@ -0,0 +1,123 @@
+/*
+ * sparseNeighGraphPipe hpp + cpp extend the basePipe class for building the
+ * sparse epsilon-neighborhood graph from data input, without a dense distance matrix
+ *
+ */
+
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include "sparseNeighGraphPipe.hpp"
+
+template <typename nodeType>
+sparseNeighGraphPipe<nodeType>::sparseNeighGraphPipe()
+{
+	/**
+		sparseNeighGraphPipe()
+
+		@brief Class constructor
+		@tparam nodeType The data type of the simplex node.
+	*/
+	this->pipeType = "sparseNeighGraph";
+	return;
+}
+
+template <typename nodeType>
+void sparseNeighGraphPipe<nodeType>::runPipe(pipePacket<nodeType> &inData)
+{
+	/**
+		runPipe(pipePacket<nodeType> &inData)
+
+		@brief Builds the CSR epsilon-neighborhood graph of the point cloud from kdTree radius queries and inserts the vertices into the complex.
+			Replaces distMatrix.neighGraph; memory and build time scale with the number of edges rather than n^2.
+		@tparam nodeType The data type of the simplex node.
+		@param inData The pipePacket data being used in the pipeline.
+	*/
+	inData.neighborhoodGraph.build(inData.workData, epsilon);
+	inData.complex->setNeighborGraph(&inData.neighborhoodGraph);
+
+	// Iterate through each vector, inserting into simplex storage
+	for (unsigned i = 0; i < inData.workData.size(); i++)
+	{
+		if (!inData.workData[i].empty())
+			inData.complex->insert();
+	}
+
+	this->ut.writeDebug("sparseNeighGraph", "\tNeighborhood graph: " + std::to_string(inData.neighborhoodGraph.size()) + " vertices, " + std::to_string(inData.neighborhoodGraph.edgeCount()) + " edges");
+	return;
+}
+
+template <typename nodeType>
+bool sparseNeighGraphPipe<nodeType>::configPipe(std::map<std::string, std::string> &configMap)
+{
+	/**
+		configPipe(std::map<std::string, std::string> &configMap)
+
+		@brief Configures the pipe and sets arguments based on the configMap passed. Called before execution (runPipe). If required values not found or configuration is invalid, returns false.
+		@tparam nodeType The data type of the simplex node.
+		@param configMap The configuration map for this pipeline
+		@return boolean
+	*/
+	std::string strDebug;
+
+	auto pipe = configMap.find("debug");
+	if (pipe != configMap.end())
+	{
+		this->debug = std::atoi(configMap["debug"].c_str());
+		strDebug = configMap["debug"];
+	}
+	pipe = configMap.find("outputFile");
+	if (pipe != configMap.end())
+		this->outputFile = configMap["outputFile"].c_str();
+
+	this->ut = utils(strDebug, this->outputFile);
+
+	pipe = configMap.find("epsilon");
+	if (pipe != configMap.end())
+		this->epsilon = std::atof(configMap["epsilon"].c_str());
+	else
+		return false;
+
+	pipe = configMap.find("dimensions");
+	if (pipe != configMap.end())
+		this->dim = std::atoi(configMap["dimensions"].c_str());
+	else
+		return false;
+
+	this->configured = true;
+	this->ut.writeDebug("sparseNeighGraphPipe", "Configured with parameters { dim: " + std::to_string(dim) + " , eps: " + configMap["epsilon"] + " , debug: " + strDebug + ", outputFile: " + this->outputFile + " }");
+
+	return true;
+}
+
+template <typename nodeType>
+void sparseNeighGraphPipe<nodeType>::outputData(pipePacket<nodeType> &inData)
+{
+	/**
+		outputData(pipePacket<nodeType> &inData)
+
+		@brief Outputs the neighborhood graph as an edge list (i, j, weight) to a file if debug mode is true.
+		@tparam nodeType The data type of the simplex node.
+		@param inData The pipePacket data being used in the pipeline.
+	*/
+	std::ofstream file("output/" + this->pipeType + "_output.csv");
+
+	const neighborGraph &graph = inData.neighborhoodGraph;
+	for (unsigned i = 0; i < graph.size(); i++)
+	{
+		const double *w = graph.weightsBegin(i);
+		for (const unsigned *j = graph.neighborsBegin(i); j != graph.neighborsEnd(i); ++j, ++w)
+			if (*j > i)
+				file << i << "," << *j << "," << *w << "\n";
+	}
+
+	file.close();
+	return;
+}
+
+// Explicit Template Class Instantiation
+template class sparseNeighGraphPipe<simplexNode>;
+template class sparseNeighGraphPipe<wideSimplexNode>;
+template class sparseNeighGraphPipe<alphaNode>;
+template class sparseNeighGraphPipe<witnessNode>;
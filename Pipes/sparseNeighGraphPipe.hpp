@@ -0,0 +1,19 @@
+#pragma once
+
+// Header file for sparseNeighGraphPipe class - see sparseNeighGraphPipe.cpp for descriptions
+#include <map>
+#include "basePipe.hpp"
+
+template <typename nodeType>
+class sparseNeighGraphPipe : public basePipe<nodeType>
+{
+private:
+  double epsilon;
+  int dim;
+
+public:
+  sparseNeighGraphPipe();
+  void runPipe(pipePacket<nodeType> &);
+  void outputData(pipePacket<nodeType> &);
+  bool configPipe(std::map<std::string, std::string> &);
+};
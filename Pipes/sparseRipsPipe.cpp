@@ -0,0 +1,137 @@
+/*
+ * sparseRipsPipe hpp + cpp extend the basePipe class for building the
+ * sparse Rips filtration (greedy permutation + relaxed edge weights) from data input
+ *
+ */
+
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include "sparseRipsPipe.hpp"
+#include "sparseRipsComplex.hpp"
+
+template <typename nodeType>
+sparseRipsPipe<nodeType>::sparseRipsPipe()
+{
+	/**
+		sparseRipsPipe()
+
+		@brief Class constructor
+		@tparam nodeType The data type of the simplex node.
+	*/
+	this->pipeType = "sparseRips";
+	return;
+}
+
+template <typename nodeType>
+void sparseRipsPipe<nodeType>::runPipe(pipePacket<nodeType> &inData)
+{
+	/**
+		runPipe(pipePacket<nodeType> &inData)
+
+		@brief Builds the linear-size sparse Rips graph of the point cloud and inserts the vertices into the complex.
+			Replaces distMatrix.neighGraph; ripsPipe expands the flag complex of the sparse graph afterwards.
+		@tparam nodeType The data type of the simplex node.
+		@param inData The pipePacket data being used in the pipeline.
+	*/
+	((sparseRipsComplex<nodeType> *)inData.complex)->buildSparseRips(inData.workData, sparsity);
+
+	// Iterate through each vector, inserting into simplex storage
+	for (unsigned i = 0; i < inData.workData.size(); i++)
+	{
+		if (!inData.workData[i].empty())
+			inData.complex->insert();
+	}
+
+	return;
+}
+
+template <typename nodeType>
+bool sparseRipsPipe<nodeType>::configPipe(std::map<std::string, std::string> &configMap)
+{
+	/**
+		configPipe(std::map<std::string, std::string> &configMap)
+
+		@brief Configures the pipe and sets arguments based on the configMap passed. Called before execution (runPipe). If required values not found or configuration is invalid, returns false.
+		@tparam nodeType The data type of the simplex node.
+		@param configMap The configuration map for this pipeline
+		@return boolean
+	*/
+	std::string strDebug;
+
+	auto pipe = configMap.find("debug");
+	if (pipe != configMap.end())
+	{
+		this->debug = std::atoi(configMap["debug"].c_str());
+		strDebug = configMap["debug"];
+	}
+	pipe = configMap.find("outputFile");
+	if (pipe != configMap.end())
+		this->outputFile = configMap["outputFile"].c_str();
+
+	this->ut = utils(strDebug, this->outputFile);
+
+	if (configMap["complexType"] != "sparseRips")
+	{
+		this->ut.writeError("sparseRipsPipe", "The sparseRips pipe requires complexType=sparseRips");
+		return false;
+	}
+
+	pipe = configMap.find("sparsity");
+	if (pipe != configMap.end())
+	{
+		// The relaxed weights divide by sparsity and by 1 - sparsity
+		this->sparsity = std::atof(configMap["sparsity"].c_str());
+		if (!(this->sparsity > 0 && this->sparsity < 1))
+		{
+			this->ut.writeError("sparseRipsPipe", "Sparsity " + configMap["sparsity"] + " is outside (0,1)");
+			return false;
+		}
+	}
+
+	pipe = configMap.find("dimensions");
+	if (pipe != configMap.end())
+		this->dim = std::atoi(configMap["dimensions"].c_str());
+	else
+		return false;
+
+	this->configured = true;
+	this->ut.writeDebug("sparseRipsPipe", "Configured with parameters { dim: " + std::to_string(dim) + " , sparsity: " + std::to_string(sparsity) + " , debug: " + strDebug + ", outputFile: " + this->outputFile + " }");
+
+	return true;
+}
+
+template <typename nodeType>
+void sparseRipsPipe<nodeType>::outputData(pipePacket<nodeType> &inData)
+{
+	/**
+		outputData(pipePacket<nodeType> &inData)
+
+		@brief Outputs the sparse Rips graph as an edge list (i, j, weight) to a file if debug mode is true.
+		@tparam nodeType The data type of the simplex node.
+		@param inData The pipePacket data being used in the pipeline.
+	*/
+	if (inData.complex->neighGraph == nullptr)
+		return;
+
+	std::ofstream file("output/" + this->pipeType + "_output.csv");
+
+	const neighborGraph &graph = *inData.complex->neighGraph;
+	for (unsigned i = 0; i < graph.size(); i++)
+	{
+		const double *w = graph.weightsBegin(i);
+		for (const unsigned *j = graph.neighborsBegin(i); j != graph.neighborsEnd(i); ++j, ++w)
+			if (*j > i)
+				file << i << "," << *j << "," << *w << "\n";
+	}
+
+	file.close();
+	return;
+}
+
+// Explicit Template Class Instantiation
+template class sparseRipsPipe<simplexNode>;
+template class sparseRipsPipe<wideSimplexNode>;
+template class sparseRipsPipe<alphaNode>;
+template class sparseRipsPipe<witnessNode>;
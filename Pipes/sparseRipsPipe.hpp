@@ -0,0 +1,19 @@
+#pragma once
+
+// Header file for sparseRipsPipe class - see sparseRipsPipe.cpp for descriptions
+#include <map>
+#include "basePipe.hpp"
+
+template <typename nodeType>
+class sparseRipsPipe : public basePipe<nodeType>
+{
+private:
+  double sparsity = 0.5;
+  int dim;
+
+public:
+  sparseRipsPipe();
+  void runPipe(pipePacket<nodeType> &);
+  void outputData(pipePacket<nodeType> &);
+  bool configPipe(std::map<std::string, std::string> &);
+};
@@ -255,5 +255,6 @@ bool upscalePipe<nodeType>::configPipe(std::map<std::string, std::string> &confi
 }
 
 template class upscalePipe<simplexNode>;
+template class upscalePipe<wideSimplexNode>;
 template class upscalePipe<alphaNode>;
 template class upscalePipe<witnessNode>;
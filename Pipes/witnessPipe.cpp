@@ -0,0 +1,135 @@
+/*
+ * witnessPipe hpp + cpp extend the basePipe class for building the
+ * lazy witness complex (maxmin landmarks + witnessed edges) from data input
+ *
+ */
+
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cmath>
+#include "witnessPipe.hpp"
+#include "witnessComplex.hpp"
+
+template <typename nodeType>
+witnessPipe<nodeType>::witnessPipe()
+{
+	/**
+		witnessPipe()
+
+		@brief Class constructor
+		@tparam nodeType The data type of the simplex node.
+	*/
+	this->pipeType = "witness";
+	return;
+}
+
+template <typename nodeType>
+void witnessPipe<nodeType>::runPipe(pipePacket<nodeType> &inData)
+{
+	/**
+		runPipe(pipePacket<nodeType> &inData)
+
+		@brief Selects the landmarks and builds the witnessed edges between them, inserting the landmarks as the vertices of the complex.
+			Replaces distMatrix.neighGraph; ripsPipe expands the flag complex of the witnessed edges afterwards.
+		@tparam nodeType The data type of the simplex node.
+		@param inData The pipePacket data being used in the pipeline.
+	*/
+	// Landmark count from the configuration, or a percentage of the points
+	size_t count = landmarks;
+	if (count == 0)
+		count = (size_t)std::ceil(inData.workData.size() * landmarkPercentage / 100.0);
+
+	((witnessComplex<nodeType> *)inData.complex)->buildWitnessComplex(inData.workData, count, nu);
+	return;
+}
+
+template <typename nodeType>
+bool witnessPipe<nodeType>::configPipe(std::map<std::string, std::string> &configMap)
+{
+	/**
+		configPipe(std::map<std::string, std::string> &configMap)
+
+		@brief Configures the pipe and sets arguments based on the configMap passed. Called before execution (runPipe). If required values not found or configuration is invalid, returns false.
+		@tparam nodeType The data type of the simplex node.
+		@param configMap The configuration map for this pipeline
+		@return boolean
+	*/
+	std::string strDebug;
+
+	auto pipe = configMap.find("debug");
+	if (pipe != configMap.end())
+	{
+		this->debug = std::atoi(configMap["debug"].c_str());
+		strDebug = configMap["debug"];
+	}
+	pipe = configMap.find("outputFile");
+	if (pipe != configMap.end())
+		this->outputFile = configMap["outputFile"].c_str();
+
+	this->ut = utils(strDebug, this->outputFile);
+
+	if (configMap["complexType"] != "witnessComplex")
+	{
+		this->ut.writeError("witnessPipe", "The witness pipe requires complexType=witnessComplex");
+		return false;
+	}
+
+	pipe = configMap.find("landmarks");
+	if (pipe != configMap.end())
+		this->landmarks = std::atol(configMap["landmarks"].c_str());
+
+	pipe = configMap.find("reductionPercentage");
+	if (pipe != configMap.end())
+		this->landmarkPercentage = std::atof(configMap["reductionPercentage"].c_str());
+
+	pipe = configMap.find("nu");
+	if (pipe != configMap.end())
+		this->nu = std::atoi(configMap["nu"].c_str());
+
+	pipe = configMap.find("dimensions");
+	if (pipe != configMap.end())
+		this->dim = std::atoi(configMap["dimensions"].c_str());
+	else
+		return false;
+
+	this->configured = true;
+	this->ut.writeDebug("witnessPipe", "Configured with parameters { dim: " + std::to_string(dim) + " , landmarks: " + std::to_string(landmarks) + " , nu: " + std::to_string(nu) + " , debug: " + strDebug + ", outputFile: " + this->outputFile + " }");
+
+	return true;
+}
+
+template <typename nodeType>
+void witnessPipe<nodeType>::outputData(pipePacket<nodeType> &inData)
+{
+	/**
+		outputData(pipePacket<nodeType> &inData)
+
+		@brief Outputs the witnessed edges as an edge list (landmark i, landmark j, weight) to a file if debug mode is true.
+		@tparam nodeType The data type of the simplex node.
+		@param inData The pipePacket data being used in the pipeline.
+	*/
+	if (inData.complex->neighGraph == nullptr)
+		return;
+
+	std::ofstream file("output/" + this->pipeType + "_output.csv");
+
+	const neighborGraph &graph = *inData.complex->neighGraph;
+	for (unsigned i = 0; i < graph.size(); i++)
+	{
+		const double *w = graph.weightsBegin(i);
+		for (const unsigned *j = graph.neighborsBegin(i); j != graph.neighborsEnd(i); ++j, ++w)
+			if (*j > i)
+				file << i << "," << *j << "," << *w << "\n";
+	}
+
+	file.close();
+	return;
+}
+
+// Explicit Template Class Instantiation
+template class witnessPipe<simplexNode>;
+template class witnessPipe<wideSimplexNode>;
+template class witnessPipe<alphaNode>;
+template class witnessPipe<witnessNode>;
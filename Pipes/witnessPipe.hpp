@@ -0,0 +1,21 @@
+#pragma once
+
+// Header file for witnessPipe class - see witnessPipe.cpp for descriptions
+#include <map>
+#include "basePipe.hpp"
+
+template <typename nodeType>
+class witnessPipe : public basePipe<nodeType>
+{
+private:
+  size_t landmarks = 0;
+  double landmarkPercentage = 10;
+  unsigned nu = 2;
+  int dim;
+
+public:
+  witnessPipe();
+  void runPipe(pipePacket<nodeType> &);
+  void outputData(pipePacket<nodeType> &);
+  bool configPipe(std::map<std::string, std::string> &);
+};
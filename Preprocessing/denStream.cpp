@@ -311,5 +311,6 @@ bool denStream<nodeType>::configPreprocessor(std::map<std::string, std::string>
 }
 
 template class denStream<simplexNode>;
+template class denStream<wideSimplexNode>;
 template class denStream<alphaNode>;
 template class denStream<witnessNode>;
@@ -105,5 +105,6 @@ bool kMeansPlusPlus<nodeType>::configPreprocessor(std::map<std::string, std::str
 
 // Explicit Template Class Instantiation
 template class kMeansPlusPlus<simplexNode>;
+template class kMeansPlusPlus<wideSimplexNode>;
 template class kMeansPlusPlus<alphaNode>;
 template class kMeansPlusPlus<witnessNode>;
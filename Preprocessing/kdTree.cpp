@@ -274,7 +274,7 @@ pointIndex kdTree::nearestPointIndex(const point &pt)
 // Get epsilon-neighborhood of a point
 pointIndexArr kdTree::neighborhood(const kdNodePtr &branch, const point &pt, const double &rad, const size_t &level)
 {
-    double d, dx, dsquared;
+    double dx, dsquared;
 
     if (!bool(*branch))
     {
@@ -282,11 +282,16 @@ pointIndexArr kdTree::neighborhood(const kdNodePtr &branch, const point &pt, con
     } // check for empty branch
 
     size_t dim = pt.size();
-    d = ut.vectors_distance(point(*branch), pt);
-    dx = point(*branch).at(level) - pt.at(level);
+
+    // Compare squared distances in place; avoids copying the node's point on every visit
+    const point &x = branch->x;
+    dsquared = 0;
+    for (size_t k = 0; k < dim; k++)
+        dsquared += (x[k] - pt[k]) * (x[k] - pt[k]);
+    dx = x[level] - pt[level];
 
     pointIndexArr nbh, nbh_s, nbh_o;
-    if (d <= rad)
+    if (dsquared <= rad * rad)
     {
         nbh.push_back(pointIndex(*branch)); // Root of branch is in neighborhood
     }
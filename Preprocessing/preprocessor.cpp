@@ -274,5 +274,6 @@ preprocessor<nodeType>::~preprocessor() {}
 
 // Explicit Template Class Instantiation
 template class preprocessor<simplexNode>;
+template class preprocessor<wideSimplexNode>;
 template class preprocessor<alphaNode>;
 template class preprocessor<witnessNode>;
@@ -43,7 +43,7 @@ static std::map<std::string, Args> argMap = {
 	{"threshold", Args("th", "250", "", "")},
 	{"scalar", Args("s", "0.5", "", "")},
 	{"mpi", Args("a", "0", "", "<int>")},
-	{"mode", Args("m", "standard", "Sets the mode for LHF to run in", "(standard|reduced|upscale|sw)")},
+	{"mode", Args("m", "standard", "Sets the mode for LHF to run in", "(standard|reduced|upscale|sw|sparse)")},
 	{"dimensions", Args("d", "1", "Sets the maximum homology dimension to compute (H_d)", "<int>")},
 	{"iterations", Args("r", "250", "", "<int>")},
 	{"pipeline", Args("p", "", "", "")},
@@ -52,13 +52,20 @@ static std::map<std::string, Args> argMap = {
 	{"epsilon", Args("e", "5", "Maximum epsilon threshold", "<float>")},
 	{"lambda", Args("l", ".25", "Decay factor lambda for DenStream", "")},
 	{"debug", Args("x", "0", "", "<int(0|1)>")},
-	{"complexType", Args("c", "simplexArrayList", "", "(simplexArrayList|simplexTree|alphaComplex|betaComplex|witnessComplex)")},
+	{"complexType", Args("c", "simplexArrayList", "", "(simplexArrayList|simplexTree|alphaComplex|betaComplex|witnessComplex|sparseRips)")},
+	{"sparsity", Args("sp", "0.5", "Approximation parameter epsilon of the sparse Rips filtration (complexType=sparseRips)", "<float(0,1)>")},
+	{"landmarks", Args("lm", "0", "Number of maxmin landmarks for the witness complex (0 -> reductionPercentage of the points)", "<int>")},
+	{"nu", Args("nu", "2", "Witness relaxation: distance to the nu-th nearest landmark is subtracted (complexType=witnessComplex)", "<int>")},
 	{"clusters", Args("k", "20", "", "<int>")},
 	{"preprocessor", Args("pre", "", "", "")},
 	{"upscale", Args("u", "false", "", "<bool>")},
 	{"seed", Args("q", "-1", "", "")},
 	{"twist", Args("w", "false", "", "<bool>")},
-	{"collapse", Args("z", "false", "", "<bool>")},
+	{"collapse", Args("z", "false", "Collapse dominated edges of the Rips 1-skeleton before expansion (persistence is unchanged)", "<bool>")},
+	{"frontier", Args("fr", "parallel", "Expansion of the Delaunay d-1 shell in helixPipe", "(parallel|serial)")},
+	{"exchange", Args("ex", "file", "Exchange of the Delaunay d-1 shell between helixDistPipe iterations: rank 0 file merge or in-memory MPI all-to-all", "(file|alltoall)")},
+	{"implicit", Args("im", "false", "Enumerate Vietoris-Rips simplices above the edges implicitly during persistence instead of storing them", "<bool>")},
+	{"storage", Args("st", "nodes", "Storage of the Vietoris-Rips simplices above the edges: shared nodes, or flat per-dimension arrays in an arena of the complex (dimensions 1-4)", "(nodes|flat)")},
 	{"involutedUpscale", Args("iu", "false", "", "<bool>")},
 	{"involuted", Args("inv", "false", "", "<bool>")}};
 
@@ -383,6 +390,22 @@ void argParser::setPipeline(std::map<std::string, std::string> &args)
 		}
 	}
 
+	/**
+	 * SPARSE MODE:
+	 * 	VR from the sparse epsilon-neighborhood graph; no dense distance matrix
+	 */
+	else if (args["mode"] == "sparse")
+	{
+		if (args["upscale"] == "true")
+		{
+			args["pipeline"] = "sparseNeighGraph.rips.fastPersistence.upscale";
+		}
+		else
+		{
+			args["pipeline"] = "sparseNeighGraph.rips.fastPersistence";
+		}
+	}
+
 	/**
 	 * NAIVE WINDOW MODE:
 	 * 	Simple sliding window VR
@@ -438,5 +461,23 @@ void argParser::setPipeline(std::map<std::string, std::string> &args)
 		;
 	}
 
+	/**
+	 * WITNESS COMPLEX:
+	 * 	Lazy witness complex on maxmin landmarks replaces distMatrix.neighGraph; expanded by rips for fastPersistence
+	 */
+	if (args["complexType"] == "witnessComplex" && args["mode"] != "custom")
+		args["pipeline"] = "witness.rips.fastPersistence";
+
+	/**
+	 * SPARSE RIPS COMPLEX:
+	 * 	Linear-size sparse Rips filtration replaces distMatrix.neighGraph; expanded by rips for fastPersistence
+	 */
+	if (args["complexType"] == "sparseRips" || args["complexType"] == "sparseRipsComplex")
+	{
+		args["complexType"] = "sparseRips";
+		if (args["mode"] != "custom")
+			args["pipeline"] = "sparseRips.rips.fastPersistence";
+	}
+
 	return;
 }
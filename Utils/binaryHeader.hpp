@@ -0,0 +1,86 @@
+#pragma once
+
+// Header file for the binaryHeader struct, shared by the binary readers and writers of readInput, writeOutput and multifileops
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <vector>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+/**
+ * @brief Packed header of the binary vector and map files written by the helix pipelines
+ *
+ * The header is followed by count records. A vector record is vectorSize vertex indices; a map record
+ * is a key of vectorSize indices followed by its value index. Every index is a signed integer of width
+ * bytes, so a reader built with another index type converts the file on the fly (and rejects indices
+ * it cannot hold).
+ */
+#pragma pack(push, 1)
+struct binaryHeader
+{
+    char magic[4] = {'L', 'H', 'F', 'B'};
+    uint8_t width = 0;       // Bytes per vertex index
+    uint64_t count = 0;      // Records in the file
+    uint64_t vectorSize = 0; // Indices per vector (per key of a map)
+
+    binaryHeader() {}
+    binaryHeader(unsigned _width, uint64_t _count, uint64_t _vectorSize) : width(_width), count(_count), vectorSize(_vectorSize) {}
+
+    void write(std::ostream &out) const { out.write(reinterpret_cast<const char *>(this), sizeof(binaryHeader)); }
+
+    // Read and validate the header at the current position; false if the stream does not hold one
+    bool read(std::istream &in)
+    {
+        if (!in.read(reinterpret_cast<char *>(this), sizeof(binaryHeader)))
+            return false;
+        return std::memcmp(magic, "LHFB", 4) == 0 && (width == 1 || width == 2 || width == 4 || width == 8);
+    }
+
+    // Bytes of one record; map records carry one extra index
+    uint64_t recordBytes(bool map) const { return (vectorSize + (map ? 1 : 0)) * width; }
+
+    // Read n indices stored with this header's width into out
+    template <typename T>
+    void readIndices(std::istream &in, T *out, size_t n) const
+    {
+        static_assert(std::is_integral<T>::value && std::is_signed<T>::value, "Vertex indices are signed integers");
+        if (width == sizeof(T))
+        {
+            in.read(reinterpret_cast<char *>(out), n * sizeof(T));
+            return;
+        }
+        switch (width)
+        {
+        case 1:
+            convert<int8_t>(in, out, n);
+            break;
+        case 2:
+            convert<int16_t>(in, out, n);
+            break;
+        case 4:
+            convert<int32_t>(in, out, n);
+            break;
+        default:
+            convert<int64_t>(in, out, n);
+            break;
+        }
+    }
+
+private:
+    template <typename S, typename T>
+    static void convert(std::istream &in, T *out, size_t n)
+    {
+        std::vector<S> buffer(n);
+        in.read(reinterpret_cast<char *>(buffer.data()), n * sizeof(S));
+        for (size_t i = 0; i < n; i++)
+        {
+            if (buffer[i] < std::numeric_limits<T>::min() || buffer[i] > std::numeric_limits<T>::max())
+                throw std::overflow_error("Vertex index does not fit the index type of the reader");
+            out[i] = static_cast<T>(buffer[i]);
+        }
+    }
+};
+#pragma pack(pop)
@@ -0,0 +1,65 @@
+/**
+ * @file bitMatrix.cpp
+ *
+ * @brief Contains the bit-packed bitMatrix class for the LHF system (https://github.com/wilseypa/LHF).
+ */
+
+#include <bit>
+#include "bitMatrix.hpp"
+
+/**
+ * @brief Construct an empty (all pairs unset) incidence matrix for n vertices.
+ *
+ * @param _n The number of vertices.
+ */
+bitMatrix::bitMatrix(size_t _n)
+{
+	resize(_n);
+}
+
+/**
+ * @brief Resize the matrix to n vertices and unset every pair.
+ *
+ * @param _n The number of vertices.
+ */
+void bitMatrix::resize(size_t _n)
+{
+	n = _n;
+	stride = ((n + wordBits - 1) / wordBits + lineWords - 1) / lineWords * lineWords;
+	data.assign(n * stride, 0);
+}
+
+/**
+ * @brief Release the stored rows.
+ *
+ */
+void bitMatrix::clear()
+{
+	n = 0;
+	stride = 0;
+	data.clear();
+	data.shrink_to_fit();
+}
+
+/**
+ * @brief Get the size of the stored rows in bytes.
+ *
+ * @return size_t
+ */
+size_t bitMatrix::getSize() const
+{
+	return data.size() * sizeof(word);
+}
+
+/**
+ * @brief Number of marked pairs.
+ *
+ * @return size_t
+ */
+size_t bitMatrix::count() const
+{
+	size_t total = 0;
+	for (word w : data)
+		total += std::popcount(w);
+	return total;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+// Header file for bitMatrix class - see bitMatrix.cpp for descriptions
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <bit>
+#include <new>
+
+/**
+ * @brief Bit-packed incidence matrix of a set of n vertices
+ *
+ * Row i is a bitset over the vertices, stored as 64-bit words padded to a whole number of
+ * cache lines in line-aligned storage, so every row starts its own line and rows can be
+ * combined word by word. The pair (i, j) is kept in the row of
+ * min(i, j): row i holds the pairs with the vertices after i, which is the orientation the
+ * expansion reads (candidates are larger than every vertex of the simplex).
+ */
+class bitMatrix
+{
+public:
+    typedef uint64_t word;
+    static const unsigned wordBits = 64;
+
+private:
+    static const size_t lineBytes = 64;
+    static const size_t lineWords = lineBytes / sizeof(word); // Words per cache line
+
+    // Allocates the rows on a cache line boundary, so a row padded to whole lines starts a line
+    template <typename T>
+    struct lineAllocator
+    {
+        typedef T value_type;
+
+        lineAllocator() = default;
+        template <typename U>
+        lineAllocator(const lineAllocator<U> &) {}
+
+        T *allocate(size_t count) { return static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t(lineBytes))); }
+        void deallocate(T *p, size_t) { ::operator delete(p, std::align_val_t(lineBytes)); }
+
+        template <typename U>
+        bool operator==(const lineAllocator<U> &) const { return true; }
+    };
+
+    size_t n = 0;
+    size_t stride = 0; // Words per row
+    std::vector<word, lineAllocator<word>> data;
+
+public:
+    bitMatrix() {}
+    bitMatrix(size_t);
+
+    void resize(size_t);
+    void clear();
+    size_t getSize() const;
+
+    size_t size() const { return n; }
+    bool empty() const { return n == 0; }
+    size_t rowWords() const { return stride; }
+
+    word *row(size_t i) { return data.data() + i * stride; }
+    const word *row(size_t i) const { return data.data() + i * stride; }
+
+    // Symmetric lookup of the pair (i, j)
+    bool test(size_t i, size_t j) const
+    {
+        if (i > j)
+            std::swap(i, j);
+        return (row(i)[j / wordBits] >> (j % wordBits)) & 1;
+    }
+
+    // Mark the pair (i, j); only the row of min(i, j) is written
+    void set(size_t i, size_t j)
+    {
+        if (i > j)
+            std::swap(i, j);
+        row(i)[j / wordBits] |= word(1) << (j % wordBits);
+    }
+
+    size_t count() const;
+
+    /**
+     * @brief Call f(j) for every j >= from paired with each of the vertices, in increasing order.
+     *
+     * The rows of the vertices (and of mask, when given) are combined with a bitwise AND one word
+     * at a time, so the common neighbors of a simplex cost one pass over its rows. Every vertex
+     * must be smaller than from, so the pairs (v, j) all sit in the row of v.
+     */
+    template <typename Vertices, typename F>
+    void forEachCommon(const Vertices &vertices, size_t from, F &&f, const bitMatrix *mask = nullptr) const
+    {
+        const size_t words = (n + wordBits - 1) / wordBits;
+        for (size_t w = from / wordBits; w < words; w++)
+        {
+            word common = ~word(0);
+            for (auto v : vertices)
+                common &= row(v)[w];
+            if (mask != nullptr)
+                for (auto v : vertices)
+                    common &= mask->row(v)[w];
+            if (w == from / wordBits)
+                common &= ~word(0) << (from % wordBits);
+
+            while (common)
+            {
+                f(w * wordBits + std::countr_zero(common));
+                common &= common - 1;
+            }
+        }
+    }
+};
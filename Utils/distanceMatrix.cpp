@@ -0,0 +1,151 @@
+/**
+ * @file distanceMatrix.cpp
+ *
+ * @brief Contains the condensed distanceMatrix class for the LHF system (https://github.com/wilseypa/LHF).
+ */
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "distanceMatrix.hpp"
+
+/**
+ * @brief Construct a zero-initialized distance matrix for n points.
+ *
+ * @param _n The number of points.
+ */
+distanceMatrix::distanceMatrix(size_t _n)
+{
+	resize(_n);
+}
+
+/**
+ * @brief Resize the matrix to n points and reset all distances to zero.
+ *
+ * @param _n The number of points.
+ */
+void distanceMatrix::resize(size_t _n)
+{
+	n = _n;
+	data.assign(n > 1 ? n * (n - 1) / 2 : 0, 0.0);
+}
+
+/**
+ * @brief Release the stored distances.
+ *
+ */
+void distanceMatrix::clear()
+{
+	n = 0;
+	data.clear();
+	data.shrink_to_fit();
+}
+
+/**
+ * @brief Get the size of the stored distances in bytes.
+ *
+ * @return size_t
+ */
+size_t distanceMatrix::getSize() const
+{
+	return data.size() * sizeof(double);
+}
+
+/**
+ * @brief Compute all pairwise euclidean distances of a point cloud into the matrix.
+ *
+ * The points are first packed into a contiguous row-major buffer. Pairs are then
+ * evaluated in square tiles of blockSize x blockSize points so both operands of a
+ * tile stay in cache; tiles of the upper triangle are distributed across OpenMP
+ * threads by row block. For ambient dimensions of gramThreshold and above the
+ * squared distance is evaluated as ||a||^2 + ||b||^2 - 2a.b from precomputed norms,
+ * which leaves a single dot product in the inner loop.
+ *
+ * The maximum distance of every point is reduced in the same pass; the smallest
+ * of these (the enclosing radius) is returned.
+ *
+ * @param points The point cloud, one vector per point.
+ * @return double The enclosing radius (std::numeric_limits<double>::max() for an empty cloud).
+ */
+double distanceMatrix::build(const std::vector<std::vector<double>> &points)
+{
+	resize(points.size());
+	if (n == 0)
+		return std::numeric_limits<double>::max();
+
+	const size_t dim = points[0].size();
+	const bool useGram = dim >= gramThreshold;
+
+	// Pack the points and their squared norms into contiguous buffers
+	std::vector<double> coords(n * dim);
+	std::vector<double> norms(n, 0.0);
+
+#pragma omp parallel for
+	for (size_t i = 0; i < n; i++)
+	{
+		const double *src = points[i].data();
+		double *dst = coords.data() + i * dim;
+		double norm = 0;
+#pragma omp simd reduction(+ : norm)
+		for (size_t k = 0; k < dim; k++)
+		{
+			dst[k] = src[k];
+			norm += src[k] * src[k];
+		}
+		norms[i] = norm;
+	}
+
+	std::vector<double> rowMax(n, 0.0);
+	double *maxDist = rowMax.data();
+	const double *pts = coords.data();
+	const double *sqNorms = norms.data();
+	const size_t nBlocks = (n + blockSize - 1) / blockSize;
+
+	// Row blocks near the top of the triangle carry more tiles; schedule dynamically
+#pragma omp parallel for schedule(dynamic) reduction(max : maxDist[:n])
+	for (size_t ib = 0; ib < nBlocks; ib++)
+	{
+		const size_t iEnd = std::min(n, (ib + 1) * blockSize);
+
+		for (size_t jb = ib; jb < nBlocks; jb++)
+		{
+			const size_t jEnd = std::min(n, (jb + 1) * blockSize);
+
+			for (size_t i = ib * blockSize; i < iEnd; i++)
+			{
+				const double *a = pts + i * dim;
+				double *out = row(i);
+				double iMax = maxDist[i];
+
+				for (size_t j = std::max(i + 1, jb * blockSize); j < jEnd; j++)
+				{
+					const double *b = pts + j * dim;
+					double sq = 0;
+
+					if (useGram)
+					{
+#pragma omp simd reduction(+ : sq)
+						for (size_t k = 0; k < dim; k++)
+							sq += a[k] * b[k];
+						sq = std::max(sqNorms[i] + sqNorms[j] - 2 * sq, 0.0);
+					}
+					else
+					{
+#pragma omp simd reduction(+ : sq)
+						for (size_t k = 0; k < dim; k++)
+							sq += (a[k] - b[k]) * (a[k] - b[k]);
+					}
+
+					const double dist = std::sqrt(sq);
+					out[j - i - 1] = dist;
+					iMax = std::max(iMax, dist);
+					maxDist[j] = std::max(maxDist[j], dist);
+				}
+
+				maxDist[i] = iMax;
+			}
+		}
+	}
+
+	return *std::min_element(rowMax.begin(), rowMax.end());
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+// Header file for distanceMatrix class - see distanceMatrix.cpp for descriptions
+#include <vector>
+#include <cstddef>
+#include <utility>
+
+/**
+ * @brief Symmetric distance matrix stored as a packed (condensed) upper triangle
+ *
+ * Only the n*(n-1)/2 entries above the diagonal are stored, row-major in a single
+ * contiguous buffer. Row i holds the distances (i, i+1) ... (i, n-1).
+ */
+class distanceMatrix
+{
+private:
+    size_t n = 0;
+    std::vector<double> data;
+
+    static const size_t blockSize = 64;     // Points per tile of the blocked distance kernel
+    static const size_t gramThreshold = 16; // Use ||a||^2 + ||b||^2 - 2a.b at or above this ambient dimension
+
+public:
+    distanceMatrix() {}
+    distanceMatrix(size_t);
+
+    void resize(size_t);
+    void clear();
+    size_t getSize() const;
+
+    // Compute all pairwise euclidean distances; returns the enclosing radius of the points
+    double build(const std::vector<std::vector<double>> &points);
+
+    size_t size() const { return n; }
+    bool empty() const { return n == 0; }
+
+    // Offset of the first entry of row i, i.e. the entry for (i, i+1)
+    size_t rowOffset(size_t i) const { return i * n - (i * (i + 1)) / 2; }
+
+    // Pointer to the stored entries (i, i+1) ... (i, n-1)
+    double *row(size_t i) { return data.data() + rowOffset(i); }
+    const double *row(size_t i) const { return data.data() + rowOffset(i); }
+
+    // Symmetric lookup; the diagonal is implicitly zero
+    double operator()(size_t i, size_t j) const
+    {
+        if (i == j)
+            return 0;
+        if (i > j)
+            std::swap(i, j);
+        return data[rowOffset(i) + (j - i - 1)];
+    }
+
+    void set(size_t i, size_t j, double value)
+    {
+        if (i == j)
+            return;
+        if (i > j)
+            std::swap(i, j);
+        data[rowOffset(i) + (j - i - 1)] = value;
+    }
+
+    std::vector<double> &getData() { return data; }
+    const std::vector<double> &getData() const { return data; }
+};
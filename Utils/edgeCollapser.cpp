@@ -0,0 +1,133 @@
+/**
+ * @file edgeCollapser.cpp
+ *
+ * @brief Contains the edgeCollapser class for the LHF system (https://github.com/wilseypa/LHF).
+ */
+
+#include <algorithm>
+#include "edgeCollapser.hpp"
+
+/**
+ * @brief Filtration step of the edge (u, v); the edge must exist.
+ *
+ */
+size_t &edgeCollapser::key(unsigned u, unsigned v)
+{
+	auto it = std::lower_bound(adj[u].begin(), adj[u].end(), std::make_pair(v, (size_t)0));
+	return it->second;
+}
+
+/**
+ * @brief Filtration step of the edge (u, v); removed if the vertices are not adjacent.
+ *
+ */
+size_t edgeCollapser::key(unsigned u, unsigned v) const
+{
+	auto it = std::lower_bound(adj[u].begin(), adj[u].end(), std::make_pair(v, (size_t)0));
+	return (it != adj[u].end() && it->first == v) ? it->second : removed;
+}
+
+/**
+ * @brief Check whether the edge (u, v) is dominated in the graph of the edges entering at or before step.
+ *
+ * @param u First vertex of the edge.
+ * @param v Second vertex of the edge.
+ * @param step Filtration step of the graph.
+ * @param common Scratch buffer for N[u] & N[v].
+ * @return true if some vertex w adjacent to u and v is adjacent to every other common neighbor.
+ */
+bool edgeCollapser::dominated(unsigned u, unsigned v, size_t step, std::vector<unsigned> &common) const
+{
+	common.clear();
+	auto a = adj[u].begin(), b = adj[v].begin();
+	while (a != adj[u].end() && b != adj[v].end())
+	{ // Merge the sorted neighbor lists, keeping the vertices adjacent to both at this step
+		if (a->first < b->first)
+			++a;
+		else if (b->first < a->first)
+			++b;
+		else
+		{
+			if (a->second <= step && b->second <= step)
+				common.push_back(a->first);
+			++a;
+			++b;
+		}
+	}
+
+	for (unsigned w : common)
+	{ // u and v are adjacent to w by construction; check the other common neighbors
+		bool dominates = true;
+		for (unsigned x : common)
+		{
+			if (x != w && key(w, x) > step)
+			{
+				dominates = false;
+				break;
+			}
+		}
+		if (dominates)
+			return true;
+	}
+	return false;
+}
+
+/**
+ * @brief First step after step at which an edge incident to u or v enters the filtration.
+ *
+ * Domination of (u, v) can only be lost when N[u] & N[v] grows, i.e. when such an edge enters.
+ *
+ * @return size_t The step, or removed if there is none.
+ */
+size_t edgeCollapser::nextStep(unsigned u, unsigned v, size_t step) const
+{
+	size_t next = removed;
+	for (unsigned x : {u, v})
+		for (auto &[w, k] : adj[x])
+			if (k > step && k < next)
+				next = k;
+	return next;
+}
+
+/**
+ * @brief Collapse the dominated edges of a filtered flag complex.
+ *
+ * @param nPts Number of vertices.
+ * @param edges The edges, sorted by filtration order.
+ * @return std::vector<edge> The remaining edges; a delayed edge takes the weight of the step it moved to.
+ */
+std::vector<edgeCollapser::edge> edgeCollapser::collapse(size_t nPts, const std::vector<edge> &edges)
+{
+	edgeCollapser c;
+	c.adj.resize(nPts);
+	for (size_t i = 0; i < edges.size(); i++)
+	{
+		c.adj[edges[i].u].push_back({edges[i].v, i});
+		c.adj[edges[i].v].push_back({edges[i].u, i});
+	}
+	for (auto &a : c.adj)
+		std::sort(a.begin(), a.end());
+
+	std::vector<unsigned> common;
+	for (size_t i = edges.size(); i-- != 0;)
+	{
+		unsigned u = edges[i].u, v = edges[i].v;
+
+		// Find the first step at which (u, v) is no longer dominated; the edge enters there (or never)
+		size_t step = i;
+		while (step != removed && c.dominated(u, v, step, common))
+			step = c.nextStep(u, v, step);
+
+		c.key(u, v) = step;
+		c.key(v, u) = step;
+	}
+
+	std::vector<edge> ret;
+	for (size_t i = 0; i < edges.size(); i++)
+	{
+		size_t step = c.key(edges[i].u, edges[i].v);
+		if (step != removed)
+			ret.push_back({edges[i].u, edges[i].v, edges[step].weight});
+	}
+	return ret;
+}
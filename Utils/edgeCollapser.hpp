@@ -0,0 +1,36 @@
+#pragma once
+
+// Header file for edgeCollapser class - see edgeCollapser.cpp for descriptions
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include "neighborGraph.hpp"
+
+/**
+ * @brief Persistence-preserving edge collapse of a filtered flag complex (Boissonnat-Pritam)
+ *
+ * The edge uv is dominated by w in a graph when the closed neighborhood N[u] & N[v] is contained in N[w];
+ * removing it from the graph is then a strong collapse of the flag complex. Edges are processed from the
+ * last to the first in filtration order. An edge that stays dominated for the rest of the filtration is
+ * removed; one that stops being dominated is delayed to the first step where it does. Each step keeps the
+ * flag complexes of the filtration homotopy equivalent, so the persistence diagrams are unchanged.
+ */
+class edgeCollapser
+{
+public:
+    typedef neighborGraph::edge edge;
+
+private:
+    static const size_t removed = (size_t)-1; // Key of an edge dropped from every step of the filtration
+
+    // Neighbors of each vertex (sorted), with the filtration step at which the edge currently enters
+    std::vector<std::vector<std::pair<unsigned, size_t>>> adj;
+
+    size_t &key(unsigned u, unsigned v);
+    size_t key(unsigned u, unsigned v) const;
+    bool dominated(unsigned u, unsigned v, size_t step, std::vector<unsigned> &common) const;
+    size_t nextStep(unsigned u, unsigned v, size_t step) const;
+
+public:
+    static std::vector<edge> collapse(size_t nPts, const std::vector<edge> &edges);
+};
@@ -0,0 +1,293 @@
+/**
+ * @file geometryKernels.cpp
+ *
+ * @brief Contains the geometryKernels class for the LHF system (https://github.com/wilseypa/LHF).
+ */
+
+#include <cmath>
+#include <Eigen/Dense>
+#include "geometryKernels.hpp"
+
+namespace
+{
+	// Size of an m x m matrix grown by grow rows and columns; stays dynamic for the fallback
+	template <int M, int grow>
+	constexpr int grown = M == Eigen::Dynamic ? Eigen::Dynamic : M + grow;
+
+	/**
+	 * @brief Call kernel.template operator()<M>() with M = n for n in [2, maxFixedVertices], Eigen::Dynamic otherwise.
+	 *
+	 */
+	template <typename Kernel>
+	decltype(auto) dispatch(unsigned n, Kernel &&kernel)
+	{
+		static_assert(geometryKernels::maxFixedVertices == 9, "Update the fixed-size cases of dispatch");
+		switch (n)
+		{
+		case 2:
+			return kernel.template operator()<2>();
+		case 3:
+			return kernel.template operator()<3>();
+		case 4:
+			return kernel.template operator()<4>();
+		case 5:
+			return kernel.template operator()<5>();
+		case 6:
+			return kernel.template operator()<6>();
+		case 7:
+			return kernel.template operator()<7>();
+		case 8:
+			return kernel.template operator()<8>();
+		case 9:
+			return kernel.template operator()<9>();
+		default:
+			return kernel.template operator()<Eigen::Dynamic>();
+		}
+	}
+
+	/**
+	 * @brief Circumcenter of a simplex of M (= m) vertices, M >= 2.
+	 *
+	 * With the last vertex l as origin the center is c = l + sum_i mu_i (p_i - l), where G mu = diag(G) / 2 and
+	 * G is the Gram matrix of the edge vectors p_i - l. This is the barycentric system of the original
+	 * formulation with the affine constraint eliminated.
+	 */
+	template <int M>
+	void circumCenterKernel(const unsigned *simplex, unsigned m, const std::vector<std::vector<double>> &points, double *center)
+	{
+		const size_t n = points[0].size();
+		const double *last = points[simplex[m - 1]].data();
+
+		Eigen::Matrix<double, grown<M, -1>, grown<M, -1>> gram;
+		Eigen::Matrix<double, grown<M, -1>, 1> rhs;
+		gram.resize(m - 1, m - 1);
+		rhs.resize(m - 1);
+
+		for (unsigned i = 0; i + 1 < m; i++)
+		{
+			const double *a = points[simplex[i]].data();
+			for (unsigned j = i; j + 1 < m; j++)
+			{
+				const double *b = points[simplex[j]].data();
+				double dot = 0;
+				for (size_t k = 0; k < n; k++)
+					dot += (a[k] - last[k]) * (b[k] - last[k]);
+				gram(i, j) = gram(j, i) = dot;
+			}
+			rhs(i) = gram(i, i) / 2;
+		}
+
+		Eigen::Matrix<double, grown<M, -1>, 1> mu = gram.partialPivLu().solve(rhs);
+
+		for (size_t k = 0; k < n; k++)
+			center[k] = last[k];
+		for (unsigned i = 0; i + 1 < m; i++)
+		{
+			const double *a = points[simplex[i]].data();
+			for (size_t k = 0; k < n; k++)
+				center[k] += mu(i) * (a[k] - last[k]);
+		}
+	}
+
+	/**
+	 * @brief Cayley-Menger matrix of a simplex of M (= m) vertices; the squared distances fill the trailing m x m block.
+	 *
+	 */
+	template <int M>
+	Eigen::Matrix<double, grown<M, 1>, grown<M, 1>> cayleyMenger(const unsigned *simplex, unsigned m, const distanceMatrix &distMatrix)
+	{
+		Eigen::Matrix<double, grown<M, 1>, grown<M, 1>> cayley;
+		cayley.resize(m + 1, m + 1);
+		cayley(0, 0) = 0;
+		for (unsigned i = 0; i < m; i++)
+		{
+			cayley(0, i + 1) = cayley(i + 1, 0) = 1;
+			cayley(i + 1, i + 1) = 0;
+			for (unsigned j = i + 1; j < m; j++)
+			{
+				const double d = distMatrix(simplex[i], simplex[j]);
+				cayley(i + 1, j + 1) = cayley(j + 1, i + 1) = d * d;
+			}
+		}
+		return cayley;
+	}
+
+	/**
+	 * @brief Squared circumradius -det(D) / (2 det(CM)) of a simplex of M (= m) vertices, D the squared distances.
+	 *
+	 */
+	template <int M>
+	double circumRadiusKernel(const unsigned *simplex, unsigned m, const distanceMatrix &distMatrix)
+	{
+		auto cayley = cayleyMenger<M>(simplex, m, distMatrix);
+		Eigen::Matrix<double, M, M> squared = cayley.bottomRightCorner(m, m);
+		return -squared.determinant() / (2 * cayley.determinant());
+	}
+
+	template <int M>
+	double determinantKernel(const std::vector<std::vector<double>> &mat, unsigned n)
+	{
+		Eigen::Matrix<double, M, M> a;
+		a.resize(n, n);
+		for (unsigned i = 0; i < n; i++)
+			for (unsigned j = 0; j < n; j++)
+				a(i, j) = mat[i][j];
+		return a.determinant();
+	}
+
+	template <int M>
+	std::vector<std::vector<double>> inverseKernel(const std::vector<std::vector<double>> &mat, unsigned n)
+	{
+		Eigen::Matrix<double, M, M> a;
+		a.resize(n, n);
+		for (unsigned i = 0; i < n; i++)
+			for (unsigned j = 0; j < n; j++)
+				a(i, j) = mat[i][j];
+		Eigen::Matrix<double, M, M> inv = a.inverse();
+
+		std::vector<std::vector<double>> result(n, std::vector<double>(n));
+		for (unsigned i = 0; i < n; i++)
+			for (unsigned j = 0; j < n; j++)
+				result[i][j] = inv(i, j);
+		return result;
+	}
+}
+
+/**
+ * @brief Circumcenter of a simplex from the coordinates of its vertices.
+ *
+ * @param simplex The m vertex indices of the simplex.
+ * @param m Number of vertices.
+ * @param points The point cloud.
+ * @param center Output buffer of the ambient dimension.
+ */
+void geometryKernels::circumCenter(const unsigned *simplex, unsigned m, const std::vector<std::vector<double>> &points, double *center)
+{
+	if (m == 1)
+	{
+		std::copy(points[simplex[0]].begin(), points[simplex[0]].end(), center);
+		return;
+	}
+	dispatch(m, [&]<int M>()
+			 { circumCenterKernel<M>(simplex, m, points, center); });
+}
+
+/**
+ * @brief Squared circumradius of a simplex from the Cayley-Menger determinant of its pairwise distances.
+ *
+ * @param simplex The m vertex indices of the simplex.
+ * @param m Number of vertices.
+ * @param distMatrix Distances between the points.
+ * @return double Squared radius; negative (or not a number) when the simplex is degenerate.
+ */
+double geometryKernels::circumRadius(const unsigned *simplex, unsigned m, const distanceMatrix &distMatrix)
+{
+	if (m < 2)
+		return 0;
+	return dispatch(m, [&]<int M>()
+					{ return circumRadiusKernel<M>(simplex, m, distMatrix); });
+}
+
+/**
+ * @brief Squared volume of a simplex from the Cayley-Menger determinant of its pairwise distances.
+ *
+ * @param simplex The m vertex indices of the simplex.
+ * @param m Number of vertices.
+ * @param distMatrix Distances between the points.
+ * @param dd Dimension of the volume.
+ * @return double
+ */
+double geometryKernels::simplexVolume(const unsigned *simplex, unsigned m, const distanceMatrix &distMatrix, int dd)
+{
+	if (m < 2)
+		return 0;
+	double det = dispatch(m, [&]<int M>()
+						  { return cayleyMenger<M>(simplex, m, distMatrix).determinant(); });
+	return (dd % 2 == 0 ? -det : det) / (std::pow(2, dd) * std::pow(std::tgamma(dd + 1), 2));
+}
+
+/**
+ * @brief Circumcenters of a batch of simplices with the same number of vertices.
+ *
+ * @param simplices Vertex indices, m per simplex.
+ * @param m Number of vertices of each simplex.
+ * @param points The point cloud.
+ * @param centers Output; the center of simplex s is stored at [s * dim, (s + 1) * dim).
+ */
+void geometryKernels::circumCenters(const std::vector<unsigned> &simplices, unsigned m, const std::vector<std::vector<double>> &points, std::vector<double> &centers)
+{
+	const size_t count = m ? simplices.size() / m : 0;
+	const size_t n = points.empty() ? 0 : points[0].size();
+	centers.resize(count * n);
+	if (count == 0)
+		return;
+
+	if (m == 1)
+	{
+		for (size_t s = 0; s < count; s++)
+			std::copy(points[simplices[s]].begin(), points[simplices[s]].end(), centers.begin() + s * n);
+		return;
+	}
+
+	dispatch(m, [&]<int M>()
+			 {
+#pragma omp parallel for schedule(static) if (count >= parallelThreshold)
+		for (size_t s = 0; s < count; s++)
+			circumCenterKernel<M>(simplices.data() + s * m, m, points, centers.data() + s * n); });
+}
+
+/**
+ * @brief Squared circumradii of a batch of simplices with the same number of vertices.
+ *
+ * @param simplices Vertex indices, m per simplex.
+ * @param m Number of vertices of each simplex.
+ * @param distMatrix Distances between the points.
+ * @param radii Output; one squared radius per simplex (see circumRadius).
+ */
+void geometryKernels::circumRadii(const std::vector<unsigned> &simplices, unsigned m, const distanceMatrix &distMatrix, std::vector<double> &radii)
+{
+	const size_t count = m ? simplices.size() / m : 0;
+	radii.assign(count, 0);
+	if (count == 0 || m < 2)
+		return;
+
+	dispatch(m, [&]<int M>()
+			 {
+#pragma omp parallel for schedule(static) if (count >= parallelThreshold)
+		for (size_t s = 0; s < count; s++)
+			radii[s] = circumRadiusKernel<M>(simplices.data() + s * m, m, distMatrix); });
+}
+
+/**
+ * @brief Determinant of the leading n x n block of a matrix.
+ *
+ * @param mat The matrix.
+ * @param n Size of the block.
+ * @return double
+ */
+double geometryKernels::determinant(const std::vector<std::vector<double>> &mat, unsigned n)
+{
+	if (n == 0)
+		return 1;
+	if (n == 1)
+		return mat[0][0];
+	return dispatch(n, [&]<int M>()
+					{ return determinantKernel<M>(mat, n); });
+}
+
+/**
+ * @brief Inverse of the leading n x n block of a matrix.
+ *
+ * @param mat The matrix.
+ * @param n Size of the block.
+ * @return std::vector<std::vector<double>>
+ */
+std::vector<std::vector<double>> geometryKernels::inverse(const std::vector<std::vector<double>> &mat, unsigned n)
+{
+	if (n == 0)
+		return {};
+	if (n == 1)
+		return {{1 / mat[0][0]}};
+	return dispatch(n, [&]<int M>()
+					{ return inverseKernel<M>(mat, n); });
+}
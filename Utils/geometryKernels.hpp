@@ -0,0 +1,89 @@
+#pragma once
+
+// Header file for geometryKernels class - see geometryKernels.cpp for descriptions
+#include <array>
+#include <vector>
+#include <cstddef>
+#include "distanceMatrix.hpp"
+
+/**
+ * @brief Circumsphere, volume and small dense linear algebra kernels for simplices
+ *
+ * A simplex of m vertices leads to an (m - 1) x (m - 1) Gram system for its circumcenter and an
+ * (m + 1) x (m + 1) Cayley-Menger matrix for its circumradius and volume. For m up to maxFixedVertices
+ * (full dimensional simplices in ambient dimensions 2-8) the kernels are instantiated with compile-time
+ * sized Eigen matrices, so they stay on the stack and use the closed-form or unrolled factorizations;
+ * larger simplices use the dynamic fallback. The batched forms dispatch on m once and evaluate a whole
+ * buffer of simplices of the same size in parallel.
+ */
+class geometryKernels
+{
+public:
+    static const unsigned maxFixedVertices = 9; // Largest simplex handled by the fixed-size kernels
+
+private:
+    static const size_t parallelThreshold = 256; // Smallest batch evaluated across threads
+
+    // Copy the vertices of a simplex (any iterable of indices) into a contiguous buffer
+    template <typename Simplex>
+    static const unsigned *gather(const Simplex &simplex, std::array<unsigned, maxFixedVertices> &fixed, std::vector<unsigned> &spill, unsigned &m)
+    {
+        m = simplex.size();
+        unsigned *out = fixed.data();
+        if (m > maxFixedVertices)
+        {
+            spill.resize(m);
+            out = spill.data();
+        }
+        unsigned i = 0;
+        for (auto v : simplex)
+            out[i++] = v;
+        return out;
+    }
+
+public:
+    // Kernels on a simplex given as m indices into the point cloud / distance matrix
+    static void circumCenter(const unsigned *simplex, unsigned m, const std::vector<std::vector<double>> &points, double *center);
+    static double circumRadius(const unsigned *simplex, unsigned m, const distanceMatrix &distMatrix);
+    static double simplexVolume(const unsigned *simplex, unsigned m, const distanceMatrix &distMatrix, int dd);
+
+    template <typename Simplex>
+    static std::vector<double> circumCenter(const Simplex &simplex, const std::vector<std::vector<double>> &points)
+    {
+        std::array<unsigned, maxFixedVertices> fixed;
+        std::vector<unsigned> spill;
+        unsigned m;
+        const unsigned *vertices = gather(simplex, fixed, spill, m);
+        std::vector<double> center(points[0].size());
+        circumCenter(vertices, m, points, center.data());
+        return center;
+    }
+
+    template <typename Simplex>
+    static double circumRadius(const Simplex &simplex, const distanceMatrix &distMatrix)
+    {
+        std::array<unsigned, maxFixedVertices> fixed;
+        std::vector<unsigned> spill;
+        unsigned m;
+        const unsigned *vertices = gather(simplex, fixed, spill, m);
+        return circumRadius(vertices, m, distMatrix);
+    }
+
+    template <typename Simplex>
+    static double simplexVolume(const Simplex &simplex, const distanceMatrix &distMatrix, int dd)
+    {
+        std::array<unsigned, maxFixedVertices> fixed;
+        std::vector<unsigned> spill;
+        unsigned m;
+        const unsigned *vertices = gather(simplex, fixed, spill, m);
+        return simplexVolume(vertices, m, distMatrix, dd);
+    }
+
+    // Batched kernels over simplices of m vertices stored back to back
+    static void circumCenters(const std::vector<unsigned> &simplices, unsigned m, const std::vector<std::vector<double>> &points, std::vector<double> &centers);
+    static void circumRadii(const std::vector<unsigned> &simplices, unsigned m, const distanceMatrix &distMatrix, std::vector<double> &radii);
+
+    // Leading n x n block of a dense matrix
+    static double determinant(const std::vector<std::vector<double>> &mat, unsigned n);
+    static std::vector<std::vector<double>> inverse(const std::vector<std::vector<double>> &mat, unsigned n);
+};
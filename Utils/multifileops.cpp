@@ -59,15 +59,18 @@ bool VectorFile::updateCache()
 /**
  * @brief Construct a new Vector Binary File:: Vector Binary File object
  *
+ * @tparam T Vertex index type
  * @param filename
  */
-VectorBinaryFile::VectorBinaryFile(const std::string &filename) : fileStream(filename, std::ios::in | std::ios::binary)
+template <typename T>
+VectorBinaryFile<T>::VectorBinaryFile(const std::string &filename) : fileStream(filename, std::ios::in | std::ios::binary)
 {
     if (!fileStream.is_open())
         throw std::runtime_error("Failed to open the file.");
-    fileStream.read(reinterpret_cast<char *>(&dim1), sizeof(dim1));
-    fileStream.read(reinterpret_cast<char *>(&dim2), sizeof(dim2));
-    cache.resize(dim2);
+    if (!header.read(fileStream))
+        throw std::runtime_error("Not a binary vector file: " + filename);
+    dim1 = header.count;
+    cache.resize(header.vectorSize);
     updateCache();
 };
 
@@ -78,7 +81,8 @@ VectorBinaryFile::VectorBinaryFile(const std::string &filename) : fileStream(fil
  * @return true
  * @return false
  */
-bool VectorBinaryFile::operator<(const VectorBinaryFile &other) const
+template <typename T>
+bool VectorBinaryFile<T>::operator<(const VectorBinaryFile &other) const
 {
     return cache < other.cache;
 };
@@ -89,11 +93,12 @@ bool VectorBinaryFile::operator<(const VectorBinaryFile &other) const
  * @return true
  * @return false
  */
-bool VectorBinaryFile::updateCache()
+template <typename T>
+bool VectorBinaryFile<T>::updateCache()
 {
     if (dim1 > 0)
     {
-        fileStream.read(reinterpret_cast<char *>(cache.data()), dim2 * sizeof(short));
+        header.readIndices(fileStream, cache.data(), cache.size());
         dim1--;
         return true;
     }
@@ -107,15 +112,18 @@ bool VectorBinaryFile::updateCache()
 /**
  * @brief Construct a new Map Binary File:: Map Binary File object
  *
+ * @tparam T Vertex index type
  * @param filename
  */
-MapBinaryFile::MapBinaryFile(const std::string &filename) : fileStream(filename, std::ios::in | std::ios::binary)
+template <typename T>
+MapBinaryFile<T>::MapBinaryFile(const std::string &filename) : fileStream(filename, std::ios::in | std::ios::binary)
 {
     if (!fileStream.is_open())
         throw std::runtime_error("Failed to open the file." + filename);
-    fileStream.read(reinterpret_cast<char *>(&mapSize), sizeof(mapSize));
-    fileStream.read(reinterpret_cast<char *>(&vectorSize), sizeof(vectorSize));
-    cache.first.resize(vectorSize);
+    if (!header.read(fileStream))
+        throw std::runtime_error("Not a binary map file: " + filename);
+    mapSize = header.count;
+    cache.first.resize(header.vectorSize);
     updateCache();
 };
 
@@ -126,7 +134,8 @@ MapBinaryFile::MapBinaryFile(const std::string &filename) : fileStream(filename,
  * @return true
  * @return false
  */
-bool MapBinaryFile::operator<(const MapBinaryFile &other) const
+template <typename T>
+bool MapBinaryFile<T>::operator<(const MapBinaryFile &other) const
 {
     return cache.first < other.cache.first;
 };
@@ -137,12 +146,13 @@ bool MapBinaryFile::operator<(const MapBinaryFile &other) const
  * @return true
  * @return false
  */
-bool MapBinaryFile::updateCache()
+template <typename T>
+bool MapBinaryFile<T>::updateCache()
 {
     if (mapSize > 0)
     {
-        fileStream.read(reinterpret_cast<char *>(cache.first.data()), vectorSize * sizeof(short));
-        fileStream.read(reinterpret_cast<char *>(&cache.second), sizeof(short));
+        header.readIndices(fileStream, cache.first.data(), cache.first.size());
+        header.readIndices(fileStream, &cache.second, 1);
         mapSize--;
         return true;
     }
@@ -181,8 +191,8 @@ bool MultiFile<FileType, baseType>::readValue()
  * @return true
  * @return false
  */
-template <>
-bool MultiFile<MapBinaryFile, std::pair<std::vector<short>, short>>::readUnique()
+template <typename FileType, class baseType>
+bool MultiFile<FileType, baseType>::readUnique()
 {
     while (readValue())
     {
@@ -227,20 +237,21 @@ MultiFile<FileType, baseType>::MultiFile(const std::string &directory)
  * @param outputFileName
  * @param iterationCounter
  */
-template <>
-void MultiFile<MapBinaryFile, std::pair<std::vector<short>, short>>::compressMap(const std::string &outputFileName, int iterationCounter)
+template <typename FileType, class baseType>
+void MultiFile<FileType, baseType>::compressMap(const std::string &outputFileName, int iterationCounter)
 {
+    typedef typename baseType::second_type indexType;
+
     // Open the output file for writing
     std::ofstream outputFile(outputFileName, std::ios::out | std::ios::binary);
 
     // Read from the previous iteration's data file
-    MapBinaryFile previousReader(".input/" + std::to_string(iterationCounter) + ".dat");
+    FileType previousReader(".input/" + std::to_string(iterationCounter) + ".dat");
 
     // Initialize variables for map size and vector size
     size_t mapSize = 0, vectorSize = previousReader.cache.first.size();
 
-    outputFile.write(reinterpret_cast<char *>(&mapSize), sizeof(mapSize));       // Write a placeholder for map size to the output file
-    outputFile.write(reinterpret_cast<char *>(&vectorSize), sizeof(vectorSize)); // Write the size of the vector to facilitate reconstruction
+    binaryHeader(sizeof(indexType), mapSize, vectorSize).write(outputFile); // Placeholder for the map size, rewritten at the end
 
     // Read values and write them to the output file
     while (readUnique())
@@ -252,8 +263,8 @@ void MultiFile<MapBinaryFile, std::pair<std::vector<short>, short>>::compressMap
             // Seek the reader from the previous iteration to the current value
             if (previousReader.cache.first != curr_element.first) // Write binary to the file if curr_element was not processed in the previous iteration
             {
-                outputFile.write(reinterpret_cast<const char *>(curr_element.first.data()), vectorSize * sizeof(short));
-                outputFile.write(reinterpret_cast<const char *>(&curr_element.second), sizeof(short));
+                outputFile.write(reinterpret_cast<const char *>(curr_element.first.data()), vectorSize * sizeof(indexType));
+                outputFile.write(reinterpret_cast<const char *>(&curr_element.second), sizeof(indexType));
                 mapSize++;
             }
         }
@@ -261,7 +272,7 @@ void MultiFile<MapBinaryFile, std::pair<std::vector<short>, short>>::compressMap
 
     // Seek to the beginning of the file and overwrite the mapSize binary with the original value
     outputFile.seekp(0);
-    outputFile.write(reinterpret_cast<char *>(&mapSize), sizeof(mapSize));
+    binaryHeader(sizeof(indexType), mapSize, vectorSize).write(outputFile);
     outputFile.close();
 
     // Close the file streams and remove the previous iteration's data file
@@ -277,8 +288,8 @@ void MultiFile<MapBinaryFile, std::pair<std::vector<short>, short>>::compressMap
  * @param outputFileName
  * @return size_t
  */
-template <>
-size_t MultiFile<VectorBinaryFile, std::vector<short>>::writeCSV(const std::string &outputFileName)
+template <typename FileType, class baseType>
+size_t MultiFile<FileType, baseType>::writeCSV(const std::string &outputFileName)
 {
     std::ofstream outputFile(outputFileName, std::ios::out);
     size_t size = 0;
@@ -304,10 +315,9 @@ size_t MultiFile<VectorBinaryFile, std::vector<short>>::writeCSV(const std::stri
  * @tparam
  * @param mat
  */
-template <>
-void MultiFile<VectorBinaryFile, std::vector<short>>::loadAggregateData(std::vector<std::vector<unsigned>> &mat)
+template <typename FileType, class baseType>
+void MultiFile<FileType, baseType>::loadAggregateData(std::vector<std::vector<unsigned>> &mat)
 {
-    size_t size = 0;
     while (readValue())
     {
         for (auto it = fileDataMap.begin(); it != fileDataMap.end(); ++it)
@@ -320,5 +330,21 @@ void MultiFile<VectorBinaryFile, std::vector<short>>::loadAggregateData(std::vec
     return;
 };
 
-template class MultiFile<MapBinaryFile, std::pair<std::vector<short>, short>>;
-template class MultiFile<VectorBinaryFile, std::vector<short>>;
\ No newline at end of file
+template struct VectorBinaryFile<short>;
+template struct VectorBinaryFile<int32_t>;
+template struct VectorBinaryFile<int64_t>;
+template struct MapBinaryFile<short>;
+template struct MapBinaryFile<int32_t>;
+template struct MapBinaryFile<int64_t>;
+
+// Map files are merged (compressMap) and vector files aggregated (writeCSV, loadAggregateData)
+template MultiFile<MapBinaryFile<short>, std::pair<std::vector<short>, short>>::MultiFile(const std::string &);
+template MultiFile<MapBinaryFile<int32_t>, std::pair<std::vector<int32_t>, int32_t>>::MultiFile(const std::string &);
+template void MultiFile<MapBinaryFile<short>, std::pair<std::vector<short>, short>>::compressMap(const std::string &, int);
+template void MultiFile<MapBinaryFile<int32_t>, std::pair<std::vector<int32_t>, int32_t>>::compressMap(const std::string &, int);
+template MultiFile<VectorBinaryFile<short>, std::vector<short>>::MultiFile(const std::string &);
+template MultiFile<VectorBinaryFile<int32_t>, std::vector<int32_t>>::MultiFile(const std::string &);
+template size_t MultiFile<VectorBinaryFile<short>, std::vector<short>>::writeCSV(const std::string &);
+template size_t MultiFile<VectorBinaryFile<int32_t>, std::vector<int32_t>>::writeCSV(const std::string &);
+template void MultiFile<VectorBinaryFile<short>, std::vector<short>>::loadAggregateData(std::vector<std::vector<unsigned>> &);
+template void MultiFile<VectorBinaryFile<int32_t>, std::vector<int32_t>>::loadAggregateData(std::vector<std::vector<unsigned>> &);
\ No newline at end of file
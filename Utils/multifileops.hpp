@@ -3,6 +3,7 @@
 #include <vector>
 #include <fstream>
 #include <string>
+#include "binaryHeader.hpp"
 
 struct VectorFile
 {
@@ -14,24 +15,27 @@ struct VectorFile
     bool updateCache();
 };
 
+// Binary vector / map files of vertex indices T, read in any index width (see binaryHeader)
+template <typename T>
 struct VectorBinaryFile
 {
     std::ifstream fileStream;
-    std::vector<short> cache;
+    std::vector<T> cache;
+    binaryHeader header;
     size_t dim1;
-    size_t dim2;
 
     VectorBinaryFile(const std::string &filename);
     bool operator<(const VectorBinaryFile &other) const;
     bool updateCache();
 };
 
+template <typename T>
 struct MapBinaryFile
 {
-    std::pair<std::vector<short>, short> cache;
+    std::pair<std::vector<T>, T> cache;
     std::ifstream fileStream;
+    binaryHeader header;
     size_t mapSize;
-    size_t vectorSize;
 
     MapBinaryFile(const std::string &filename);
     bool operator<(const MapBinaryFile &other) const;
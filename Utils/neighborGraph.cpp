@@ -0,0 +1,222 @@
+/**
+ * @file neighborGraph.cpp
+ *
+ * @brief Contains the sparse neighborGraph class for the LHF system (https://github.com/wilseypa/LHF).
+ */
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "neighborGraph.hpp"
+#include "kdTree.hpp"
+
+/**
+ * @brief Build the epsilon-neighborhood graph of a point cloud.
+ *
+ * Radius queries against a kdTree are issued in batches of batchSize points
+ * across OpenMP threads; each query result is sorted and weighted locally, and
+ * the per-point lists are then packed into the CSR arrays.
+ *
+ * @param points The point cloud, one vector per point.
+ * @param epsilon Maximum edge length kept in the graph.
+ */
+void neighborGraph::build(const std::vector<std::vector<double>> &points, double epsilon)
+{
+	clear();
+	n = points.size();
+	offsets.assign(n + 1, 0);
+	if (n == 0)
+		return;
+
+	kdTree tree(points, n);
+	std::vector<std::vector<std::pair<unsigned, double>>> adjacency(n);
+
+#pragma omp parallel for schedule(dynamic, batchSize)
+	for (size_t i = 0; i < n; i++)
+	{
+		auto &adj = adjacency[i];
+		for (size_t j : tree.neighborhoodIndices(points[i], epsilon))
+		{
+			if (j == i)
+				continue;
+
+			double sq = 0;
+			for (size_t k = 0; k < points[i].size(); k++)
+				sq += (points[i][k] - points[j][k]) * (points[i][k] - points[j][k]);
+
+			const double dist = std::sqrt(sq);
+			if (dist <= epsilon)
+				adj.push_back({(unsigned)j, dist});
+		}
+		std::sort(adj.begin(), adj.end());
+	}
+
+	for (size_t i = 0; i < n; i++)
+		offsets[i + 1] = offsets[i] + adjacency[i].size();
+
+	neighbors.resize(offsets[n]);
+	weights.resize(offsets[n]);
+
+#pragma omp parallel for schedule(dynamic, batchSize)
+	for (size_t i = 0; i < n; i++)
+	{
+		size_t pos = offsets[i];
+		for (auto &[j, dist] : adjacency[i])
+		{
+			neighbors[pos] = j;
+			weights[pos++] = dist;
+		}
+		std::vector<std::pair<unsigned, double>>().swap(adjacency[i]);
+	}
+}
+
+/**
+ * @brief Build the graph from an explicit list of weighted edges.
+ *
+ * @param nPts Number of vertices.
+ * @param edges The edges, each listed once.
+ */
+void neighborGraph::build(size_t nPts, const std::vector<edge> &edges)
+{
+	clear();
+	n = nPts;
+	offsets.assign(n + 1, 0);
+
+	for (auto &e : edges)
+	{
+		offsets[e.u + 1]++;
+		offsets[e.v + 1]++;
+	}
+	for (size_t i = 0; i < n; i++)
+		offsets[i + 1] += offsets[i];
+
+	std::vector<std::pair<unsigned, double>> adjacency(offsets[n]);
+	std::vector<size_t> pos(offsets.begin(), offsets.end() - 1);
+	for (auto &e : edges)
+	{
+		adjacency[pos[e.u]++] = {e.v, e.weight};
+		adjacency[pos[e.v]++] = {e.u, e.weight};
+	}
+
+	neighbors.resize(offsets[n]);
+	weights.resize(offsets[n]);
+
+#pragma omp parallel for schedule(dynamic, batchSize)
+	for (size_t i = 0; i < n; i++)
+	{
+		std::sort(adjacency.begin() + offsets[i], adjacency.begin() + offsets[i + 1]);
+		for (size_t p = offsets[i]; p < offsets[i + 1]; p++)
+		{
+			neighbors[p] = adjacency[p].first;
+			weights[p] = adjacency[p].second;
+		}
+	}
+}
+
+/**
+ * @brief Release the stored graph.
+ *
+ */
+void neighborGraph::clear()
+{
+	n = 0;
+	offsets.clear();
+	neighbors.clear();
+	weights.clear();
+	deaths.clear();
+}
+
+/**
+ * @brief Get the size of the stored graph in bytes.
+ *
+ * @return size_t
+ */
+size_t neighborGraph::getSize() const
+{
+	return offsets.size() * sizeof(size_t) + neighbors.size() * (sizeof(unsigned) + sizeof(double)) + deaths.size() * sizeof(double);
+}
+
+/**
+ * @brief Length of the edge (i, j).
+ *
+ * @param i First vertex.
+ * @param j Second vertex.
+ * @return double The edge length; infinity if the vertices are not neighbors.
+ */
+double neighborGraph::weight(unsigned i, unsigned j) const
+{
+	if (i == j)
+		return 0;
+
+	auto it = std::lower_bound(neighborsBegin(i), neighborsEnd(i), j);
+	if (it == neighborsEnd(i) || *it != j)
+		return std::numeric_limits<double>::infinity();
+	return weightsBegin(i)[it - neighborsBegin(i)];
+}
+
+// Common neighbors of the vertices of a simplex (std::set or contiguous) >= minVertex into ret, see commonNeighbors
+template <typename Vertices>
+void neighborGraph::intersectNeighbors(const Vertices &simplex, unsigned minVertex, std::vector<std::pair<unsigned, double>> &ret) const
+{
+	ret.clear();
+	if (simplex.empty())
+		return;
+
+	unsigned base = *std::min_element(simplex.begin(), simplex.end(), [this](unsigned a, unsigned b)
+									  { return degree(a) < degree(b); });
+
+	for (auto it = std::lower_bound(neighborsBegin(base), neighborsEnd(base), minVertex); it != neighborsEnd(base); ++it)
+		ret.push_back({*it, weightsBegin(base)[it - neighborsBegin(base)]});
+
+	for (unsigned v : simplex)
+	{
+		if (v == base || ret.empty())
+			continue;
+
+		// Two-pointer intersection of the candidates with the neighbors of v
+		const unsigned *nb = std::lower_bound(neighborsBegin(v), neighborsEnd(v), ret.front().first);
+		const unsigned *end = neighborsEnd(v);
+		size_t keep = 0;
+		for (size_t c = 0; c < ret.size() && nb != end; c++)
+		{
+			while (nb != end && *nb < ret[c].first)
+				++nb;
+			if (nb != end && *nb == ret[c].first)
+				ret[keep++] = {ret[c].first, std::max(ret[c].second, weightsBegin(v)[nb - neighborsBegin(v)])};
+		}
+		ret.resize(keep);
+	}
+}
+
+/**
+ * @brief Vertices adjacent to every vertex of a simplex.
+ *
+ * Intersects the sorted neighbor lists of the simplex vertices, starting from the
+ * vertex of lowest degree.
+ *
+ * @param simplex The vertices of the simplex.
+ * @param minVertex Only vertices >= minVertex are reported.
+ * @return std::vector<std::pair<unsigned, double>> The common neighbors in ascending order, each with
+ * 		the longest edge joining it to the simplex.
+ */
+std::vector<std::pair<unsigned, double>> neighborGraph::commonNeighbors(const std::set<unsigned> &simplex, unsigned minVertex) const
+{
+	std::vector<std::pair<unsigned, double>> ret;
+	intersectNeighbors(simplex, minVertex, ret);
+	return ret;
+}
+
+/**
+ * @brief Vertices adjacent to every vertex of a simplex, written into a caller-owned buffer.
+ *
+ * Same as above for a contiguous vertex list (the flat simplices); reusing ret across
+ * calls keeps the enumeration free of allocations once the buffer has grown.
+ *
+ * @param simplex The vertices of the simplex.
+ * @param minVertex Only vertices >= minVertex are reported.
+ * @param ret Replaced by the common neighbors in ascending order with their longest edges.
+ */
+void neighborGraph::commonNeighbors(std::span<const unsigned> simplex, unsigned minVertex, std::vector<std::pair<unsigned, double>> &ret) const
+{
+	intersectNeighbors(simplex, minVertex, ret);
+}
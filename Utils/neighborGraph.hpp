@@ -0,0 +1,74 @@
+#pragma once
+
+// Header file for neighborGraph class - see neighborGraph.cpp for descriptions
+#include <vector>
+#include <set>
+#include <cstddef>
+#include <utility>
+#include <span>
+#include <limits>
+#include <algorithm>
+
+/**
+ * @brief Sparse epsilon-neighborhood graph in compressed sparse row (CSR) form
+ *
+ * The neighbors of vertex v are neighbors[offsets[v]] ... neighbors[offsets[v+1] - 1],
+ * sorted ascending, with the matching edge lengths in weights.
+ * Vertices may also carry a death (sparse Rips): the weight they leave the filtration at.
+ */
+class neighborGraph
+{
+private:
+    size_t n = 0;
+    std::vector<size_t> offsets;
+    std::vector<unsigned> neighbors;
+    std::vector<double> weights;
+    std::vector<double> deaths; // Weight each vertex leaves the filtration at; empty when no vertex leaves
+
+    static const size_t batchSize = 256; // Points per batch of radius queries handed to a thread
+
+    template <typename Vertices>
+    void intersectNeighbors(const Vertices &, unsigned, std::vector<std::pair<unsigned, double>> &) const;
+
+public:
+    struct edge
+    {
+        unsigned u, v;
+        double weight;
+    };
+
+    neighborGraph() {}
+
+    void build(const std::vector<std::vector<double>> &points, double epsilon);
+    void build(size_t nPts, const std::vector<edge> &edges);
+    void setDeaths(std::vector<double> vertexDeaths) { deaths = std::move(vertexDeaths); }
+    void clear();
+    size_t getSize() const;
+
+    size_t size() const { return n; }
+    bool empty() const { return n == 0; }
+    size_t edgeCount() const { return neighbors.size() / 2; }
+    size_t degree(unsigned v) const { return offsets[v + 1] - offsets[v]; }
+
+    // Sorted neighbors of v and their edge lengths
+    const unsigned *neighborsBegin(unsigned v) const { return neighbors.data() + offsets[v]; }
+    const unsigned *neighborsEnd(unsigned v) const { return neighbors.data() + offsets[v + 1]; }
+    const double *weightsBegin(unsigned v) const { return weights.data() + offsets[v]; }
+
+    // Weight vertex v leaves the filtration at, and the earliest of these over the vertices of a simplex
+    //	A simplex heavier than the death of its vertices is not in the filtration, even if all its edges are
+    double death(unsigned v) const { return deaths.empty() ? std::numeric_limits<double>::infinity() : deaths[v]; }
+    template <typename Vertices>
+    double death(const Vertices &simplex) const
+    {
+        double ret = std::numeric_limits<double>::infinity();
+        if (!deaths.empty())
+            for (unsigned v : simplex)
+                ret = std::min(ret, deaths[v]);
+        return ret;
+    }
+
+    double weight(unsigned i, unsigned j) const;
+    std::vector<std::pair<unsigned, double>> commonNeighbors(const std::set<unsigned> &simplex, unsigned minVertex = 0) const;
+    void commonNeighbors(std::span<const unsigned> simplex, unsigned minVertex, std::vector<std::pair<unsigned, double>> &ret) const;
+};
@@ -14,6 +14,7 @@
  */
 
 #include "readInput.hpp"
+#include "binaryHeader.hpp"
 
 /**
   @brief Constructor for readInput class.
@@ -197,14 +198,16 @@ std::vector<std::vector<double>> readInput::readMAT(const std::string &filename)
 }
 
 /**
- * @brief 
+ * @brief Read this process's block of a binary map file (see binaryHeader).
  * 
+ * @tparam T Vertex index type; the indices are converted from the width recorded in the file
  * @param filename 
  * @param numProcesses 
  * @param rank 
- * @return std::map<std::vector<short>, short> 
+ * @return std::map<std::vector<T>, T> 
  */
-std::map<std::vector<short>, short> readInput::readBinaryMap(const std::string &filename, int numProcesses, int rank)
+template <typename T>
+std::map<std::vector<T>, T> readInput::readBinaryMap(const std::string &filename, int numProcesses, int rank)
 {
     std::ifstream file(filename, std::ios::in | std::ios::binary);
     if (!file.is_open())
@@ -213,29 +216,30 @@ std::map<std::vector<short>, short> readInput::readBinaryMap(const std::string &
         return {};
     }
 
-    std::map<std::vector<short>, short> data;
-
-    size_t mapSize;
-    size_t vectorSize;
+    std::map<std::vector<T>, T> data;
 
     // Read the size of the map and vector
-    file.read(reinterpret_cast<char *>(&mapSize), sizeof(mapSize));
-    file.read(reinterpret_cast<char *>(&vectorSize), sizeof(vectorSize));
-    size_t block_size = ceil((double) mapSize / numProcesses);
-    size_t end = block_size * (rank+1);
-    size_t start = (rank == 0) ? 0 : end - block_size;
+    binaryHeader header;
+    if (!header.read(file))
+    {
+        std::cerr << "Not a binary map file: " << filename << std::endl;
+        return {};
+    }
+    size_t block_size = ceil((double) header.count / numProcesses);
+    size_t end = std::min<size_t>(block_size * (rank+1), header.count);
+    size_t start = std::min<size_t>(block_size * rank, header.count);
 
     // Read data using standard file operations
-    std::vector<short> key(vectorSize);
-    short value;
+    std::vector<T> key(header.vectorSize);
+    T value;
 
     // Seek to the correct position in the file
-    file.seekg(sizeof(size_t) * 2 + (start * (vectorSize + 1)) * sizeof(short));
+    file.seekg(sizeof(binaryHeader) + start * header.recordBytes(true));
 
     for (size_t i = start; i < end; ++i)
     {
-        file.read(reinterpret_cast<char *>(key.data()), vectorSize * sizeof(short));
-        file.read(reinterpret_cast<char *>(&value), sizeof(short));
+        header.readIndices(file, key.data(), key.size());
+        header.readIndices(file, &value, 1);
         data.emplace(key, value);
     }
 
@@ -244,12 +248,14 @@ std::map<std::vector<short>, short> readInput::readBinaryMap(const std::string &
 }
 
 /**
- * @brief 
+ * @brief Read a binary vector file (see binaryHeader).
  * 
+ * @tparam T Vertex index type; the indices are converted from the width recorded in the file
  * @param filename 
- * @return std::vector<std::vector<short>> 
+ * @return std::vector<std::vector<T>> 
  */
-std::vector<std::vector<short>> readInput::readBinaryVector(const std::string &filename)
+template <typename T>
+std::vector<std::vector<T>> readInput::readBinaryVector(const std::string &filename)
 {
     std::ifstream file(filename, std::ios::in | std::ios::binary);
 
@@ -259,27 +265,35 @@ std::vector<std::vector<short>> readInput::readBinaryVector(const std::string &f
         return {};
     }
 
-    size_t dim1;
-    size_t dim2;
-
     // Read the dimensions of the vector
-    file.read(reinterpret_cast<char *>(&dim1), sizeof(dim1));
-    file.read(reinterpret_cast<char *>(&dim2), sizeof(dim2));
+    binaryHeader header;
+    if (!header.read(file))
+    {
+        std::cerr << "Not a binary vector file: " << filename << std::endl;
+        return {};
+    }
 
-    std::vector<std::vector<short>> data;
-    data.reserve(dim1);
+    std::vector<std::vector<T>> data;
+    data.reserve(header.count);
 
-    while (dim1-- > 0)
+    for (size_t i = 0; i < header.count; i++)
     {
-        std::vector<short> vec(dim2);
-        file.read(reinterpret_cast<char *>(vec.data()), dim2 * sizeof(short));
-        data.emplace_back(vec);
+        std::vector<T> vec(header.vectorSize);
+        header.readIndices(file, vec.data(), vec.size());
+        data.emplace_back(std::move(vec));
     }
 
     file.close();
     return data;
 }
 
+template std::map<std::vector<short>, short> readInput::readBinaryMap<short>(const std::string &, int, int);
+template std::map<std::vector<int32_t>, int32_t> readInput::readBinaryMap<int32_t>(const std::string &, int, int);
+template std::map<std::vector<int64_t>, int64_t> readInput::readBinaryMap<int64_t>(const std::string &, int, int);
+template std::vector<std::vector<short>> readInput::readBinaryVector<short>(const std::string &);
+template std::vector<std::vector<int32_t>> readInput::readBinaryVector<int32_t>(const std::string &);
+template std::vector<std::vector<int64_t>> readInput::readBinaryVector<int64_t>(const std::string &);
+
 /**
   @brief Initializes the input stream for reading from a file.
 
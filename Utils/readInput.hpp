@@ -21,8 +21,10 @@ public:
   readInput();
   static std::vector<std::vector<double>> readCSV(const std::string &filename);
   static std::vector<std::vector<double>> readMAT(const std::string &filename);
-  static std::map<std::vector<short>, short> readBinaryMap(const std::string &filename, int numProcesses = 1, int rank = 0);
-  static std::vector<std::vector<short>> readBinaryVector(const std::string &filename);
+  template <typename T>
+  static std::map<std::vector<T>, T> readBinaryMap(const std::string &filename, int numProcesses = 1, int rank = 0);
+  template <typename T>
+  static std::vector<std::vector<T>> readBinaryVector(const std::string &filename);
   bool streamInit(const std::string &filename);
   bool streamRead(std::vector<double> &);
 };
@@ -0,0 +1,187 @@
+#pragma once
+
+// Header file for the taskFrontier and concurrentHashMap classes
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <cstddef>
+#include <unordered_map>
+#include <omp.h>
+
+/**
+ * @brief Hash of a vector of integral values (vertex lists of facets and simplices)
+ *
+ */
+struct vectorHash
+{
+    template <typename T>
+    size_t operator()(const std::vector<T> &v) const
+    {
+        size_t h = 0xcbf29ce484222325ull;
+        for (auto x : v)
+            h = (h ^ static_cast<size_t>(x)) * 0x100000001b3ull;
+        return h ^ (h >> 29);
+    }
+};
+
+/**
+ * @brief Hash map shared by threads, split into independently locked shards
+ *
+ * A key is owned by the shard picked from its hash, so threads touching different keys rarely
+ * wait on the same lock. Every operation locks exactly one shard.
+ */
+template <typename Key, typename Value, typename Hash = vectorHash>
+class concurrentHashMap
+{
+private:
+    struct alignas(64) shard
+    {
+        std::mutex lock;
+        std::unordered_map<Key, Value, Hash> map;
+    };
+
+    std::vector<shard> shards;
+    Hash hasher;
+
+    shard &shardOf(const Key &key) { return shards[(hasher(key) >> 7) % shards.size()]; }
+
+public:
+    concurrentHashMap(size_t shardCount = 256) : shards(shardCount) {}
+
+    // Insert (key, value) if the key is absent; returns true if it was inserted
+    bool insert(const Key &key, const Value &value)
+    {
+        auto &s = shardOf(key);
+        std::lock_guard<std::mutex> guard(s.lock);
+        return s.map.emplace(key, value).second;
+    }
+
+    // Insert (key, value) if the key is absent, otherwise call f on the stored value; returns true if it was inserted
+    template <typename F>
+    bool insertOrVisit(const Key &key, const Value &value, F &&f)
+    {
+        auto &s = shardOf(key);
+        std::lock_guard<std::mutex> guard(s.lock);
+        auto it = s.map.emplace(key, value);
+        if (!it.second)
+            f(it.first->second);
+        return it.second;
+    }
+
+    // Copy the value stored for key into value; returns false if the key is absent
+    bool find(const Key &key, Value &value)
+    {
+        auto &s = shardOf(key);
+        std::lock_guard<std::mutex> guard(s.lock);
+        auto it = s.map.find(key);
+        if (it == s.map.end())
+            return false;
+        value = it->second;
+        return true;
+    }
+
+    size_t size()
+    {
+        size_t total = 0;
+        for (auto &s : shards)
+        {
+            std::lock_guard<std::mutex> guard(s.lock);
+            total += s.map.size();
+        }
+        return total;
+    }
+};
+
+/**
+ * @brief Work-stealing task pool for frontier (wavefront) expansions
+ *
+ * Every OpenMP thread owns a deque of tasks. A thread takes its newest task first (depth first, so the
+ * data it just touched is still in cache) and, once its deque is empty, steals the oldest task of another
+ * thread. Processing a task may spawn new tasks onto the deque of the running thread. The pool drains
+ * when no task is queued or running.
+ */
+template <typename Task>
+class taskFrontier
+{
+private:
+    struct alignas(64) taskQueue
+    {
+        std::mutex lock;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<taskQueue> queues;
+    std::atomic<size_t> pending{0}; // Tasks queued or running
+
+    bool pop(size_t owner, Task &task)
+    {
+        {
+            auto &q = queues[owner];
+            std::lock_guard<std::mutex> guard(q.lock);
+            if (!q.tasks.empty())
+            {
+                task = std::move(q.tasks.back());
+                q.tasks.pop_back();
+                return true;
+            }
+        }
+        for (size_t k = 1; k < queues.size(); k++)
+        {
+            auto &q = queues[(owner + k) % queues.size()];
+            std::lock_guard<std::mutex> guard(q.lock);
+            if (!q.tasks.empty())
+            {
+                task = std::move(q.tasks.front());
+                q.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+public:
+    /**
+     * @brief Run process(task, spawn) on the seeds and every task they spawn, across the OpenMP threads.
+     *
+     * @param seeds The initial tasks, spread round robin over the threads.
+     * @param process Called as process(Task &, spawn), where spawn(Task &&) queues a new task.
+     */
+    template <typename F>
+    void run(std::vector<Task> seeds, F &&process)
+    {
+        queues = std::vector<taskQueue>(omp_get_max_threads());
+        pending = seeds.size();
+        for (size_t i = 0; i < seeds.size(); i++)
+            queues[i % queues.size()].tasks.push_back(std::move(seeds[i]));
+
+#pragma omp parallel
+        {
+            const size_t self = omp_get_thread_num();
+            auto spawn = [&](Task &&task)
+            {
+                pending.fetch_add(1, std::memory_order_relaxed);
+                auto &q = queues[self];
+                std::lock_guard<std::mutex> guard(q.lock);
+                q.tasks.push_back(std::move(task));
+            };
+
+            Task task;
+            while (true)
+            {
+                if (pop(self, task))
+                {
+                    process(task, spawn);
+                    pending.fetch_sub(1, std::memory_order_acq_rel);
+                }
+                else if (pending.load(std::memory_order_acquire) == 0)
+                    break;
+                else
+                    std::this_thread::yield();
+            }
+        }
+        queues.clear();
+    }
+};
@@ -9,10 +9,12 @@
 #include <algorithm>
 #include <utility>
 #include <numeric>
+#include <limits>
 #include <iostream>
 #include <fstream>
 #include <iterator>
 #include "utils.hpp"
+#include "geometryKernels.hpp"
 #include <time.h>
 #include <execution>
 #include <Eigen/Dense>
@@ -237,6 +239,7 @@ std::vector<std::vector<std::vector<double>>> utils::separateBoundaryPartitions(
 }
 
 template std::set<unsigned> utils::extractBoundaryPoints<simplexNode>(const std::vector<std::shared_ptr<simplexNode>> &);
+template std::set<unsigned> utils::extractBoundaryPoints<wideSimplexNode>(const std::vector<std::shared_ptr<wideSimplexNode>> &);
 template std::set<unsigned> utils::extractBoundaryPoints<alphaNode>(const std::vector<std::shared_ptr<alphaNode>> &);
 template std::set<unsigned> utils::extractBoundaryPoints<witnessNode>(const std::vector<std::shared_ptr<witnessNode>> &);
 
@@ -257,6 +260,7 @@ std::set<unsigned> utils::extractBoundaryPoints(const std::vector<std::shared_pt
 }
 
 template std::set<unsigned> utils::extractBoundaryPoints<simplexNode>(const std::vector<simplexNode *> &);
+template std::set<unsigned> utils::extractBoundaryPoints<wideSimplexNode>(const std::vector<wideSimplexNode *> &);
 template std::set<unsigned> utils::extractBoundaryPoints<alphaNode>(const std::vector<alphaNode *> &);
 template std::set<unsigned> utils::extractBoundaryPoints<witnessNode>(const std::vector<witnessNode *> &);
 
@@ -352,48 +356,7 @@ Eigen::MatrixXd utils ::covariance(const std::vector<std::vector<double>> &input
  */
 double utils ::determinantOfMatrix(std::vector<std::vector<double>> mat, unsigned n)
 {
-	double det = 1;
-	unsigned index;
-	for (unsigned i = 0; i < n; i++)
-	{
-		index = i;
-		while (mat[index][i] == 0 && index < n)
-			index++;
-		if (index == n)
-			continue;
-		if (index != i)
-		{
-			for (unsigned j = 0; j < n; j++)
-			{
-				double temp12 = mat[index][j];
-				mat[index][j] = mat[i][j];
-				mat[i][j] = temp12;
-			}
-			det = det * pow(-1, index - i);
-		}
-		double rectemp = mat[i][i];
-		for (unsigned j = i; j < n; j++)
-			mat[i][j] /= rectemp;
-		for (unsigned j = i + 1; j < n; j++)
-		{
-			if (mat[j][i] != 0)
-			{
-				double rectemp2 = mat[j][i];
-				for (unsigned t = i; t < n; t++)
-					mat[i][t] *= rectemp2;
-				for (unsigned t = i; t < n; t++)
-					mat[j][t] -= mat[i][t];
-				for (unsigned k = 0; k < n; k++)
-					mat[i][k] /= rectemp2;
-			}
-		}
-		for (unsigned k = 0; k < n; k++)
-			mat[i][k] *= rectemp;
-	}
-	for (unsigned i = 0; i < n; i++)
-		det = det * mat[i][i];
-
-	return (det);
+	return geometryKernels::determinant(mat, n);
 }
 
 /**
@@ -453,64 +416,7 @@ std::vector<std::vector<double>> utils ::matrixMultiplication(const std::vector<
  */
 std::vector<std::vector<double>> utils ::inverseOfMatrix(std::vector<std::vector<double>> mat, int n)
 {
-	int index;
-	std::vector<std::vector<double>> matinv(n, std::vector<double>(n, 0));
-
-	for (int i = 0; i < n; i++)
-		matinv[i][i] = 1;
-
-	for (int i = 0; i < n; i++)
-	{
-		index = i;
-		while (mat[index][i] == 0 && index < n)
-			index++;
-		if (index == n)
-			continue;
-		if (index != i)
-		{
-			for (int j = 0; j < n; j++)
-			{
-				double temp12 = mat[index][j];
-				mat[index][j] = mat[i][j];
-				mat[i][j] = temp12;
-				double temp121 = matinv[index][j];
-				matinv[index][j] = matinv[i][j];
-				matinv[i][j] = temp121;
-			}
-		}
-		double rectemp = mat[i][i];
-		if (mat[i][i] != 1)
-		{
-			for (int j = 0; j < n; j++)
-			{
-				mat[i][j] /= rectemp;
-				matinv[i][j] /= rectemp;
-			}
-		}
-		for (int j = 0; j < n; j++)
-		{
-			if (mat[j][i] != 0 && j != i)
-			{
-				double rectemp2 = mat[j][i];
-				for (int t = 0; t < n; t++)
-				{
-					mat[i][t] *= rectemp2;
-					matinv[i][t] *= rectemp2;
-				}
-				for (int t = 0; t < n; t++)
-				{
-					mat[j][t] -= mat[i][t];
-					matinv[j][t] -= matinv[i][t];
-				}
-				for (int k = 0; k < n; k++)
-				{
-					mat[i][k] /= rectemp2;
-					matinv[i][k] /= rectemp2;
-				}
-			}
-		}
-	}
-	return matinv;
+	return geometryKernels::inverse(mat, n);
 }
 
 /**
@@ -717,91 +623,19 @@ std::pair<std::vector<double>, std::vector<std::vector<double>>> utils ::nullSpa
  */
 std::vector<double> utils::circumCenter(const std::set<unsigned> &simplex, const std::vector<std::vector<double>> &inputData)
 {
-	const int n = inputData[0].size();
-	const int m = simplex.size();
-
-	Eigen::MatrixXd matA(m, m);
-	Eigen::VectorXd matC(m, 1);
-	std::vector<double> circumCenter(n, 0.0);
-
-	std::set<unsigned> simplexcopy = simplex;
-
-	auto it = simplexcopy.end();
-	it--;
-	const unsigned Sn = *(it);
-	simplexcopy.erase(Sn);
-
-	int ii = 0;
-	for (auto i : simplexcopy)
-	{
-		int temp = ii;
-		const Eigen::VectorXd d1 = Eigen::Map<const Eigen::VectorXd>(inputData[i].data(), n) - Eigen::Map<const Eigen::VectorXd>(inputData[Sn].data(), n);
-		for (auto j : simplexcopy)
-		{
-			if (i <= j)
-			{
-				const Eigen::VectorXd d2 = Eigen::Map<const Eigen::VectorXd>(inputData[j].data(), n) - Eigen::Map<const Eigen::VectorXd>(inputData[Sn].data(), n);
-				const double dotProduct = d1.dot(d2);
-				matA(ii, temp) = dotProduct;
-				matA(temp, ii) = dotProduct;
-
-				if (i == j)
-					matC(ii) = dotProduct / 2.0;
-
-				temp++;
-			}
-		}
-		matA(ii, m - 1) = 0;
-		ii++;
-	}
-
-	matA.row(ii).setConstant(1);
-	matC(ii) = 1;
-
-	// Solve the linear system
-	Eigen::VectorXd rawCircumCenter = matA.inverse() * matC;
-
-	for (int i = 0; i < n; i++)
-	{
-		auto index = simplex.begin();
-		for (int j = 0; j < m; j++, ++index)
-		{
-			circumCenter[i] += rawCircumCenter(j) * inputData[*index][i];
-		}
-	}
-
-	return circumCenter;
+	return geometryKernels::circumCenter(simplex, inputData);
 }
 
 /**
- * @brief
+ * @brief Squared circumradius of the simplex (see geometryKernels::circumRadius).
  *
  * @param simplex
  * @param distMatrix
- * @return double
+ * @return double The squared radius, or the largest double for a degenerate simplex.
  */
-double utils::circumRadius(const std::set<unsigned> &simplex, const std::vector<std::vector<double>> *distMatrix)
+double utils::circumRadius(const std::set<unsigned> &simplex, const distanceMatrix *distMatrix)
 {
-	unsigned n = simplex.size();
-	Eigen::MatrixXd matA(n, n);
-	Eigen::MatrixXd matACap(n + 1, n + 1);
-	unsigned ii = 0;
-	for (auto i : simplex)
-	{
-		matACap.row(ii + 1).col(0).setConstant(1); // Set column 0 of matACap to 1
-		unsigned temp = 0;
-		for (auto j : simplex)
-		{
-			double distSquared = pow(((*distMatrix)[i][j] != 0) ? (*distMatrix)[i][j] : (*distMatrix)[j][i], 2);
-			matA(ii, temp) = distSquared;
-			matACap(ii + 1, temp + 1) = distSquared;
-			temp++;
-		}
-		ii++;
-	}
-	matACap.row(0).setConstant(1);
-	matACap(0, 0) = 0;
-	double result = (-matA.determinant() / (2 * matACap.determinant()));
+	double result = geometryKernels::circumRadius(simplex, *distMatrix);
 	if (result < 0)
 		result = std::numeric_limits<double>::max();
 	return result;
@@ -816,59 +650,19 @@ double utils::circumRadius(const std::set<unsigned> &simplex, const std::vector<
  */
 std::vector<double> utils::circumCenter(const std::vector<short> &simplex, const std::vector<std::vector<double>> &inputData)
 {
-	const int n = inputData[0].size();
-	const int m = simplex.size();
-	Eigen::MatrixXd matA(m, m);
-	Eigen::VectorXd matC(m, 1);
-	std::vector<double> circumCenter(n, 0.0);
-	const Eigen::VectorXd &Sn = Eigen::Map<const Eigen::VectorXd>(inputData[simplex.back()].data(), n);
-	for (int i = 0; i < m - 1; ++i)
-	{
-		const Eigen::VectorXd &d1 = Eigen::Map<const Eigen::VectorXd>(inputData[simplex[i]].data(), n) - Sn;
-		for (int j = i; j < m - 1; ++j)
-		{
-			const double dotProduct = d1.dot(Eigen::Map<const Eigen::VectorXd>(inputData[simplex[j]].data(), n) - Sn);
-			matA(i, j) = dotProduct;
-			matA(j, i) = dotProduct;
-		}
-	}
-	matA.col(m - 1).setZero();
-	matA.row(m - 1).setOnes();
-	matC = matA.diagonal() / 2;
-	matC(m - 1) = 1;
-	// Solve the linear
-	Eigen::VectorXd rawCircumCenter = matA.inverse() * matC;
-	for (int i = 0; i < m; ++i)
-		for (int j = 0; j < n; ++j)
-			circumCenter[j] += rawCircumCenter(i) * inputData[simplex[i]][j];
-	return circumCenter;
+	return geometryKernels::circumCenter(simplex, inputData);
 }
 
 /**
- * @brief
+ * @brief Squared circumradius of the simplex (see geometryKernels::circumRadius).
  *
  * @param simplex
  * @param distMatrix
- * @return double
+ * @return double The squared radius; negative for a degenerate simplex, which callers resolve from the circumcenter.
  */
-double utils::circumRadius(const std::vector<short> &simplex, const std::vector<std::vector<double>> &distMatrix)
+double utils::circumRadius(const std::vector<short> &simplex, const distanceMatrix &distMatrix)
 {
-	const unsigned n = simplex.size();
-	Eigen::MatrixXd matA(n, n);
-	Eigen::MatrixXd matACap(n + 1, n + 1);
-	for (unsigned i = 0; i < n; ++i)
-		for (unsigned j = 0; j < n; ++j)
-			matA(i, j) = pow(simplex[i] <= simplex[j] ? distMatrix[simplex[i]][simplex[j]] : distMatrix[simplex[j]][simplex[i]], 2);
-	matACap.block(1, 1, n, n) = matA;
-	matACap.col(0).setConstant(1);
-	matACap.row(0).setConstant(1);
-	matACap(0, 0) = 0;
-	double result = -matA.determinant() / (2 * matACap.determinant());
-	if (result < 0)
-	{
-		std::numeric_limits<double>::max();
-	}
-	return result;
+	return geometryKernels::circumRadius(simplex, distMatrix);
 }
 
 /**
@@ -879,33 +673,9 @@ double utils::circumRadius(const std::vector<short> &simplex, const std::vector<
  * @param dd
  * @return double
  */
-double utils ::simplexVolume(const std::set<unsigned> &simplex, const std::vector<std::vector<double>> *distMatrix, int dd)
+double utils ::simplexVolume(const std::set<unsigned> &simplex, const distanceMatrix *distMatrix, int dd)
 {
-	std::vector<std::vector<double>> matACap(simplex.size() + 1);
-	int ii = 0;
-	for (auto i : simplex)
-	{
-		matACap[ii + 1].push_back(1);
-		for (auto j : simplex)
-		{
-			if ((*distMatrix)[i][j] != 0)
-			{
-				matACap[ii + 1].push_back(pow(((*distMatrix)[i][j]), 2));
-			}
-			else
-			{
-				matACap[ii + 1].push_back(pow(((*distMatrix)[j][i]), 2));
-			}
-		}
-		ii++;
-	}
-	matACap[0].push_back(0);
-	for (size_t i = 0; i < simplex.size(); i++)
-		matACap[0].push_back(1);
-	if (dd % 2 == 0)
-		return ((-1) * determinantOfMatrix(matACap, simplex.size() + 1)) / (pow(2, dd) * (pow(tgamma(dd + 1), 2)));
-	else
-		return (determinantOfMatrix(matACap, simplex.size() + 1)) / (pow(2, dd) * (pow(tgamma(dd + 1), 2)));
+	return geometryKernels::simplexVolume(simplex, *distMatrix, dd);
 }
 
 /**
@@ -937,221 +707,137 @@ double utils ::simplexVolume(const std::vector<std::vector<double>> &spoints)
 }
 
 /**
- * @brief
+ * @brief Beta-skeleton incidence of every pair of points.
+ *
+ * The pair (i, j) is incident when its empty region has no other point in it. For beta <= 1 and for
+ * the lune (beta > 1) the region is the intersection of two balls; for the circle mode (beta > 1) it
+ * is their union. Either region is symmetric about the midpoint of the pair, so a single kdTree query
+ * on the sphere around the midpoint that encloses it gives the only candidates worth testing, and the
+ * test stops at the first point found inside. The point that emptied the previous pair of a row is
+ * tried before the query. Rows are independent and are filled across threads.
  *
  * @param inData
  * @param beta
  * @param betaMode
- * @return std::vector<std::vector<bool>>
+ * @return bitMatrix The incident pairs.
  */
-std::vector<std::vector<bool>> utils ::betaNeighbors(const std::vector<std::vector<double>> &inData, double beta, const std::string &betaMode)
+bitMatrix utils ::betaNeighbors(const std::vector<std::vector<double>> &inData, double beta, const std::string &betaMode)
 {
-	std::vector<std::vector<bool>> incidenceMatrix(inData.size(), std::vector<bool>(inData.size(), 0));
-	kdTree tree(inData, inData.size()); // KDTree for efficient nearest neighbor search
-	double betafactor;
-	std::vector<std::vector<double>> rotationMatrix(inData[0].size(), std::vector<double>(inData[0].size(), 0));
-
-	//[
-	// cos(90) -sin(90)  ................... 0
-	// sin(90) cos(90)  .....................0
-	// 0		0	0 ......0.......0
-	//......................1......	0	0
-	// 0		0	0	1	0
-	// 0		0	0	0    	1
-	//]
-
-	for (unsigned i = 0; i < inData[0].size(); i++)
-	{
-		for (unsigned j = 0; j < inData[0].size(); j++)
-		{
-			if (i == 1 && j == 0)
-				rotationMatrix[i][j] = 1;
-			else if (i == 0 && j == 1)
-				rotationMatrix[i][j] = -1;
-			else if (i == 0 && j == 0)
-				rotationMatrix[i][j] = 0;
-			else if (i == 1 && j == 1)
-				rotationMatrix[i][j] = 0;
-			else if (i == j)
-				rotationMatrix[i][j] = 1;
-			else
-				rotationMatrix[i][j] = 0;
-		}
-	}
+	const size_t n = inData.size();
+	bitMatrix incidenceMatrix(n);
+	if (n == 0)
+		return incidenceMatrix;
 
 	if (beta < 0)
 	{
 		std::cout << "Invalid Beta Value :: Value set to 1" << std::endl;
 		beta = 1; // Changing to Default
 	}
-	for (unsigned i = 0; i < inData.size(); i++)
+	const bool lune = beta > 1 && betaMode == "lune", circle = beta > 1 && betaMode == "circle";
+	if (beta > 1 && !lune && !circle)
+		return incidenceMatrix;
+
+	const size_t dim = inData[0].size();
+	kdTree tree(inData, n); // KDTree for efficient nearest neighbor search
+
+	// Offset of the ball centers from the midpoint: factor * R(q - p), with R the quarter turn
+	//	 [ 0 -1 0 ... ]
+	//	 [ 1  0 0 ... ]
+	//	 [ 0  0 1 ... ]
+	// in the first two coordinates (beta <= 1 and circle modes)
+	const double betafactor = beta <= 1 ? sqrt(1 - pow(beta, 2)) / (2 * beta) : sqrt(pow(beta, 2) - 1) / 2;
+
+#pragma omp parallel
 	{
-		for (unsigned j = i + 1; j < inData.size(); j++)
+		std::vector<double> mid(dim), center1(dim), center2(dim), offset(dim);
+
+#pragma omp for schedule(dynamic, 16)
+		for (size_t i = 0; i < n; i++)
 		{
-			/*	std::cout<<" First Point \n";
-				for(auto x:inData[i])
-					std::cout<<x<<" ";
-
-				std::cout<<" Second Point \n";
-				for(auto x:inData[j])
-					std::cout<<x<<" ";
-			*/
-			double radius;
-			std::vector<double> temp;
-			std::vector<double> center1;
-			std::vector<double> center2;
-			std::vector<double> temp1;
-			std::vector<double> tempfinal;
-			std::vector<std::vector<double>> colvector;
-			if (beta <= 1)
-			{ // Common Definition for lune and circle based beta-Skeleton
-				radius = vectors_distance(inData[i], inData[j]) / (2 * beta);
-				std::transform(inData[i].begin(), inData[i].end(), inData[j].begin(), std::back_inserter(temp), [](double e1, double e2)
-							   { return ((e1 + e2) / 2); });
-				betafactor = sqrt((1 - pow(beta, 2))) / (2 * beta);
-				std::transform(inData[i].begin(), inData[i].end(), inData[j].begin(), std::back_inserter(temp1), [](double e1, double e2)
-							   { return ((e2 - e1)); });
-				for (auto x : temp1)
+			const double *p = inData[i].data();
+			size_t witness = n;
+			for (size_t j = i + 1; j < n; j++)
+			{
+				const double *q = inData[j].data();
+
+				double sq = 0;
+				for (size_t k = 0; k < dim; k++)
 				{
-					std::vector<double> singlevector;
-					singlevector.push_back(x);
-					colvector.push_back(singlevector);
+					sq += (p[k] - q[k]) * (p[k] - q[k]);
+					mid[k] = (p[k] + q[k]) / 2;
+				}
+				const double d = sqrt(sq);
+
+				double radius;
+				if (lune)
+				{ // Lune Based Beta Skeleton for beta > 1
+					radius = (d * beta) / 2;
+					const double bf = beta / 2, bf1 = 1 - beta / 2;
+					for (size_t k = 0; k < dim; k++)
+					{
+						center1[k] = p[k] * bf + q[k] * bf1;
+						center2[k] = q[k] * bf + p[k] * bf1;
+					}
 				}
-				std::vector<std::vector<double>> matmul = matrixMultiplication(rotationMatrix, colvector);
-				for (auto x : matmul)
-					for (auto y : x)
-						tempfinal.push_back(y * betafactor);
-				std::transform(temp.begin(), temp.end(), tempfinal.begin(), std::back_inserter(center1), [](double e1, double e2)
-							   { return ((e1 + e2)); });
-				std::transform(temp.begin(), temp.end(), tempfinal.begin(), std::back_inserter(center2), [](double e1, double e2)
-							   { return ((e1 - e2)); });
-
-				/*	     	   std::cout<<" First Center and radius:: "<<radius<<"\n";
-						   for(auto x:center1)
-							std::cout<<x<<" ";
-							   std::cout<<" Second Center \n";
-						   for(auto x:center2)
-							std::cout<<x<<" ";
-				*/
-				std::vector<size_t> neighbors1 = tree.neighborhoodIndices(center1, radius); // All neighbors in radius-ball
-				std::vector<unsigned> toremove;
-				toremove.push_back(i);
-				toremove.push_back(j);
-				std::sort(toremove.begin(), toremove.end());
-				std::sort(neighbors1.begin(), neighbors1.end());
-				std::vector<int> neg1;
-				std::set_difference(neighbors1.begin(), neighbors1.end(), toremove.begin(), toremove.end(), std::back_inserter(neg1));
-
-				std::vector<size_t> neighbors2 = tree.neighborhoodIndices(center2, radius); // All neighbors in radius-ball
-				std::sort(neighbors2.begin(), neighbors2.end());
-				std::vector<int> neg2;
-				std::set_difference(neighbors2.begin(), neighbors2.end(), toremove.begin(), toremove.end(), std::back_inserter(neg2));
-
-				std::vector<size_t> neighbors;
-
-				std::vector<size_t> v(std::min(neg1.size(), neg2.size()));
-				std::vector<size_t>::iterator it;
-				std::sort(neg1.begin(), neg1.end());
-				std::sort(neg2.begin(), neg2.end());
-				it = std::set_intersection(neg1.begin(), neg1.end(), neg2.begin(), neg2.end(), v.begin());
-				v.resize(it - v.begin());
-				neighbors = v;
-
-				if (neighbors.size() == 0)
-					incidenceMatrix[i][j] = true;
-				else
-					incidenceMatrix[i][j] = false;
-			}
-			else if (betaMode == "lune")
-			{ // Lune Based Beta Skeleton for beta > 1
-				radius = (vectors_distance(inData[i], inData[j]) * beta) / 2;
-				double bf = beta / 2;
-				double bf1 = 1 - beta / 2;
-
-				std::transform(inData[i].begin(), inData[i].end(), inData[j].begin(), std::back_inserter(center1), [bf, bf1](double e1, double e2)
-							   { return ((e1 * bf + e2 * bf1)); });
-				std::transform(inData[j].begin(), inData[j].end(), inData[i].begin(), std::back_inserter(center2), [bf, bf1](double e1, double e2)
-							   { return ((e1 * bf + e2 * bf1)); });
-
-				std::vector<size_t> neighbors1 = tree.neighborhoodIndices(center1, radius); // All neighbors in radius-ball
-				std::vector<unsigned> toremove;
-				toremove.push_back(i);
-				toremove.push_back(j);
-				std::sort(toremove.begin(), toremove.end());
-				std::sort(neighbors1.begin(), neighbors1.end());
-				std::vector<int> neg1;
-				std::set_difference(neighbors1.begin(), neighbors1.end(), toremove.begin(), toremove.end(), std::back_inserter(neg1));
-
-				std::vector<size_t> neighbors2 = tree.neighborhoodIndices(center2, radius); // All neighbors in radius-ball
-				std::sort(neighbors2.begin(), neighbors2.end());
-				std::vector<int> neg2;
-				std::set_difference(neighbors2.begin(), neighbors2.end(), toremove.begin(), toremove.end(), std::back_inserter(neg2));
-
-				std::vector<size_t> neighbors;
-
-				std::vector<size_t> v(std::min(neg1.size(), neg2.size()));
-				std::vector<size_t>::iterator it;
-				std::sort(neg1.begin(), neg1.end());
-				std::sort(neg2.begin(), neg2.end());
-				it = std::set_intersection(neg1.begin(), neg1.end(), neg2.begin(), neg2.end(), v.begin());
-				v.resize(it - v.begin());
-				neighbors = v;
-
-				if (neighbors.size() == 0)
-					incidenceMatrix[i][j] = true;
 				else
-					incidenceMatrix[i][j] = false;
-			}
-			else if (betaMode == "circle")
-			{ // Circle Based Beta Skeleton for beta >1
-				radius = (vectors_distance(inData[i], inData[j]) * beta) / (2);
-				std::transform(inData[i].begin(), inData[i].end(), inData[j].begin(), std::back_inserter(temp), [](double e1, double e2)
-							   { return ((e1 + e2) / 2); });
-				betafactor = sqrt((pow(beta, 2) - 1)) / 2;
-				std::transform(inData[i].begin(), inData[i].end(), inData[j].begin(), std::back_inserter(temp1), [](double e1, double e2)
-							   { return ((e2 - e1)); });
-				for (auto x : temp1)
+				{ // Common Definition for lune and circle based beta-Skeleton (beta <= 1), circle based for beta > 1
+					radius = circle ? (d * beta) / 2 : d / (2 * beta);
+					for (size_t k = 0; k < dim; k++)
+						offset[k] = (q[k] - p[k]) * betafactor;
+					if (dim > 1)
+					{
+						offset[0] = -(q[1] - p[1]) * betafactor;
+						offset[1] = (q[0] - p[0]) * betafactor;
+					}
+					else
+						offset[0] = 0;
+					for (size_t k = 0; k < dim; k++)
+					{
+						center1[k] = mid[k] + offset[k];
+						center2[k] = mid[k] - offset[k];
+					}
+				}
+
+				// Sphere around the midpoint enclosing the region: the lens of the two balls, or their union
+				double half = 0;
+				for (size_t k = 0; k < dim; k++)
+					half += (center1[k] - mid[k]) * (center1[k] - mid[k]);
+				half = sqrt(half);
+				double bound = circle ? radius + half : sqrt(std::max(0.0, radius * radius - half * half));
+				bound = bound * (1 + 1e-9) + 1e-12; // Candidates are tested exactly below
+
+				auto inside = [&](size_t x)
 				{
-					std::vector<double> singlevector;
-					singlevector.push_back(x);
-					colvector.push_back(singlevector);
+					if (x == i || x == j)
+						return false;
+					const double *w = inData[x].data();
+					double d1 = 0, d2 = 0;
+					for (size_t k = 0; k < dim; k++)
+					{
+						d1 += (w[k] - center1[k]) * (w[k] - center1[k]);
+						d2 += (w[k] - center2[k]) * (w[k] - center2[k]);
+					}
+					const bool in1 = d1 <= radius * radius, in2 = d2 <= radius * radius;
+					return circle ? (in1 || in2) : (in1 && in2);
+				};
+
+				// The point that emptied the previous pair of the row often lies in this region too
+				if (witness < n && inside(witness))
+					continue;
+
+				bool empty = true;
+				for (size_t x : tree.neighborhoodIndices(mid, bound))
+				{
+					if (inside(x))
+					{
+						witness = x;
+						empty = false;
+						break;
+					}
 				}
-				std::vector<std::vector<double>> matmul = matrixMultiplication(rotationMatrix, colvector);
-				for (auto x : matmul)
-					for (auto y : x)
-						tempfinal.push_back(y * betafactor);
-				std::transform(temp.begin(), temp.end(), tempfinal.begin(), std::back_inserter(center1), [](double e1, double e2)
-							   { return ((e1 + e2)); });
-				std::transform(temp.begin(), temp.end(), tempfinal.begin(), std::back_inserter(center2), [](double e1, double e2)
-							   { return ((e1 - e2)); });
-
-				std::vector<size_t> neighbors1 = tree.neighborhoodIndices(center1, radius); // All neighbors in radius-ball
-				std::vector<unsigned> toremove;
-				toremove.push_back(i);
-				toremove.push_back(j);
-				std::sort(toremove.begin(), toremove.end());
-				std::sort(neighbors1.begin(), neighbors1.end());
-				std::vector<int> neg1;
-				std::set_difference(neighbors1.begin(), neighbors1.end(), toremove.begin(), toremove.end(), std::back_inserter(neg1));
-
-				std::vector<size_t> neighbors2 = tree.neighborhoodIndices(center2, radius); // All neighbors in radius-ball
-				std::sort(neighbors2.begin(), neighbors2.end());
-				std::vector<int> neg2;
-				std::set_difference(neighbors2.begin(), neighbors2.end(), toremove.begin(), toremove.end(), std::back_inserter(neg2));
-
-				std::vector<size_t> neighbors;
-
-				std::vector<size_t> v(neighbors1.size() + neighbors2.size());
-				std::vector<size_t>::iterator it;
-				std::sort(neg1.begin(), neg1.end());
-				std::sort(neg2.begin(), neg2.end());
-				it = std::set_union(neg1.begin(), neg1.end(), neg2.begin(), neg2.end(), v.begin());
-				v.resize(it - v.begin());
-				neighbors = v;
-				if (neighbors.size() == 0)
-					incidenceMatrix[i][j] = true;
-				else
-					incidenceMatrix[i][j] = false;
+
+				if (empty)
+					incidenceMatrix.set(i, j);
 			}
 		}
 	}
@@ -1319,6 +1005,74 @@ double utils::vectors_distance(const std::vector<double> &a, const std::vector<d
 #endif
 }
 
+// Farthest point found by a thread -> (distance to the selection, point); ties go to the lower point
+typedef std::pair<double, unsigned> farthestPoint;
+#pragma omp declare reduction(farthest:farthestPoint : omp_out = (omp_in.first > omp_out.first || (omp_in.first == omp_out.first && omp_in.second < omp_out.second)) ? omp_in : omp_out) initializer(omp_priv = farthestPoint(-1, 0))
+
+/**
+ * @brief Maxmin (greedy farthest point) selection of landmarks from a point cloud.
+ *
+ * Starting from point 0, each step selects the point farthest from the landmarks chosen so far;
+ * that distance is its insertion radius (infinite for the first landmark), and the radii are
+ * non-increasing. The distance of every point to the selection is updated from the newest landmark
+ * in one parallel pass per step, so only count rows of landmark x point distances are evaluated.
+ *
+ * @param points The point cloud, one vector per point.
+ * @param count Number of landmarks to select; all points gives the full greedy permutation.
+ * @return std::pair<std::vector<unsigned>, std::vector<double>> The landmarks in selection order and their insertion radii.
+ */
+std::pair<std::vector<unsigned>, std::vector<double>> utils::maxminLandmarks(const std::vector<std::vector<double>> &points, size_t count)
+{
+	const size_t n = points.size();
+	count = std::min(count, n);
+	std::vector<unsigned> landmarks(count);
+	std::vector<double> radii(count);
+	if (count == 0)
+		return {landmarks, radii};
+
+	// Pack the points into a contiguous buffer for the distance passes
+	const size_t dim = points[0].size();
+	std::vector<double> coords(n * dim);
+	for (size_t i = 0; i < n; i++)
+		std::copy(points[i].begin(), points[i].end(), coords.begin() + i * dim);
+
+	// Squared distance of each point to the selection; -1 once the point is selected
+	std::vector<double> cover(n, std::numeric_limits<double>::infinity());
+	farthestPoint next(std::numeric_limits<double>::infinity(), 0);
+
+	for (size_t i = 0; i < count; i++)
+	{
+		const unsigned pt = next.second;
+		landmarks[i] = pt;
+		radii[i] = std::sqrt(next.first);
+		cover[pt] = -1;
+
+		if (i + 1 == count)
+			break;
+
+		const double *a = coords.data() + pt * dim;
+		next = farthestPoint(-1, 0);
+#pragma omp parallel for schedule(static) reduction(farthest : next)
+		for (size_t j = 0; j < n; j++)
+		{
+			if (cover[j] < 0)
+				continue;
+
+			const double *b = coords.data() + j * dim;
+			double sq = 0;
+#pragma omp simd reduction(+ : sq)
+			for (size_t k = 0; k < dim; k++)
+				sq += (a[k] - b[k]) * (a[k] - b[k]);
+
+			cover[j] = std::min(cover[j], sq);
+			if (cover[j] > next.first)
+				next = farthestPoint(cover[j], j);
+		}
+	}
+
+	return {landmarks, radii};
+}
+
 /**
  * @brief
  *
@@ -1743,7 +1497,7 @@ std::vector<double> utils::serialize(const std::vector<std::vector<double>> &ori
  * @param beta
  * @return std::pair<std::vector<std::vector<double>>, std::vector<double>>
  */
-std::pair<std::vector<std::vector<double>>, std::vector<double>> utils::calculateBetaCentersandRadius(const std::vector<unsigned> &dsimplex, const std::vector<std::vector<double>> &inputData, const std::vector<std::vector<double>> *distMatrix, double beta)
+std::pair<std::vector<std::vector<double>>, std::vector<double>> utils::calculateBetaCentersandRadius(const std::vector<unsigned> &dsimplex, const std::vector<std::vector<double>> &inputData, const distanceMatrix *distMatrix, double beta)
 {
 	std::vector<std::vector<double>> betacenters;
 	std::vector<double> betaradii;
@@ -1777,7 +1531,7 @@ std::pair<std::vector<std::vector<double>>, std::vector<double>> utils::calculat
 	if (simplex.size() > 2)
 		circumRadius = utils::circumRadius(simplex, distMatrix);
 	else
-		circumRadius = pow((*distMatrix)[dsimplex[0]][dsimplex[1]] / 2, 2);
+		circumRadius = pow((*distMatrix)(dsimplex[0], dsimplex[1]) / 2, 2);
 
 	std::vector<size_t> neighbors;
 	std::vector<std::vector<size_t>> neighborsCircleIntersection;
@@ -1795,7 +1549,7 @@ std::pair<std::vector<std::vector<double>>, std::vector<double>> utils::calculat
 		if (face.size() > 2)
 			faceRadius = utils::circumRadius(face, distMatrix);
 		else
-			faceRadius = pow((*distMatrix)[face1[0]][face1[1]] / 2, 2);
+			faceRadius = pow((*distMatrix)(face1[0], face1[1]) / 2, 2);
 		auto result = utils::nullSpaceOfMatrix(face, inputData, faceCC, sqrt(faceRadius));
 		std::vector<double> hpcoff = result.first;
 		std::vector<double> betaCenter;
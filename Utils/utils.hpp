@@ -8,22 +8,80 @@
 #include <Eigen/Eigenvalues>
 #include <cmath>
 #include <numeric>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+#include <array>
+#include <string>
+#include <stdexcept>
 #include "kdTree.hpp"
+#include "distanceMatrix.hpp"
+#include "bitMatrix.hpp"
+
+// Combinatorial index (hash) of a simplex, the sum of C(v_i, i + 1) over its sorted vertices
+//	Kept in 128 bits so the explicit complexes index past C(n, k) = 2^63 like the implicit ones
+typedef __int128 simplexKey;
+
+// Hash of a combinatorial simplex index (long long or __int128)
+//	std::hash<__int128> is a GNU extension, so the two 64-bit halves are folded and mixed here
+struct indexHash
+{
+	template <typename index>
+	size_t operator()(index key) const
+	{
+		const unsigned __int128 wide = (unsigned __int128)key;
+		uint64_t x = (uint64_t)wide ^ ((uint64_t)(wide >> 64) * 0x9e3779b97f4a7c15ULL);
+		x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+		return x ^ (x >> 31);
+	}
+};
+
+// simplexKey as stored in a node, in two 64-bit halves
+//	An __int128 member is 16-byte aligned and pads simplexNode from 72 to 96 bytes; the halves keep the 8-byte
+//	alignment of the other members, so the wide key costs its own 8 bytes (wideSimplexNode is 80 bytes)
+struct nodeKey
+{
+	uint64_t low, high;
+	nodeKey(simplexKey key = -1) : low((uint64_t)key), high((uint64_t)((unsigned __int128)key >> 64)) {}
+	operator simplexKey() const { return (simplexKey)(((unsigned __int128)high << 64) | low); }
+};
+static_assert(sizeof(nodeKey) == 16 && alignof(nodeKey) == 8);
+
+// wideKeys -> Whether the simplex hashes of n points up to maxDimension need 128 bits, i.e. the largest binomial
+//	coefficient C(n, k), k <= maxDimension + 1, of the complex's binomialTable outgrows 63 bits
+inline bool wideKeys(size_t n, unsigned maxDimension)
+{
+	const size_t k = std::min<size_t>(maxDimension + 1, n / 2);
+	__int128 coefficient = 1;
+	for (size_t j = 1; j <= k; j++)
+	{
+		coefficient = coefficient * (n - j + 1) / j; // C(n, j)
+		if (coefficient > std::numeric_limits<long long>::max())
+			return true;
+	}
+	return false;
+}
 
 /**
  * @brief Simplex Node Structure
  *
+ * The hash is a long long (simplexNode), or a nodeKey (wideSimplexNode) for runs whose hashes outgrow 63 bits;
+ * LHF picks one from the point count and --dimensions (see wideKeys).
  */
-struct simplexNode
+template <typename key>
+struct basicSimplexNode
 {
 	unsigned index;
-	long long hash = -1;
+	key hash = -1;
 
 	std::set<unsigned> simplex = {};
 	double weight = 0;
-	simplexNode() {}
-	simplexNode(std::set<unsigned> simp, double wt) : simplex(simp), weight(wt) {}
+	basicSimplexNode() {}
+	basicSimplexNode(std::set<unsigned> simp, double wt) : simplex(simp), weight(wt) {}
 };
+typedef basicSimplexNode<long long> simplexNode;
+typedef basicSimplexNode<nodeKey> wideSimplexNode;
 
 /**
  * @brief Alpha Node Structure
@@ -32,7 +90,7 @@ struct simplexNode
 struct alphaNode
 {
 	unsigned index;
-	long long hash = -1;
+	nodeKey hash = -1;
 
 	std::set<unsigned> simplex = {};
 	double weight = 0;
@@ -55,7 +113,7 @@ struct alphaNode
 struct witnessNode
 {
 	unsigned index;
-	long long hash = -1;
+	nodeKey hash = -1;
 
 	std::set<unsigned> witnessPts;
 	std::vector<double> landmarkPt;
@@ -66,6 +124,57 @@ struct witnessNode
 	witnessNode(std::set<unsigned> simp, double wt) : simplex(simp), weight(wt) {}
 };
 
+/**
+ * @brief Flat Simplex Structure
+ *
+ * Weight, hash and sorted vertices of a simplex in one trivially copyable record; the records of a dimension are
+ * stored back to back in the arena of the complex (see simplexArrayList::flatten). maxVertices bounds the vertices
+ * of the largest simplex, a d-simplex uses vertices[0 ... d]. The hash has the width of the node hashes of the complex.
+ */
+template <unsigned maxVertices, typename key>
+struct flatSimplex
+{
+	double weight;
+	key hash;
+	std::array<unsigned, maxVertices> vertices;
+};
+
+// Largest --dimensions of the flat storage; the records of a run hold dimensions + 1 vertices
+constexpr int flatMaxDimensions = 4;
+
+// storageError -> Why the persistence pipes cannot run with this storage and --dimensions; empty when they can
+inline std::string storageError(const std::string &storage, int dimensions)
+{
+	if (storage != "nodes" && storage != "flat")
+		return "Unknown storage " + storage + ", expected nodes or flat";
+	if (storage == "flat" && (dimensions < 1 || dimensions > flatMaxDimensions))
+		return "Flat storage computes dimensions 1 to " + std::to_string(flatMaxDimensions);
+	return "";
+}
+
+// Call f.template operator()<maxVertices>() with the record capacity of a flat run computing dimensions (1 ... flatMaxDimensions)
+template <typename F>
+void flatDispatch(int dimensions, F &&f)
+{
+	switch (dimensions)
+	{
+	case 1:
+		f.template operator()<2>();
+		break;
+	case 2:
+		f.template operator()<3>();
+		break;
+	case 3:
+		f.template operator()<4>();
+		break;
+	case 4:
+		f.template operator()<5>();
+		break;
+	default:
+		throw std::invalid_argument("Flat storage computes dimensions 1 to " + std::to_string(flatMaxDimensions));
+	}
+}
+
 /**
  * @brief
  *
@@ -117,6 +226,16 @@ public:
 	template <typename T>
 	static std::set<unsigned> extractBoundaryPoints(const std::vector<T *> &);
 
+	// Vertices of the flat dim-simplices of a boundary
+	template <unsigned maxVertices, typename key>
+	static std::set<unsigned> extractBoundaryPoints(const std::vector<flatSimplex<maxVertices, key> *> &boundary, unsigned dim)
+	{
+		std::set<unsigned> boundaryPoints;
+		for (auto simplex : boundary)
+			boundaryPoints.insert(simplex->vertices.begin(), simplex->vertices.begin() + dim + 1);
+		return boundaryPoints;
+	}
+
 	static std::vector<bettiBoundaryTableEntry> mapPartitionIndexing(const std::vector<unsigned> &, std::vector<bettiBoundaryTableEntry>); // Const
 	static void print2DVector(const std::vector<std::vector<unsigned>> &);
 	static void print1DVector(const std::vector<unsigned> &);
@@ -125,6 +244,7 @@ public:
 	static void print1DSet(const std::pair<std::set<unsigned>, double> &);
 	static inline double vectors_distance(const double &, const double &);
 	static double vectors_distance(const std::vector<double> &, const std::vector<double> &);
+	static std::pair<std::vector<unsigned>, std::vector<double>> maxminLandmarks(const std::vector<std::vector<double>> &, size_t);
 	static std::set<unsigned> setXOR(const std::set<unsigned> &, const std::set<unsigned> &);
 	static std::set<unsigned> setIntersect(const std::set<unsigned> &, const std::set<unsigned> &);
 	static std::vector<unsigned> setIntersect(std::vector<unsigned>, std::vector<unsigned>, bool);
@@ -142,19 +262,19 @@ public:
 
 	static double determinantOfMatrix(std::vector<std::vector<double>> mat, unsigned n); // Const
 	// Alpha (delaunay)
-	static double circumRadius(const std::set<unsigned> &simplex, const std::vector<std::vector<double>> *distMatrix);
-	static double circumRadius(const std::vector<short> &simplex, const std::vector<std::vector<double>> &distMatrix);
+	static double circumRadius(const std::set<unsigned> &simplex, const distanceMatrix *distMatrix);
+	static double circumRadius(const std::vector<short> &simplex, const distanceMatrix &distMatrix);
 	static std::vector<double> circumCenter(const std::set<unsigned> &simplex, const std::vector<std::vector<double>> &inputData);
 	static std::vector<double> circumCenter(const std::vector<short> &simplex, const std::vector<std::vector<double>> &inputData);
-	static double simplexVolume(const std::set<unsigned> &simplex, const std::vector<std::vector<double>> *distMatrix, int dd);
+	static double simplexVolume(const std::set<unsigned> &simplex, const distanceMatrix *distMatrix, int dd);
 	static double simplexVolume(const std::vector<std::vector<double>> &mat);
 	static std::vector<std::vector<double>> inverseOfMatrix(std::vector<std::vector<double>> mat, int n); // Const
 	static std::vector<std::vector<double>> matrixMultiplication(const std::vector<std::vector<double>> &matA, const std::vector<std::vector<double>> &matB);
 	static std::pair<std::vector<double>, std::vector<std::vector<double>>> nullSpaceOfMatrix(const std::set<unsigned> &simplex, const std::vector<std::vector<double>> &inputdata, std::vector<double> cc, double radius, bool lowerdimension = false); // Const
 
-	static std::vector<std::vector<bool>> betaNeighbors(const std::vector<std::vector<double>> &, double beta, const std::string &betaMode);
+	static bitMatrix betaNeighbors(const std::vector<std::vector<double>> &, double beta, const std::string &betaMode);
 	static std::vector<std::vector<double>> betaCentersCalculation(const std::vector<double> &hpcoff, double beta, double circumRadius, const std::vector<double> &circumCenter);
-	static std::pair<std::vector<std::vector<double>>, std::vector<double>> calculateBetaCentersandRadius(const std::vector<unsigned> &simplex, const std::vector<std::vector<double>> &inputData, const std::vector<std::vector<double>> *distMatrix, double beta);
+	static std::pair<std::vector<std::vector<double>>, std::vector<double>> calculateBetaCentersandRadius(const std::vector<unsigned> &simplex, const std::vector<std::vector<double>> &inputData, const distanceMatrix *distMatrix, double beta);
 
 	static std::vector<double> serialize(const std::vector<std::vector<double>> &);
 	static std::vector<std::vector<double>> deserialize(const std::vector<double> &, unsigned);
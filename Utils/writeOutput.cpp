@@ -15,6 +15,7 @@
 #include <regex>
 #include <fstream>
 #include "writeOutput.hpp"
+#include "binaryHeader.hpp"
 
 /**
  * @brief Construct a new write Output::write Output object
@@ -178,12 +179,14 @@ bool writeOutput::writeCSV(const std::string &data, const std::string &filename,
 }
 
 /**
- * @brief
+ * @brief Write a map of vertex index vectors as a binary map file (see binaryHeader).
  *
+ * @tparam T Vertex index type; its width is recorded in the header
  * @param data
  * @param filename
  */
-void writeOutput::writeBinary(const std::map<std::vector<short>, short> &data, const std::string &filename)
+template <typename T>
+void writeOutput::writeBinary(const std::map<std::vector<T>, T> &data, const std::string &filename)
 {
 	if (data.empty())
 		return;
@@ -195,33 +198,31 @@ void writeOutput::writeBinary(const std::map<std::vector<short>, short> &data, c
 		return;
 	}
 
-	// Write the size of the map
-	const size_t mapSize = data.size();
-	const size_t vectorSize = data.begin()->first.size();
-
 	// Write the size of the map and vector
-	file.write(reinterpret_cast<const char *>(&mapSize), sizeof(mapSize));
-	file.write(reinterpret_cast<const char *>(&vectorSize), sizeof(vectorSize));
+	const size_t vectorSize = data.begin()->first.size();
+	binaryHeader(sizeof(T), data.size(), vectorSize).write(file);
 
 	// Iterate through the map and write each key-value pair
 	for (const auto &entry : data)
 	{
 		// Write the vector elements
-		file.write(reinterpret_cast<const char *>(entry.first.data()), vectorSize * sizeof(short));
-		// Write the short value associated with the vector
-		file.write(reinterpret_cast<const char *>(&entry.second), sizeof(short));
+		file.write(reinterpret_cast<const char *>(entry.first.data()), vectorSize * sizeof(T));
+		// Write the value associated with the vector
+		file.write(reinterpret_cast<const char *>(&entry.second), sizeof(T));
 	}
 
 	file.close();
 }
 
 /**
- * @brief 
- * 
- * @param data 
- * @param filename 
+ * @brief Write (vector, value) pairs of vertex indices as a binary map file (see binaryHeader).
+ *
+ * @tparam T Vertex index type; its width is recorded in the header
+ * @param data
+ * @param filename
  */
-void writeOutput::writeBinary(const std::vector<std::pair<std::vector<short>, short>> &data, const std::string &filename)
+template <typename T>
+void writeOutput::writeBinary(const std::vector<std::pair<std::vector<T>, T>> &data, const std::string &filename)
 {
 	if (data.empty())
 		return;
@@ -233,33 +234,31 @@ void writeOutput::writeBinary(const std::vector<std::pair<std::vector<short>, sh
 		return;
 	}
 
-	// Write the size of the map
-	const size_t mapSize = data.size();
-	const size_t vectorSize = data.begin()->first.size();
-
 	// Write the size of the map and vector
-	file.write(reinterpret_cast<const char *>(&mapSize), sizeof(mapSize));
-	file.write(reinterpret_cast<const char *>(&vectorSize), sizeof(vectorSize));
+	const size_t vectorSize = data.begin()->first.size();
+	binaryHeader(sizeof(T), data.size(), vectorSize).write(file);
 
 	// Iterate through the map and write each key-value pair
 	for (const auto &entry : data)
 	{
 		// Write the vector elements
-		file.write(reinterpret_cast<const char *>(entry.first.data()), vectorSize * sizeof(short));
-		// Write the short value associated with the vector
-		file.write(reinterpret_cast<const char *>(&entry.second), sizeof(short));
+		file.write(reinterpret_cast<const char *>(entry.first.data()), vectorSize * sizeof(T));
+		// Write the value associated with the vector
+		file.write(reinterpret_cast<const char *>(&entry.second), sizeof(T));
 	}
 
 	file.close();
 }
 
 /**
- * @brief
+ * @brief Write vectors of vertex indices as a binary vector file (see binaryHeader).
  *
+ * @tparam T Vertex index type; its width is recorded in the header
  * @param data
  * @param filename
  */
-void writeOutput::writeBinary(const std::vector<std::vector<short>> &data, const std::string &filename)
+template <typename T>
+void writeOutput::writeBinary(const std::vector<std::vector<T>> &data, const std::string &filename)
 {
 	if (data.empty())
 		return;
@@ -271,21 +270,27 @@ void writeOutput::writeBinary(const std::vector<std::vector<short>> &data, const
 		return;
 	}
 
-	// Write the size of the map
-	const size_t dim1 = data.size();
-	const size_t dim2 = data.begin()->size();
-
 	// Write the size of the map and vector
-	file.write(reinterpret_cast<const char *>(&dim1), sizeof(dim1));
-	file.write(reinterpret_cast<const char *>(&dim2), sizeof(dim2));
+	const size_t dim2 = data.begin()->size();
+	binaryHeader(sizeof(T), data.size(), dim2).write(file);
 
 	// Iterate through the map and write each key-value pair
 	for (const auto &entry : data)
-		file.write(reinterpret_cast<const char *>(entry.data()), dim2 * sizeof(short));
+		file.write(reinterpret_cast<const char *>(entry.data()), dim2 * sizeof(T));
 
 	file.close();
 }
 
+template void writeOutput::writeBinary<short>(const std::map<std::vector<short>, short> &, const std::string &);
+template void writeOutput::writeBinary<int32_t>(const std::map<std::vector<int32_t>, int32_t> &, const std::string &);
+template void writeOutput::writeBinary<int64_t>(const std::map<std::vector<int64_t>, int64_t> &, const std::string &);
+template void writeOutput::writeBinary<short>(const std::vector<std::pair<std::vector<short>, short>> &, const std::string &);
+template void writeOutput::writeBinary<int32_t>(const std::vector<std::pair<std::vector<int32_t>, int32_t>> &, const std::string &);
+template void writeOutput::writeBinary<int64_t>(const std::vector<std::pair<std::vector<int64_t>, int64_t>> &, const std::string &);
+template void writeOutput::writeBinary<short>(const std::vector<std::vector<short>> &, const std::string &);
+template void writeOutput::writeBinary<int32_t>(const std::vector<std::vector<int32_t>> &, const std::string &);
+template void writeOutput::writeBinary<int64_t>(const std::vector<std::vector<int64_t>> &, const std::string &);
+
 /**
  * @brief
  *
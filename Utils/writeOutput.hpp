@@ -14,9 +14,12 @@ public:
   static bool writeCSV(const std::string &, const std::string &, const std::string &);
   static bool writeCSV(const std::vector<std::vector<double>> &, const std::string &);
   static bool writeCSV(const std::vector<std::vector<double>> &, const std::string &, const std::string &);
-  static void writeBinary(const std::map<std::vector<short>, short> &, const std::string &);
-  static void writeBinary(const std::vector<std::pair<std::vector<short>, short>> &, const std::string &);
-  static void writeBinary(const std::vector<std::vector<short>> &, const std::string &);
+  template <typename T>
+  static void writeBinary(const std::map<std::vector<T>, T> &, const std::string &);
+  template <typename T>
+  static void writeBinary(const std::vector<std::pair<std::vector<T>, T>> &, const std::string &);
+  template <typename T>
+  static void writeBinary(const std::vector<std::vector<T>> &, const std::string &);
   static bool writeMAT(const std::vector<std::vector<double>> &, const std::string &);
   static bool writeBarcodes(const std::vector<bettiBoundaryTableEntry> &, const std::string &);
   static bool writeConsole(const std::vector<bettiBoundaryTableEntry> &);
@@ -1,6 +1,10 @@
 #include <iostream>
 #include <vector>
 #include "simplexBase.hpp"
+#include "simplexIndex.hpp"
+#include "witnessComplex.hpp"
+#include "simplexArrayList.hpp"
+#include <cmath>
 
 // TEST simplexBase Functions
 void t_simp_functions(std::string &log)
@@ -153,7 +157,9 @@ void t_simp_base_functions(std::string &log, std::string type){
 	std::set<unsigned> findValueSet = {0};
 
 	simplexBase* testComplex = simplexBase::newSimplex(type, config);
-	testComplex->setDistanceMatrix(&testValueArray);
+	distanceMatrix testDistMatrix;
+	testDistMatrix.build(testValueArray);
+	testComplex->setDistanceMatrix(&testDistMatrix);
 
 	std::cout << "Beginning simplexBase functions for " << type << std::endl;
 
@@ -326,10 +332,317 @@ void t_simp_empty_functions(std::string &log, std::string type)
 	*/
 }
 
+// TEST simplexIndex lookups and the unhashed-node guard
+void t_simplex_index(std::string &log)
+{
+	std::string failLog = "";
+	simplexIndex index;
+	std::vector<simplexKey> hashes = {7, 0, 42, 3, ((simplexKey)1 << 64) + 7, ((simplexKey)1 << 70) + 5};
+
+	//Index positions under their hashes, including keys past 2^63
+	//	RET: every hash finds its position, other keys (and the empty key) find npos
+	index.build(hashes.size(), [&](size_t i)
+				{ return hashes[i]; });
+	for (size_t i = 0; i < hashes.size(); i++)
+		if (index.find(hashes[i]) != i)
+			failLog += "simplexIndex find(hashes[" + std::to_string(i) + "]) failed\n";
+	if (index.find(5) != simplexIndex::npos || index.find(-1) != simplexIndex::npos || index.find(((simplexKey)1 << 64) + 5) != simplexIndex::npos)
+		failLog += "simplexIndex found a missing key\n";
+
+	//Index a node whose hash was never set (-1)
+	//	RET: std::invalid_argument, and the index is left empty
+	hashes.push_back(-1);
+	try
+	{
+		index.build(hashes.size(), [&](size_t i)
+					{ return hashes[i]; });
+		failLog += "simplexIndex indexed an unhashed node\n";
+	}
+	catch (const std::invalid_argument &)
+	{
+		if (index.find(7) != simplexIndex::npos)
+			failLog += "simplexIndex kept keys after a rejected build\n";
+	}
+
+	//Output log status to calling function
+	if (failLog.size() > 0)
+	{
+		log += "FAILED: simplexIndex Test Functions---------------------------\n" + failLog;
+	}
+	else
+	{
+		log += "PASSED: simplexIndex Test Functions---------------------------\n";
+	}
+	return;
+}
+
+// TEST simplexTree insert, find, cofacets and deletion on the pooled node layout
+void t_simplex_tree(std::string &log)
+{
+	std::string failLog = "";
+	std::map<std::string, std::string> config = {{"dimensions", "2"}, {"epsilon", "1.5"}};
+	auto *testComplex = simplexBase<simplexNode>::newSimplex("simplexTree", config);
+
+	// Unit square; every pair is within epsilon, so the complex is full up to triangles
+	std::vector<std::vector<double>> points = {{0.0, 0.0}, {1.0, 0.0}, {0.0, 1.0}, {1.0, 1.0}};
+	distanceMatrix testDistMatrix;
+	testDistMatrix.build(points);
+	testComplex->setDistanceMatrix(&testDistMatrix);
+	for (unsigned i = 0; i < points.size(); i++)
+		testComplex->insert();
+
+	//Insert the four points
+	//	RET: 4 vertices, 6 edges and 4 triangles
+	if (testComplex->simplexCount() != 14)
+		failLog += "simplexTree simplexCount " + std::to_string(testComplex->simplexCount()) + " after insert\n";
+	auto &edges = testComplex->getAllEdges();
+	if (edges.size() != 3 || edges[0].size() != 4 || edges[1].size() != 6 || edges[2].size() != 4)
+		failLog += "simplexTree getAllEdges has the wrong simplices per dimension\n";
+
+	//Find simplices and their weights (diameters)
+	//	RET: found simplices weigh their longest edge, missing ones -1
+	if (!testComplex->find(std::set<unsigned>{0, 1, 2}) || testComplex->find(std::set<unsigned>{0, 1, 2, 3}) || testComplex->find(std::set<unsigned>{4}))
+		failLog += "simplexTree find failed\n";
+	if (testComplex->findWeight({0, 1}) != 1.0 || std::abs(testComplex->findWeight({0, 3}) - std::sqrt(2.0)) > 1e-12 || std::abs(testComplex->findWeight({0, 1, 2}) - std::sqrt(2.0)) > 1e-12 || testComplex->findWeight({1, 4}) != -1)
+		failLog += "simplexTree findWeight failed\n";
+
+	//Get the cofacets of an edge and the facets of a triangle
+	//	RET: {0,1,2} and {0,1,3}; {0,1}, {0,2} and {1,2}
+	std::set<std::set<unsigned>> found;
+	for (auto &cofacet : testComplex->getAllCofacets(std::set<unsigned>{0, 1}, 1.0, {}, false))
+		found.insert(cofacet->simplex);
+	if (found != std::set<std::set<unsigned>>{{0, 1, 2}, {0, 1, 3}})
+		failLog += "simplexTree getAllCofacets returned " + std::to_string(found.size()) + " simplices\n";
+	found.clear();
+	for (auto &facet : testComplex->getAllFacets(std::make_shared<simplexNode>(std::set<unsigned>{0, 1, 2}, 0)))
+		found.insert(facet->simplex);
+	if (found != std::set<std::set<unsigned>>{{0, 1}, {0, 2}, {1, 2}})
+		failLog += "simplexTree getAllFacets returned " + std::to_string(found.size()) + " simplices\n";
+
+	//Delete an edge, then a vertex
+	//	RET: each simplex goes with every simplex containing it
+	if (!testComplex->deletion({1, 2}) || testComplex->simplexCount() != 11 || testComplex->find(std::set<unsigned>{1, 2, 3}) || !testComplex->find(std::set<unsigned>{0, 1, 3}))
+		failLog += "simplexTree deletion of {1,2} failed\n";
+	if (!testComplex->deletion({1}) || testComplex->simplexCount() != 7 || testComplex->find(std::set<unsigned>{0, 1}) || !testComplex->find(std::set<unsigned>{0, 2, 3}))
+		failLog += "simplexTree deletion of {1} failed\n";
+	if (testComplex->deletion({1}))
+		failLog += "simplexTree deleted a missing simplex\n";
+
+	//Insert a point after the deletions; it reuses the freed slots
+	//	RET: the point joins the remaining triangle {0,2,3} in a full 2-skeleton on 4 vertices; the deleted
+	//		simplices stay missing from the hash index though their slots now hold others
+	points.push_back({0.5, 0.5});
+	testDistMatrix.build(points);
+	testComplex->insert();
+	if (testComplex->simplexCount() != 14 || !testComplex->find(std::set<unsigned>{0, 3, 4}) || testComplex->find(std::set<unsigned>{1, 4}))
+		failLog += "simplexTree insert after deletion failed\n";
+	if (testComplex->find(std::set<unsigned>{1, 2}) || testComplex->find(std::set<unsigned>{1}) || std::abs(testComplex->findWeight({2, 4}) - std::sqrt(0.5)) > 1e-12)
+		failLog += "simplexTree lookup of a reused slot failed\n";
+	delete testComplex;
+
+	//Output log status to calling function
+	if (failLog.size() > 0)
+	{
+		log += "FAILED: simplexTree Test Functions---------------------------\n" + failLog;
+	}
+	else
+	{
+		log += "PASSED: simplexTree Test Functions---------------------------\n";
+	}
+	return;
+}
+
+// TEST witnessComplex landmark selection and lazy witness edges
+void t_witness_complex(std::string &log)
+{
+	std::string failLog = "";
+	std::map<std::string, std::string> config = {{"dimensions", "2"}, {"epsilon", "20.0"}};
+
+	// Points on a line; maxmin from x = 0 picks x = 10, then x = 4
+	//	Distances of the witnesses 0, 10, 4, 7, 2 to the landmarks (0, 10, 4): (0,10,4) (10,0,6) (4,6,0) (7,3,3) (2,8,2)
+	std::vector<std::vector<double>> points = {{0.0}, {10.0}, {4.0}, {7.0}, {2.0}};
+
+	//Weights of the landmark edges (0,10), (0,4) and (10,4): min over witnesses of max(d(a, w), d(b, w)) - m_nu(w)
+	//	RET: nu = 0 -> 6, 2, 3 (witnesses 4, 2, 7); nu = 1 -> 4, 0, 0 (m_1 = 3 at 7, 2 at 2); nu = 2 -> 2, 0, 0 (m_2 = 4 at 4)
+	std::vector<std::vector<double>> expected = {{6, 2, 3}, {4, 0, 0}, {2, 0, 0}};
+	for (unsigned nu = 0; nu < expected.size(); nu++)
+	{
+		auto *testComplex = (witnessComplex<simplexNode> *)simplexBase<simplexNode>::newSimplex("witnessComplex", config);
+		testComplex->buildWitnessComplex(points, 3, nu);
+
+		if (testComplex->landmarks != std::vector<unsigned>{0, 1, 2} || testComplex->landmarkRadius[1] != 10.0 || testComplex->landmarkRadius[2] != 4.0)
+			failLog += "witnessComplex maxmin landmarks failed\n";
+		if (testComplex->simplexCount() != 3 || testComplex->nearestLandmark[0] != 0 || testComplex->nearestLandmark[1] != 1 || testComplex->nearestLandmark[2] != 2)
+			failLog += "witnessComplex landmark vertices failed\n";
+
+		auto &graph = *testComplex->neighGraph;
+		if (graph.edgeCount() != 3 || graph.weight(0, 1) != expected[nu][0] || graph.weight(0, 2) != expected[nu][1] || graph.weight(1, 2) != expected[nu][2])
+			failLog += "witnessComplex edge weights (nu " + std::to_string(nu) + ") are " + std::to_string(graph.weight(0, 1)) + ", " + std::to_string(graph.weight(0, 2)) + ", " + std::to_string(graph.weight(1, 2)) + "\n";
+		delete testComplex;
+	}
+
+	//Limit the witnesses to landmarks within epsilon = 5
+	//	RET: no witness reaches both 0 and 10, so that edge is missing
+	config["epsilon"] = "5.0";
+	auto *testComplex = (witnessComplex<simplexNode> *)simplexBase<simplexNode>::newSimplex("witnessComplex", config);
+	testComplex->buildWitnessComplex(points, 3, 0);
+	if (testComplex->neighGraph->edgeCount() != 2 || !std::isinf(testComplex->neighGraph->weight(0, 1)) || testComplex->neighGraph->weight(1, 2) != 3)
+		failLog += "witnessComplex epsilon cutoff failed\n";
+	delete testComplex;
+
+	//Output log status to calling function
+	if (failLog.size() > 0)
+	{
+		log += "FAILED: witnessComplex Test Functions---------------------------\n" + failLog;
+	}
+	else
+	{
+		log += "PASSED: witnessComplex Test Functions---------------------------\n";
+	}
+	return;
+}
+
+// TEST simplexArrayList flat storage: records in the arena, expansion and cofacets
+void t_flat_storage(std::string &log)
+{
+	std::string failLog = "";
+	std::map<std::string, std::string> config = {{"dimensions", "3"}, {"epsilon", "1.5"}};
+	auto *nodes = (simplexArrayList<simplexNode> *)simplexBase<simplexNode>::newSimplex("simplexArrayList", config);
+	auto *flat = (simplexArrayList<simplexNode> *)simplexBase<simplexNode>::newSimplex("simplexArrayList", config);
+	typedef simplexArrayList<simplexNode>::flatRecord<4> flatRecord;
+
+	// Unit square and its center; every pair is within epsilon, so the complex is full up to tetrahedra
+	std::vector<std::vector<double>> points = {{0.0, 0.0}, {1.0, 0.0}, {0.0, 1.0}, {1.0, 1.0}, {0.5, 0.5}};
+	distanceMatrix testDistMatrix;
+	testDistMatrix.build(points);
+	for (auto *complex : {nodes, flat})
+	{
+		complex->setDistanceMatrix(&testDistMatrix);
+		for (unsigned i = 0; i < points.size(); i++)
+			complex->insert();
+	}
+	nodes->expandDimensions(3);
+	flat->expandDimensions(1);
+
+	//Flatten the edges and expand the triangles and tetrahedra in the arena
+	//	RET: the weights, hashes and vertices of the node complex in each dimension
+	const auto &edges = flat->getDimEdges(1);
+	std::vector<simplexArrayList<simplexNode>::flatDimension<4>> simplices = {{}, flat->flatten<4>({edges.begin(), edges.end()})};
+	for (unsigned d = 2; d <= 3; d++)
+		simplices.push_back(flat->expandFlat(simplices[d - 1], d));
+	for (unsigned d = 1; d <= 3; d++)
+	{
+		std::set<std::tuple<double, simplexKey, std::set<unsigned>>> expected, found;
+		for (auto &simplex : nodes->getDimEdges(d))
+			expected.insert({simplex->weight, simplex->hash, simplex->simplex});
+		for (auto &simplex : simplices[d])
+			found.insert({simplex.weight, simplex.hash, std::set<unsigned>(simplex.vertices.begin(), simplex.vertices.begin() + d + 1)});
+		if (found != expected)
+			failLog += "flat storage dimension " + std::to_string(d) + " has " + std::to_string(found.size()) + " simplices, expected " + std::to_string(expected.size()) + "\n";
+	}
+
+	//Look up the cofacets of the edge {0,1} in the indexed triangles, then build them in a scratch arena
+	//	RET: {0,1,2}, {0,1,3} and {0,1,4} both ways, with the weights of the stored triangles
+	flat->prepareFlat(simplices[1]);
+	flatRecord *edge = flat->findFlat<4>(flat->simplexHash({0, 1}));
+	flat->prepareFlat(simplices[2]);
+	std::vector<flatRecord *> looked, built;
+	std::pmr::monotonic_buffer_resource scratch;
+	if (edge == nullptr)
+		failLog += "flat storage findFlat missed the edge {0,1}\n";
+	else
+	{
+		flat->getAllCofacets(*edge, 1, std::unordered_map<flatRecord *, flatRecord *>(), false, looked);
+		flat->getAllCofacets(*edge, 1, std::unordered_map<simplexKey, flatRecord *, indexHash>(), false, scratch, built);
+	}
+	std::set<std::pair<double, std::set<unsigned>>> expected = {{std::sqrt(2.0), {0, 1, 2}}, {std::sqrt(2.0), {0, 1, 3}}, {1.0, {0, 1, 4}}};
+	for (auto *cofacets : {&looked, &built})
+	{
+		std::set<std::pair<double, std::set<unsigned>>> found;
+		for (auto *cofacet : *cofacets)
+			if (cofacet->hash == flat->simplexHash({cofacet->vertices.begin(), cofacet->vertices.begin() + 3}))
+				found.insert({cofacet->weight, {cofacet->vertices.begin(), cofacet->vertices.begin() + 3}});
+		if (found != expected)
+			failLog += std::string("flat storage ") + (cofacets == &looked ? "indexed" : "built") + " cofacets of {0,1} failed\n";
+	}
+
+	//Look up the facets of the triangle {0,1,4} in the indexed edges, then build them in the scratch arena
+	//	RET: {1,4}, {0,4} and {0,1} both ways, with the weights of the stored edges
+	flatRecord *triangle = flat->findFlat<4>(flat->simplexHash({0, 1, 4}));
+	flat->prepareFlat(simplices[1]);
+	looked.clear();
+	built.clear();
+	if (triangle == nullptr)
+		failLog += "flat storage findFlat missed the triangle {0,1,4}\n";
+	else
+	{
+		flat->getAllFacets(*triangle, 2, looked);
+		flat->getAllFacets(*triangle, 2, scratch, built);
+	}
+	expected = {{std::sqrt(0.5), {1, 4}}, {std::sqrt(0.5), {0, 4}}, {1.0, {0, 1}}};
+	for (auto *facets : {&looked, &built})
+	{
+		std::set<std::pair<double, std::set<unsigned>>> found;
+		for (auto *facet : *facets)
+			if (facet->hash == flat->simplexHash({facet->vertices.begin(), facet->vertices.begin() + 2}))
+				found.insert({facet->weight, {facet->vertices.begin(), facet->vertices.begin() + 2}});
+		if (found != expected)
+			failLog += std::string("flat storage ") + (facets == &looked ? "indexed" : "built") + " facets of {0,1,4} failed\n";
+	}
+
+	delete nodes;
+	delete flat;
+
+	//Output log status to calling function
+	if (failLog.size() > 0)
+	{
+		log += "FAILED: flat storage Test Functions---------------------------\n" + failLog;
+	}
+	else
+	{
+		log += "PASSED: flat storage Test Functions---------------------------\n";
+	}
+	return;
+}
+
+// TEST simplex key width: wideKeys agrees with the binomial table of the complex
+void t_key_width(std::string &log)
+{
+	std::string failLog = "";
+
+	//Pick the key width for a few point counts and dimensions on either side of 63 bits
+	//	RET: wide exactly when binomialTable(n, dimensions + 1) falls back to __int128
+	for (auto [n, dim] : std::vector<std::pair<unsigned, unsigned>>{{100, 3}, {100000, 3}, {200000, 3}, {64, 40}, {68, 40}})
+	{
+		if (wideKeys(n, dim) != binomialTable(n, dim + 1).isWide())
+			failLog += "wideKeys(" + std::to_string(n) + ", " + std::to_string(dim) + ") disagrees with binomialTable\n";
+	}
+	if (wideKeys(100000, 3) || !wideKeys(200000, 3))
+		failLog += "wideKeys picked the wrong width around C(n, 4) = 2^63\n";
+	if (sizeof(simplexNode) >= sizeof(wideSimplexNode))
+		failLog += "simplexNode is not smaller than wideSimplexNode\n";
+
+	//Output log status to calling function
+	if (failLog.size() > 0)
+	{
+		log += "FAILED: key width Test Functions---------------------------\n" + failLog;
+	}
+	else
+	{
+		log += "PASSED: key width Test Functions---------------------------\n";
+	}
+	return;
+}
+
 int main(int, char **)
 {
 	std::string log;
 	t_simp_functions(log);
+	t_simplex_index(log);
+	t_simplex_tree(log);
+	t_witness_complex(log);
+	t_flat_storage(log);
+	t_key_width(log);
 
 	for (std::string type : {"simplexArrayList", "simplexTree"})
 	{
@@ -348,4 +661,5 @@ int main(int, char **)
 
 	std::cout << std::endl
 			  << log << std::endl;
+	return log.find("FAILED") == std::string::npos ? 0 : 1;
 }
@@ -1,7 +1,17 @@
 #include <iostream>
 #include <vector>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <mpi.h>
+#include <omp.h>
 #include "basePipe.hpp"
 #include "pipePacket.hpp"
+#include "helixPipe.hpp"
+#include "sparseRipsComplex.hpp"
 
 // TEST basePipe Functions
 void t_pipe_functions(std::string &log)
@@ -69,10 +79,588 @@ void t_pipe_empty_functions(std::string &log, std::string type, std::string comp
 	return;
 }
 
-int main(int, char **)
+// TEST alphaComplex through incrementalPersistence
+//	The pipe reads the 0-simplices of the complex before it builds the binomial table
+void t_alpha_incremental_persistence(std::string &log, std::string dimensions)
 {
+	std::string failLog = "";
+	std::map<std::string, std::string> config = {{"epsilon", "5.0"}, {"dimensions", dimensions}, {"complexType", "alphaComplex"}};
+	pipePacket<alphaNode> pack(config, "alphaComplex");
+
+	// Unit square with its center, triangulated around the center
+	pack.inputData = {{0.0, 0.0}, {1.0, 0.0}, {0.0, 1.0}, {1.0, 1.0}, {0.5, 0.5}};
+	pack.workData = pack.inputData;
+	pack.distMatrix.build(pack.inputData);
+	pack.complex->setDistanceMatrix(&pack.distMatrix);
+	pack.complex->dsimplexmesh = {{0, 1, 4}, {0, 2, 4}, {1, 3, 4}, {2, 3, 4}};
+
+	basePipe<alphaNode> *testPipe = basePipe<alphaNode>::newPipe("incrementalPersistence", "alphaComplex");
+	if (testPipe == nullptr || !testPipe->configPipe(config))
+		failLog += "incrementalPersistence config failed\n";
+	else
+	{
+		testPipe->runPipe(pack);
+
+		//Every corner joins the center at half the diagonal; one component stays open
+		//	RET: 4 finite and 1 open dim 0 intervals
+		unsigned finite = 0, open = 0;
+		for (auto &entry : pack.bettiTable)
+		{
+			if (entry.bettiDim != 0)
+				failLog += "alphaComplex has a dim " + std::to_string(entry.bettiDim) + " interval\n";
+			else if (entry.death == 5.0)
+				open++;
+			else if (std::abs(entry.death - std::sqrt(0.5)) < 1e-9)
+				finite++;
+			else
+				failLog += "alphaComplex dim 0 interval has death " + std::to_string(entry.death) + "\n";
+		}
+		if (finite != 4 || open != 1)
+			failLog += "alphaComplex dim 0 intervals: " + std::to_string(finite) + " finite, " + std::to_string(open) + " open\n";
+	}
+	delete testPipe;
+
+	//Output log status to calling function
+	if (failLog.size() > 0)
+	{
+		log += "FAILED: alphaComplex incrementalPersistence (dimensions " + dimensions + ") Test Functions---------------------------\n" + failLog;
+	}
+	else
+	{
+		log += "PASSED: alphaComplex incrementalPersistence (dimensions " + dimensions + ") Test Functions---------------------------\n";
+	}
+	return;
+}
+
+// Run a '.' separated pipeline on a point cloud
+//	RET: the intervals of positive length, sorted by (dim, birth, death); empty if a pipe failed to configure
+std::vector<std::tuple<unsigned, double, double>> t_barcode(std::map<std::string, std::string> config, const std::vector<std::vector<double>> &points)
+{
+	pipePacket<simplexNode> pack(config, config["complexType"]);
+	pack.inputData = points;
+	pack.workData = points;
+
+	std::string pipeline = config["pipeline"];
+	size_t start = 0;
+	while (start <= pipeline.size())
+	{
+		size_t end = std::min(pipeline.find('.', start), pipeline.size());
+		basePipe<simplexNode> *pipe = basePipe<simplexNode>::newPipe(pipeline.substr(start, end - start), config["complexType"]);
+		if (pipe == nullptr || !pipe->configPipe(config))
+		{
+			delete pipe;
+			return {};
+		}
+		pipe->runPipe(pack);
+		delete pipe;
+		start = end + 1;
+	}
+
+	std::vector<std::tuple<unsigned, double, double>> ret;
+	for (auto &entry : pack.bettiTable)
+		if (entry.death > entry.birth)
+			ret.emplace_back(entry.bettiDim, entry.birth, entry.death);
+	std::sort(ret.begin(), ret.end());
+	return ret;
+}
+
+// Two barcodes with the same intervals, up to rounding of the filtration values
+bool t_same_barcode(const std::vector<std::tuple<unsigned, double, double>> &a, const std::vector<std::tuple<unsigned, double, double>> &b)
+{
+	if (a.size() != b.size())
+		return false;
+	for (size_t i = 0; i < a.size(); i++)
+		if (std::get<0>(a[i]) != std::get<0>(b[i]) || std::abs(std::get<1>(a[i]) - std::get<1>(b[i])) > 1e-9 || std::abs(std::get<2>(a[i]) - std::get<2>(b[i])) > 1e-9)
+			return false;
+	return true;
+}
+
+// Noisy circle of n points with a few points inside it; the same cloud for every run
+std::vector<std::vector<double>> t_circle_cloud(unsigned n)
+{
+	std::vector<std::vector<double>> points;
+	for (unsigned i = 0; i < n; i++)
+	{
+		double angle = 2 * M_PI * i / n, r = 1.0 + 0.1 * std::sin(7.0 * i);
+		points.push_back({r * std::cos(angle), r * std::sin(angle)});
+	}
+	points.push_back({0.1, 0.2});
+	points.push_back({-0.3, 0.05});
+	points.push_back({0.25, -0.35});
+	return points;
+}
+
+// TEST ripsPipe edge collapse
+//	Collapsing dominated edges of the 1-skeleton keeps the persistence diagram
+void t_rips_collapse(std::string &log)
+{
+	std::string failLog = "";
+	std::map<std::string, std::string> config = {{"epsilon", "3.0"}, {"dimensions", "2"}, {"complexType", "simplexArrayList"}, {"pipeline", "distMatrix.neighGraph.rips.fastPersistence"}};
+	auto points = t_circle_cloud(16);
+
+	auto full = t_barcode(config, points);
+	config["collapse"] = "true";
+	auto collapsed = t_barcode(config, points);
+
+	//Compute persistence with and without the collapse
+	//	RET: identical barcodes with the circle as a dim 1 interval
+	if (full.empty())
+		failLog += "ripsPipe produced no intervals\n";
+	else if (!t_same_barcode(full, collapsed))
+		failLog += "ripsPipe collapse changed the barcode: " + std::to_string(full.size()) + " intervals without, " + std::to_string(collapsed.size()) + " with\n";
+	else if (std::none_of(full.begin(), full.end(), [](auto &i)
+						  { return std::get<0>(i) == 1; }))
+		failLog += "ripsPipe barcode has no dim 1 interval\n";
+
+	//Output log status to calling function
+	if (failLog.size() > 0)
+	{
+		log += "FAILED: ripsPipe collapse Test Functions---------------------------\n" + failLog;
+	}
+	else
+	{
+		log += "PASSED: ripsPipe collapse Test Functions---------------------------\n";
+	}
+	return;
+}
+
+// TEST flat storage of the Rips complexes
+//	The simplices above the edges as arrays of flatSimplex records in the arena of the complex give the barcode of the shared nodes
+void t_flat_storage(std::string &log)
+{
+	std::string failLog = "";
+	auto points = t_circle_cloud(24);
+
+	for (std::string pipeline : {"distMatrix.neighGraph.rips.fastPersistence", "sparseNeighGraph.rips.fastPersistence", "distMatrix.neighGraph.incrementalPersistence", "sparseNeighGraph.incrementalPersistence"})
+	{
+		for (std::string dimensions : {"2", "3", "4"})
+		{
+			std::map<std::string, std::string> config = {{"epsilon", "1.2"}, {"dimensions", dimensions}, {"complexType", "simplexArrayList"}, {"pipeline", pipeline}};
+			auto nodes = t_barcode(config, points);
+			config["storage"] = "flat";
+			auto flat = t_barcode(config, points);
+
+			//Compute persistence up to dim (dimensions - 1) with both storages, each dimension count on its own record size
+			//	RET: identical barcodes with the circle as a dim 1 interval
+			if (nodes.empty())
+				failLog += pipeline + " produced no intervals\n";
+			else if (!t_same_barcode(nodes, flat))
+				failLog += pipeline + " flat storage changed the barcode at dimensions " + dimensions + ": " + std::to_string(nodes.size()) + " intervals with nodes, " + std::to_string(flat.size()) + " flat\n";
+			else if (std::none_of(flat.begin(), flat.end(), [](auto &i)
+								  { return std::get<0>(i) == 1; }))
+				failLog += pipeline + " flat barcode has no dim 1 interval\n";
+
+			//Recover the representative cycles from the flat cocycles
+			//	RET: the intervals of the cohomology barcode
+			if (dimensions != "3")
+				continue;
+			config["involuted"] = "true";
+			auto involuted = t_barcode(config, points);
+			if (!t_same_barcode(nodes, involuted))
+				failLog += pipeline + " involuted flat storage changed the barcode: " + std::to_string(nodes.size()) + " intervals with nodes, " + std::to_string(involuted.size()) + " involuted flat\n";
+		}
+	}
+
+	//Configure flat storage outside the dimensions it has records for, and an unknown storage
+	//	RET: configPipe fails
+	for (auto [storage, dimensions] : {std::pair<std::string, std::string>{"flat", std::to_string(flatMaxDimensions + 1)}, {"flat", "0"}, {"tree", "2"}})
+	{
+		std::map<std::string, std::string> config = {{"epsilon", "1.2"}, {"dimensions", dimensions}, {"complexType", "simplexArrayList"}, {"storage", storage}};
+		for (std::string type : {"fastPersistence", "incrementalPersistence"})
+		{
+			basePipe<simplexNode> *pipe = basePipe<simplexNode>::newPipe(type, "simplexArrayList");
+			if (pipe->configPipe(config))
+				failLog += type + " accepted storage " + storage + " with dimensions " + dimensions + "\n";
+			delete pipe;
+		}
+	}
+
+	//Output log status to calling function
+	if (failLog.size() > 0)
+	{
+		log += "FAILED: flat storage Test Functions---------------------------\n" + failLog;
+	}
+	else
+	{
+		log += "PASSED: flat storage Test Functions---------------------------\n";
+	}
+	return;
+}
+
+// Multiplicative bottleneck distance between two barcodes: the smallest factor t such that the intervals can be matched
+//	with births and deaths within a factor t of each other, every unmatched interval [b, d) having d <= t^2 b
+double t_bottleneck_factor(const std::vector<std::tuple<unsigned, double, double>> &a, const std::vector<std::tuple<unsigned, double, double>> &b)
+{
+	auto ratio = [](double x, double y)
+	{ return x == y ? 1.0 : std::min(x, y) <= 0 ? INFINITY : std::max(x, y) / std::min(x, y); };
+	auto toDiagonal = [](const std::tuple<unsigned, double, double> &i)
+	{ return std::get<1>(i) <= 0 ? INFINITY : std::sqrt(std::get<2>(i) / std::get<1>(i)); };
+
+	// Intervals of a and b on the left, their diagonal copies after them on the right (and the other way round)
+	size_t n = a.size() + b.size();
+	std::vector<std::vector<double>> cost(n, std::vector<double>(n, INFINITY));
+	for (size_t i = 0; i < a.size(); i++)
+	{
+		for (size_t j = 0; j < b.size(); j++)
+			if (std::get<0>(a[i]) == std::get<0>(b[j]))
+				cost[i][j] = std::max(ratio(std::get<1>(a[i]), std::get<1>(b[j])), ratio(std::get<2>(a[i]), std::get<2>(b[j])));
+		cost[i][b.size() + i] = toDiagonal(a[i]);
+	}
+	for (size_t j = 0; j < b.size(); j++)
+	{
+		cost[a.size() + j][j] = toDiagonal(b[j]);
+		for (size_t i = 0; i < a.size(); i++)
+			cost[a.size() + j][b.size() + i] = 1.0;
+	}
+
+	// Smallest candidate factor that admits a perfect matching (augmenting paths)
+	std::vector<double> candidates;
+	for (auto &row : cost)
+		candidates.insert(candidates.end(), row.begin(), row.end());
+	std::sort(candidates.begin(), candidates.end());
+	for (double t : candidates)
+	{
+		std::vector<size_t> match(n, n);
+		std::vector<bool> seen;
+		std::function<bool(size_t)> augment = [&](size_t i)
+		{
+			for (size_t j = 0; j < n; j++)
+				if (cost[i][j] <= t && !seen[j])
+				{
+					seen[j] = true;
+					if (match[j] == n || augment(match[j]))
+					{
+						match[j] = i;
+						return true;
+					}
+				}
+			return false;
+		};
+		size_t matched = 0;
+		for (size_t i = 0; i < n; i++)
+		{
+			seen.assign(n, false);
+			matched += augment(i);
+		}
+		if (matched == n)
+			return t;
+	}
+	return INFINITY;
+}
+
+// TEST sparseRips filtration
+//	The sparse filtration only grows the Rips weights, by at most a factor 1 / (1 - sparsity)
+void t_sparse_rips(std::string &log)
+{
+	std::string failLog = "";
+	std::map<std::string, std::string> config = {{"epsilon", "3.0"}, {"dimensions", "2"}, {"complexType", "simplexArrayList"}, {"pipeline", "distMatrix.neighGraph.rips.fastPersistence"}};
+	auto points = t_circle_cloud(64);
+	auto rips = t_barcode(config, points);
+
+	config["complexType"] = "sparseRips";
+	config["pipeline"] = "sparseRips.rips.fastPersistence";
+
+	//Build the sparse filtration with a sparsity small enough that no point is relaxed
+	//	RET: the Rips barcode
+	config["sparsity"] = "0.000001";
+	auto sparse = t_barcode(config, points);
+	if (rips.empty())
+		failLog += "ripsPipe produced no intervals\n";
+	else if (!t_same_barcode(rips, sparse))
+		failLog += "sparseRips (sparsity 1e-6) changed the barcode: " + std::to_string(rips.size()) + " Rips intervals, " + std::to_string(sparse.size()) + " sparse\n";
+
+	//Build coarser sparse filtrations
+	//	RET: a barcode within a bottleneck factor 1 / (1 - sparsity) of the Rips barcode
+	for (double sparsity : {0.1, 0.3, 0.5})
+	{
+		config["sparsity"] = std::to_string(sparsity);
+		sparse = t_barcode(config, points);
+		double factor = t_bottleneck_factor(rips, sparse);
+		if (sparse.empty() || factor > 1 / (1 - sparsity) + 1e-9)
+			failLog += "sparseRips (sparsity " + config["sparsity"] + ") bottleneck factor " + std::to_string(factor) + " exceeds " + std::to_string(1 / (1 - sparsity)) + "\n";
+	}
+
+	//Build the sparse filtration of a non-uniform cloud (a dense cluster between sparse points) with node storage
+	//	RET: the flag complex of the sparse graph has a triangle heavier than the death of one of its vertices,
+	//		but no stored simplex outlives a vertex (weight / 2 <= insertionRadius / (sparsity (1 - sparsity)))
+	config["sparsity"] = "0.5";
+	config["epsilon"] = "20.0";
+	config["pipeline"] = "sparseRips.rips";
+	std::mt19937 gen(11);
+	std::uniform_real_distribution<double> jitter(-0.5, 0.5);
+	points = {{0.0, 0.0}, {11.0, 0.0}, {5.5, 9.0}, {5.5, -9.0}};
+	for (unsigned i = 0; i < 24; i++)
+		points.push_back({5.5 + jitter(gen), jitter(gen)});
+
+	pipePacket<simplexNode> pack(config, config["complexType"]);
+	pack.inputData = points;
+	pack.workData = points;
+	for (std::string type : {"sparseRips", "rips"})
+	{
+		basePipe<simplexNode> *pipe = basePipe<simplexNode>::newPipe(type, "sparseRips");
+		if (pipe->configPipe(config))
+			pipe->runPipe(pack);
+		else
+			failLog += type + " config failed for the non-uniform cloud\n";
+		delete pipe;
+	}
+
+	auto complex = (sparseRipsComplex<simplexNode> *)pack.complex;
+	auto death = [&](const std::set<unsigned> &simplex)
+	{
+		double ret = std::numeric_limits<double>::infinity();
+		for (unsigned v : simplex)
+			ret = std::min(ret, complex->insertionRadius[v] / (complex->sparsity * (1 - complex->sparsity)));
+		return ret;
+	};
+
+	unsigned dying = 0;
+	const neighborGraph &graph = *complex->neighGraph;
+	for (unsigned u = 0; u < points.size(); u++)
+		for (unsigned v = u + 1; v < points.size(); v++)
+			for (unsigned w = v + 1; w < points.size(); w++)
+			{
+				double weight = std::max({graph.weight(u, v), graph.weight(u, w), graph.weight(v, w)});
+				if (weight <= 20.0 && weight / 2 > death({u, v, w}))
+					dying++;
+			}
+	if (dying == 0)
+		failLog += "sparseRips non-uniform cloud has no triangle outliving its vertices in the flag complex\n";
+
+	for (size_t d = 1; d < complex->simplexList.size(); d++)
+		for (auto &simp : complex->simplexList[d])
+		{
+			if (simp->weight / 2 > death(simp->simplex) * (1 + 1e-12))
+				failLog += "sparseRips stored a " + std::to_string(d) + "-simplex of weight " + std::to_string(simp->weight) + " past the death " + std::to_string(death(simp->simplex)) + " of a vertex\n";
+		}
+	if (complex->simplexList.size() < 3 || complex->simplexList[2].size() == 0)
+		failLog += "sparseRips non-uniform cloud built no triangles\n";
+
+	//Compute the barcode of the non-uniform cloud with node, implicit and flat storage
+	//	RET: the same intervals
+	config["pipeline"] = "sparseRips.rips.fastPersistence";
+	auto nodes = t_barcode(config, points);
+	config["implicit"] = "true";
+	auto implicit = t_barcode(config, points);
+	config.erase("implicit");
+	config["storage"] = "flat";
+	auto flat = t_barcode(config, points);
+	config.erase("storage");
+	if (nodes.empty() || !t_same_barcode(nodes, implicit) || !t_same_barcode(nodes, flat))
+		failLog += "sparseRips non-uniform cloud barcodes differ: " + std::to_string(nodes.size()) + " nodes, " + std::to_string(implicit.size()) + " implicit, " + std::to_string(flat.size()) + " flat intervals\n";
+
+	//Configure the pipe with a sparsity outside (0,1) or for another complex type
+	//	RET: configPipe fails
+	for (std::string sparsity : {"0", "1", "-0.5", "abc"})
+	{
+		config["sparsity"] = sparsity;
+		auto *pipe = basePipe<simplexNode>::newPipe("sparseRips", "sparseRips");
+		if (pipe->configPipe(config))
+			failLog += "sparseRipsPipe accepted sparsity " + sparsity + "\n";
+		delete pipe;
+	}
+	config["sparsity"] = "0.5";
+	config["complexType"] = "simplexArrayList";
+	auto *pipe = basePipe<simplexNode>::newPipe("sparseRips", "simplexArrayList");
+	if (pipe->configPipe(config))
+		failLog += "sparseRipsPipe accepted complexType=simplexArrayList\n";
+	delete pipe;
+
+	//Output log status to calling function
+	if (failLog.size() > 0)
+	{
+		log += "FAILED: sparseRips Test Functions---------------------------\n" + failLog;
+	}
+	else
+	{
+		log += "PASSED: sparseRips Test Functions---------------------------\n";
+	}
+	return;
+}
+
+// Delaunay cells of a helixDistPipe run with the given exchange; every process runs it, rank 0 holds the cells
+std::vector<std::vector<unsigned>> t_helix_dist_mesh(const std::vector<std::vector<double>> &points, std::string exchange)
+{
+	std::map<std::string, std::string> config = {{"epsilon", "5.0"}, {"dimensions", "2"}, {"complexType", "alphaComplex"}, {"exchange", exchange}};
+	pipePacket<alphaNode> pack(config, "alphaComplex");
+	pack.inputData = points;
+	pack.workData = points;
+
+	basePipe<alphaNode> *testPipe = basePipe<alphaNode>::newPipe("helixDistPipe", "alphaComplex");
+	if (testPipe == nullptr || !testPipe->configPipe(config))
+	{
+		delete testPipe;
+		return {};
+	}
+	testPipe->runPipe(pack);
+	delete testPipe;
+
+	auto mesh = pack.complex->dsimplexmesh;
+	for (auto &cell : mesh)
+		std::sort(cell.begin(), cell.end());
+	std::sort(mesh.begin(), mesh.end());
+	return mesh;
+}
+
+// TEST witnessPipe configuration and filtration
+void t_witness_pipe(std::string &log)
+{
+	std::string failLog = "";
+	std::map<std::string, std::string> config = {{"epsilon", "3.0"}, {"dimensions", "2"}, {"landmarks", "32"}, {"nu", "0"}, {"complexType", "witnessComplex"}, {"pipeline", "witness.rips.fastPersistence"}};
+	auto points = t_circle_cloud(64);
+
+	//Build the witness filtration of a circle
+	//	RET: a barcode with a dim 1 interval
+	auto witness = t_barcode(config, points);
+	if (std::none_of(witness.begin(), witness.end(), [](const std::tuple<unsigned, double, double> &i)
+					 { return std::get<0>(i) == 1; }))
+		failLog += "witnessPipe found no dim 1 interval on a circle\n";
+
+	//Configure the pipe for another complex type
+	//	RET: configPipe fails
+	config["complexType"] = "simplexArrayList";
+	auto *pipe = basePipe<simplexNode>::newPipe("witness", "simplexArrayList");
+	if (pipe->configPipe(config))
+		failLog += "witnessPipe accepted complexType=simplexArrayList\n";
+	delete pipe;
+
+	//Output log status to calling function
+	if (failLog.size() > 0)
+	{
+		log += "FAILED: witnessPipe Test Functions---------------------------\n" + failLog;
+	}
+	else
+	{
+		log += "PASSED: witnessPipe Test Functions---------------------------\n";
+	}
+	return;
+}
+
+// TEST helixDistPipe shell exchange
+//	Run under mpirun; the in-memory all-to-all exchange gives the triangulation of the rank 0 file merge
+void t_helix_dist_exchange(std::string &log)
+{
+	std::string failLog = "";
+	std::mt19937 gen(7);
+	std::uniform_real_distribution<double> coord(0.0, 1.0);
+	std::vector<std::vector<double>> points(300, std::vector<double>(2));
+	for (auto &p : points)
+		for (auto &x : p)
+			x = coord(gen);
+
+	int rank = 0, processes = 1;
+	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+	MPI_Comm_size(MPI_COMM_WORLD, &processes);
+
+	//Triangulate with both exchanges
+	//	RET: identical cells on rank 0, a planar triangulation (at most 2n - 5 triangles)
+	auto fileMesh = t_helix_dist_mesh(points, "file");
+	auto alltoallMesh = t_helix_dist_mesh(points, "alltoall");
+	if (rank == 0)
+	{
+		if (fileMesh.empty() || fileMesh.size() > 2 * points.size() - 5)
+			failLog += "helixDistPipe (file) produced " + std::to_string(fileMesh.size()) + " cells\n";
+		else if (fileMesh != alltoallMesh)
+			failLog += "helixDistPipe exchanges differ: " + std::to_string(fileMesh.size()) + " cells (file), " + std::to_string(alltoallMesh.size()) + " (alltoall)\n";
+	}
+
+	//Output log status to calling function
+	if (failLog.size() > 0)
+	{
+		log += "FAILED: helixDistPipe exchange (" + std::to_string(processes) + " processes) Test Functions---------------------------\n" + failLog;
+	}
+	else
+	{
+		log += "PASSED: helixDistPipe exchange (" + std::to_string(processes) + " processes) Test Functions---------------------------\n";
+	}
+	return;
+}
+
+// helixPipe keeps its triangulation protected; expose it to the frontier test
+class t_helix_mesh_pipe : public helixPipe<alphaNode>
+{
+public:
+	auto mesh() const { return this->dsimplexmesh; }
+};
+
+// Triangulate a point cloud with helixPipe, expanding the d-1 shell with the given frontier
+auto t_helix_mesh(const std::vector<std::vector<double>> &points, std::string frontier)
+{
+	std::map<std::string, std::string> config = {{"epsilon", "5.0"}, {"dimensions", std::to_string(points[0].size())}, {"complexType", "alphaComplex"}, {"frontier", frontier}};
+	pipePacket<alphaNode> pack(config, "alphaComplex");
+	pack.inputData = points;
+	pack.workData = points;
+	pack.distMatrix.build(points);
+
+	t_helix_mesh_pipe pipe;
+	pipe.configPipe(config);
+	pipe.runPipe(pack);
+
+	auto mesh = pipe.mesh();
+	for (auto &cell : mesh)
+		std::sort(cell.begin(), cell.end());
+	std::sort(mesh.begin(), mesh.end());
+	return mesh;
+}
+
+// TEST helixPipe task frontier
+//	Runs on at least 4 OpenMP threads; the parallel frontier must give the mesh of the serial shell walk
+void t_helix_frontier(std::string &log)
+{
+	std::string failLog = "";
+	int threads = omp_get_max_threads();
+	if (threads < 2)
+		omp_set_num_threads(4);
+
+	std::mt19937 gen(11);
+	std::uniform_real_distribution<double> coord(0.0, 1.0);
+	for (auto [dim, n] : {std::pair<unsigned, unsigned>{2, 80}, {3, 50}, {4, 30}})
+	{
+		std::vector<std::vector<double>> points(n, std::vector<double>(dim));
+		for (auto &p : points)
+			for (auto &x : p)
+				x = coord(gen);
+
+		//Triangulate with the serial walk and the task frontier
+		//	RET: identical cells
+		auto serial = t_helix_mesh(points, "serial");
+		auto parallel = t_helix_mesh(points, "parallel");
+		if (serial.empty())
+			failLog += "helixPipe (serial) produced no cells in " + std::to_string(dim) + "D\n";
+		else if (serial != parallel)
+			failLog += "helixPipe frontiers differ in " + std::to_string(dim) + "D: " + std::to_string(serial.size()) + " cells (serial), " + std::to_string(parallel.size()) + " (parallel)\n";
+	}
+	int used = omp_get_max_threads();
+	omp_set_num_threads(threads);
+
+	//Output log status to calling function
+	if (failLog.size() > 0)
+	{
+		log += "FAILED: helixPipe frontier (" + std::to_string(used) + " threads) Test Functions---------------------------\n" + failLog;
+	}
+	else
+	{
+		log += "PASSED: helixPipe frontier (" + std::to_string(used) + " threads) Test Functions---------------------------\n";
+	}
+	return;
+}
+
+int main(int argc, char **argv)
+{
+	MPI_Init(&argc, &argv);
+	int rank = 0;
+	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
 	std::string log;
 	t_pipe_functions(log);
+	for (std::string dimensions : {"1", "2"})
+		t_alpha_incremental_persistence(log, dimensions);
+	t_rips_collapse(log);
+	t_flat_storage(log);
+	t_sparse_rips(log);
+	t_witness_pipe(log);
+	t_helix_dist_exchange(log);
+	t_helix_frontier(log);
 
 	for (std::string type : {"distMatrix", "neighGraph", "upscale", "persistence", "slidingwindow", "fastPersistence"})
 	{
@@ -86,7 +674,12 @@ int main(int, char **)
 		}
 	}
 
+	MPI_Finalize();
+	if (rank != 0)
+		return 0;
+
 	std::cout << std::endl
 			  << std::endl
 			  << log << std::endl;
+	return log.find("FAILED") == std::string::npos ? 0 : 1;
 }
@@ -1,8 +1,11 @@
 #include <iostream>
 #include <stdio.h>
 #include <vector>
+#include <fstream>
+#include <stdexcept>
 #include "writeOutput.hpp"
 #include "readInput.hpp"
+#include "multifileops.hpp"
 #include "utils.hpp"
 
 // TEST write Functions
@@ -154,12 +157,97 @@ void t_write_mat_functions(std::string &log)
 	return;
 }
 
+// TEST binary vector and map files (LHFB header)
+void t_write_binary_functions(std::string &log)
+{
+	std::string failLog = "";
+	std::vector<std::vector<int32_t>> testVectors{{0, 1, 2}, {1, 2, 70000}, {3, 4, 5}};
+	std::map<std::vector<int64_t>, int64_t> testMap{{{0, 1}, 2}, {{1, 3}, 4}, {{5000000000, 6}, 7}, {{8, 9}, 10}};
+
+	// Write a vector file, read it back in its own and in a wider index type
+	//  RET: the written vectors; a narrower reader rejects 70000
+	writeOutput::writeBinary(testVectors, "testBinaryVector.bin");
+	std::ifstream file("testBinaryVector.bin", std::ios::binary);
+	char magic[4] = {};
+	file.read(magic, 4);
+	file.close();
+	if (std::string(magic, 4) != "LHFB")
+		failLog += "writeOutput writeBinary wrote no LHFB header\n";
+	if (readInput::readBinaryVector<int32_t>("testBinaryVector.bin") != testVectors)
+		failLog += "readInput readBinaryVector<int32_t> read error occurred\n";
+	if (readInput::readBinaryVector<int64_t>("testBinaryVector.bin") != std::vector<std::vector<int64_t>>{{0, 1, 2}, {1, 2, 70000}, {3, 4, 5}})
+		failLog += "readInput readBinaryVector<int64_t> read error occurred\n";
+	try
+	{
+		readInput::readBinaryVector<short>("testBinaryVector.bin");
+		failLog += "readInput readBinaryVector<short> accepted an index it cannot hold\n";
+	}
+	catch (const std::overflow_error &)
+	{
+	}
+
+	// Write a map file, read it whole and split between two processes
+	//  RET: the written map; rank 1 of 2 holds the last two entries
+	writeOutput::writeBinary(testMap, "testBinaryMap.bin");
+	if (readInput::readBinaryMap<int64_t>("testBinaryMap.bin") != testMap)
+		failLog += "readInput readBinaryMap<int64_t> read error occurred\n";
+	if (readInput::readBinaryMap<int64_t>("testBinaryMap.bin", 2, 1) != std::map<std::vector<int64_t>, int64_t>{{{5000000000, 6}, 7}, {{8, 9}, 10}})
+		failLog += "readInput readBinaryMap<int64_t> block read error occurred\n";
+	try
+	{
+		MapBinaryFile<int64_t> mapFile("testBinaryMap.bin");
+		if (mapFile.cache != std::pair<std::vector<int64_t>, int64_t>{{0, 1}, 2})
+			failLog += "multifileops MapBinaryFile read error occurred\n";
+	}
+	catch (const std::runtime_error &)
+	{
+		failLog += "multifileops MapBinaryFile rejected an LHFB file\n";
+	}
+
+	// Write the pre-header layout (count, vector size, then the indices)
+	//  RET: every reader rejects the file
+	std::ofstream headless("testBinaryHeadless.bin", std::ios::binary);
+	size_t sizes[2] = {1, 3};
+	int32_t indices[3] = {0, 1, 2};
+	headless.write(reinterpret_cast<const char *>(sizes), sizeof(sizes));
+	headless.write(reinterpret_cast<const char *>(indices), sizeof(indices));
+	headless.close();
+	if (!readInput::readBinaryVector<int32_t>("testBinaryHeadless.bin").empty() || !readInput::readBinaryMap<int32_t>("testBinaryHeadless.bin").empty())
+		failLog += "readInput read a file without the LHFB header\n";
+	try
+	{
+		VectorBinaryFile<int32_t> vectorFile("testBinaryHeadless.bin");
+		failLog += "multifileops VectorBinaryFile read a file without the LHFB header\n";
+	}
+	catch (const std::runtime_error &)
+	{
+	}
+
+	// Remove the files
+	std::remove("testBinaryVector.bin");
+	std::remove("testBinaryMap.bin");
+	std::remove("testBinaryHeadless.bin");
+
+	// Output log status to calling function
+	if (failLog.size() > 0)
+	{
+		log += "FAILED: Write Binary Functions---------------------------\n" + failLog;
+	}
+	else
+	{
+		log += "PASSED: Write Binary Functions---------------------------\n";
+	}
+
+	return;
+}
+
 int main(int, char **)
 {
 	std::string log;
 	t_write_functions(log);
 	t_write_csv_functions(log);
 	t_write_mat_functions(log);
+	t_write_binary_functions(log);
 
 	std::cout << std::endl
 			  << log << std::endl;